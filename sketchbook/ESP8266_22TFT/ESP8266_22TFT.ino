@@ -23,6 +23,10 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266WebServer.h>
 
+// the refresh tasks of the display fields and the dummy values
+#define SIMPLE_TASK_MAX_TASKS    20
+#include <SimpleTask.h>
+
 #define TFT_DC     5
 #define TFT_CS     4
 #define TFT_MOSI  13
@@ -197,6 +201,25 @@ int tft_text_size;
 int tft_hor_spacing;
 int tft_vert_spacing;
 
+// each field of the display is redrawn by a task of the scheduler
+#define TFT_REFRESH_INTVAL     1000
+//  max. msecs loop() waits for the next task (see SimpleTask)
+#define LOOP_MAX_IDLE            10
+
+// colors of a field, passed to its refresh task as arg
+struct tftField {
+  int displayTextColor;
+  int displayBgColor;
+  int textColor;
+  int bgColor;
+};
+
+tftField tftWhiteField = { ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+tftField tftGreenField = { ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+tftField tftYellowField = { ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+
+SimpleTask Tasks;
+
 // ///////////////////////
 //
 
@@ -299,6 +322,31 @@ void setup()
   tft_drawFrames( ILI9340_BLACK, ILI9340_WHITE, ILI9340_CYAN );
   delay(3000);
   tft_drawFrameLabels();
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateRefresh, &tftWhiteField, "date");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateDot1Refresh, &tftWhiteField, "date dot 1");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateDot2Refresh, &tftWhiteField, "date dot 2");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_WDayRefresh, &tftWhiteField, "weekday");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeRefresh, &tftWhiteField, "time");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeQuoteRefresh, &tftWhiteField, "time quote");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeDotRefresh, &tftWhiteField, "time dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TempRefresh, &tftGreenField, "temp");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TempDotRefresh, &tftGreenField, "temp dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_LoadRefresh, &tftYellowField, "load");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_LoadDotRefresh, &tftYellowField, "load dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPRefresh, &tftWhiteField, "ip");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot1Refresh, &tftWhiteField, "ip dot 1");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot2Refresh, &tftWhiteField, "ip dot 2");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot3Refresh, &tftWhiteField, "ip dot 3");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_FreeMemRefresh, &tftGreenField, "free mem");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_FreeSDRefresh, &tftGreenField, "free sd");
 }
 //
 // ************
@@ -464,679 +512,687 @@ Serial.println("drawFastVLine()");
 //
 // ************
 //
-void tft_DateDot1Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_DateDot1Refresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_DateDot2Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_DateDot2Refresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_DateRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int day, int month, int year )
+void tft_DateRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int day = gDay;
+  int month = gMonth;
+  int year = gYear;
   static int lastDay, lastMonth, lastYear;
   int savX, savY;
   char cOutput[5];
 
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    if( day != lastDay )
-    {
-      lastDay = day;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
-      tft.print("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
-      sprintf(cOutput, "%02d", day);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    if( month != lastMonth )
-    {
-      lastMonth = month;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
-      tft.print("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
-      sprintf(cOutput, "%02d", month);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( day != lastDay )
+  {
+    lastDay = day;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
+    tft.print("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
+    sprintf(cOutput, "%02d", day);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    if( year != lastYear )
-    {
-      lastYear = year;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
-      tft.println("    ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
-      sprintf(cOutput, "%04d", year);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( month != lastMonth )
+  {
+    lastMonth = month;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
+    tft.print("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
+    sprintf(cOutput, "%02d", month);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor); 
-    mSecs = millis();
+  if( year != lastYear )
+  {
+    lastYear = year;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
+    tft.println("    ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
+    sprintf(cOutput, "%04d", year);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
   }
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor); 
 }
 //
 // ************
 //
-void tft_WDayRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int wDay )
+void tft_WDayRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int wDay = gWDay;
   static int lastWDay;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+
+  if( wDay != lastWDay )
   {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+    lastWDay = wDay;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
+    tft.print("  ");
 
-    if( wDay != lastWDay )
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
+
+    switch( wDay )
     {
-      lastWDay = wDay;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
-      tft.print("  ");
-
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
-
-      switch( wDay )
-      {
-        case 0:
-          tft.print("So");
-          break;
-        case 1:
-          tft.print("Mo");
-          break;
-        case 2:
-          tft.print("Di");
-          break;
-        case 3:
-          tft.print("Mi");
-          break;
-        case 4:
-          tft.print("Do");
-          break;
-        case 5:
-          tft.print("Fr");
-          break;
-        case 6:
-          tft.print("Sa");
-          break;
-        default:
-          break;
-      }
-
-      tft.setTextColor(textColor, bgColor); 
+      case 0:
+        tft.print("So");
+        break;
+      case 1:
+        tft.print("Mo");
+        break;
+      case 2:
+        tft.print("Di");
+        break;
+      case 3:
+        tft.print("Mi");
+        break;
+      case 4:
+        tft.print("Do");
+        break;
+      case 5:
+        tft.print("Fr");
+        break;
+      case 6:
+        tft.print("Sa");
+        break;
+      default:
+        break;
     }
 
-    tft.setCursor( savX, savY );
     tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
   }
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_TimeRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int hour, int minute, int second )
+void tft_TimeRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int hour = gHour;
+  int minute = gMinute;
+  int second = gSecond;
   static int lastHour, lastMinute, lastSecond;
-  static long mSecs;
 
   char cOutBuf[3];
   int savX, savY;
 //
 //
 
-  if( millis() - mSecs >= interval )
-  {
-
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
 
-    if( hour != lastHour )
-    {
-      lastHour = hour;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);    
-      sprintf(cOutBuf, "%02d", hour);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    if( minute != lastMinute )
-    {
-      lastMinute = minute;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);    
-      sprintf(cOutBuf, "%02d", minute);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( hour != lastHour )
+  {
+    lastHour = hour;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);    
+    sprintf(cOutBuf, "%02d", hour);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    if( second != lastSecond )
-    {
-      lastSecond = second;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);    
-      sprintf(cOutBuf, "%02d", second);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( minute != lastMinute )
+  {
+    lastMinute = minute;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);    
+    sprintf(cOutBuf, "%02d", minute);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    tft.setCursor( savX, savY );
-    mSecs = millis();
+  if( second != lastSecond )
+  {
+    lastSecond = second;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);    
+    sprintf(cOutBuf, "%02d", second);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
   }
+
+  tft.setCursor( savX, savY );
 }
 //
 // ************
 //
-void tft_TimeQuoteRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_TimeQuoteRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
   
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-    
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
-    tft.print(" ");
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+  
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
+  tft.print(" ");
 
-    tft.setTextColor(displayTextColor, displayBgColor); 
-    tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
-    tft.print(":");
-    
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setTextColor(displayTextColor, displayBgColor); 
+  tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
+  tft.print(":");
+  
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_TimeDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_TimeDotRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
   
-  if( millis() - mSecs >= interval )
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
+  tft.print(".");
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
+}
+//
+// ************
+//
+void tft_TempRefresh( void *arg )
+{
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  const char *degree = gDegree.c_str();
+  const char *tenth = gDegreeTenth.c_str();
+  static int lastDegree, lastTenth;
+  static int DStatus;
+  
+  int savX, savY;
+  char cOutBuf[3];
+
+
+  if( atoi(degree) != lastDegree ||
+      atoi(tenth) != lastTenth )
   {
     savX = tft.getCursorX();
     savY = tft.getCursorY();
 
+    lastDegree = atoi(degree);
+    lastTenth = atoi(tenth);
+
+    tft.setTextSize( MEDIUM_TEXT_SIZE );
+
     tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
+    tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
+    tft.print(" ");
+    sprintf(cOutBuf, "%s", degree);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
+    tft.print(cOutBuf);
+
+
+    if( DStatus <= 0)
+    {
+      DStatus = 1;
+      tft.print(".");
+    }
+    else
+    {
+      DStatus = 0;
+      tft.print(" ");        
+    }
+    
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
     tft.print(" ");
+    sprintf(cOutBuf, "%s", tenth);
     tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
-    tft.print(".");
+    tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
+    tft.print(cOutBuf);
+
+    tft.setTextSize( SMALL_TEXT_SIZE );
 
     tft.setCursor( savX, savY );
     tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
+
   }
 }
 //
 // ************
 //
-void tft_TempRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, char *degree, char *tenth )
+void tft_TempDotRefresh( void *arg )
 {
-  static int lastDegree, lastTenth;
-  static long mSecs;
-  static int DStatus;
-  
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  char cOutBuf[3];
-
 
-  if( millis() - mSecs >= interval )
-  {
-    if( atoi(degree) != lastDegree ||
-        atoi(tenth) != lastTenth )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastDegree = atoi(degree);
-      lastTenth = atoi(tenth);
-
-      tft.setTextSize( MEDIUM_TEXT_SIZE );
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%s", degree);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
-      tft.print(cOutBuf);
-
-      if( millis() - mSecs >= 1000 )
-      {
-
-        if( DStatus <= 0)
-        {
-          DStatus = 1;
-          tft.print(".");
-        }
-        else
-        {
-          DStatus = 0;
-          tft.print(" ");        
-        }
-      }
-      
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%s", tenth);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
-      tft.print(cOutBuf);
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-      tft.setTextSize( SMALL_TEXT_SIZE );
+  tft.setTextSize( MEDIUM_TEXT_SIZE );
 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
+  tft.print(".");
 
-    }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 
-    mSecs = millis();
-  }
+  tft.setTextSize( SMALL_TEXT_SIZE );
 }
 //
 // ************
 //
-void tft_TempDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_LoadRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  const char *load = gLoad.c_str();
+  const char *tenth = gLoadTenth.c_str();
+  static int lastLoad, lastTenth;
   int savX, savY;
-  static long mSecs;
+  char cOutBuf[3];
 
-  if( millis() - mSecs >= interval )
+  if( atoi(load) != lastLoad ||
+      atoi(tenth) != lastTenth )
   {
     savX = tft.getCursorX();
     savY = tft.getCursorY();
 
+    lastLoad = atoi(load);
+    lastTenth = atoi(tenth);
+
     tft.setTextSize( MEDIUM_TEXT_SIZE );
 
     tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
+    tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
+    
+    tft.print(" ");
+    sprintf(cOutBuf, "%s", load);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
+    tft.print(cOutBuf);
+
+
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
     tft.print(" ");
+    sprintf(cOutBuf, "%s", tenth);
     tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
-    tft.print(".");
+    tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
+    tft.print(cOutBuf);
 
     tft.setCursor( savX, savY );
     tft.setTextColor(textColor, bgColor); 
 
     tft.setTextSize( SMALL_TEXT_SIZE );
-
-    mSecs = millis();
   }
 }
 //
 // ************
 //
-void tft_LoadRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, char *load, char *tenth )
+void tft_LoadDotRefresh( void *arg )
 {
-  static int lastLoad, lastTenth;
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  char cOutBuf[3];
-
-  if( millis() - mSecs >= interval )
-  {
-    if( atoi(load) != lastLoad ||
-        atoi(tenth) != lastTenth )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
 
-      lastLoad = atoi(load);
-      lastTenth = atoi(tenth);
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-      tft.setTextSize( MEDIUM_TEXT_SIZE );
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
-      
-      tft.print(" ");
-      sprintf(cOutBuf, "%s", load);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
-      tft.print(cOutBuf);
+  tft.setTextSize( MEDIUM_TEXT_SIZE );
 
 
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%s", tenth);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
-      tft.print(cOutBuf);
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
+      
+  tft.print(".");
 
-      tft.setTextSize( SMALL_TEXT_SIZE );
-    }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 
-    mSecs = millis();
-  }
+  tft.setTextSize( SMALL_TEXT_SIZE );
 }
 //
 // ************
 //
-void tft_LoadDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot1Refresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
-
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    tft.setTextSize( MEDIUM_TEXT_SIZE );
-
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
-        
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-
-    tft.setTextSize( SMALL_TEXT_SIZE );
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPDot1Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot2Refresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPDot2Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot3Refresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPDot3Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int abyte = gAbyte;
+  int bbyte = gBbyte;
+  int cbyte = gCbyte;
+  int dbyte = gDbyte;
+  static int lastAByte, lastBByte, lastCByte, lastDByte;
   int savX, savY;
+  char cOutBuf[6];
 
-  if( millis() - mSecs >= interval )
+
+
+  if( abyte != lastAByte ||
+      bbyte != lastBByte ||
+      cbyte != lastCByte ||
+      dbyte != lastDByte )
   {
     savX = tft.getCursorX();
     savY = tft.getCursorY();
 
+    lastAByte = abyte;
+    lastBByte = bbyte;
+    lastCByte = cbyte;
+    lastDByte = dbyte;
+
     tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
-    tft.print(" ");
+
+
+    tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
+    tft.print("   ");
     tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
-    tft.print(".");
+    tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
+    sprintf(cOutBuf, "%03d", abyte);
+    tft.print(cOutBuf);
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
-}
-//
-// ************
-//
-void tft_IPRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int abyte, int bbyte, int cbyte, int dbyte )
-{
-  static int lastAByte, lastBByte, lastCByte, lastDByte;
-  static long mSecs;
-  int savX, savY;
-  char cOutBuf[6];
+    tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
+    sprintf(cOutBuf, "%03d", bbyte);
+    tft.print(cOutBuf);
 
+    tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
+    sprintf(cOutBuf, "%03d", cbyte);
+    tft.print(cOutBuf);
 
-  if( millis() - mSecs >= interval )
-  {
+    tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
+    sprintf(cOutBuf, "%03d", dbyte);
+    tft.print(cOutBuf);
 
-    if( abyte != lastAByte ||
-        bbyte != lastBByte ||
-        cbyte != lastCByte ||
-        dbyte != lastDByte )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastAByte = abyte;
-      lastBByte = bbyte;
-      lastCByte = cbyte;
-      lastDByte = dbyte;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-
-
-      tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
-      sprintf(cOutBuf, "%03d", abyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
-      sprintf(cOutBuf, "%03d", bbyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
-      sprintf(cOutBuf, "%03d", cbyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
-      sprintf(cOutBuf, "%03d", dbyte);
-      tft.print(cOutBuf);
-
-
-
-      // 192.168.001.110
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
 
-    mSecs = millis();
+
+    // 192.168.001.110
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
 // ************
 //
-void tft_FreeMemRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, long freemem )
+void tft_FreeMemRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  long freemem = gFreemem;
   static int lastFreemem;
-  static long mSecs;
   int savX, savY;
   char cOutBuf[6];
 
-  if( millis() - mSecs >= interval )
+  if( freemem != lastFreemem )
   {
-    if( freemem != lastFreemem )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastFreemem = freemem;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
-      tft.print("     ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
-      sprintf(cOutBuf, "%4d", freemem);
-      tft.print(cOutBuf);
-
-      // 684 M
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
+
+    lastFreemem = freemem;
 
-    mSecs = millis();
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
+    tft.print("     ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
+    sprintf(cOutBuf, "%4d", freemem);
+    tft.print(cOutBuf);
+
+    // 684 M
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
 // ************
 //
-void tft_FreeSDRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, long freesd )
+void tft_FreeSDRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  long freesd = gFreesd;
   static int lastFreeSD;
   int savX, savY;
   char cOutBuf[6];
 
 
-  if( millis() - mSecs >= interval )
+  if( freesd != lastFreeSD )
   {
-    if( freesd != lastFreeSD )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastFreeSD = freesd;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
-      tft.print("     ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
-      sprintf(cOutBuf, "%5d", freesd);
-      tft.print(cOutBuf);
-
-      // 684 M
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
+
+    lastFreeSD = freesd;
+
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
+    tft.print("     ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
+    sprintf(cOutBuf, "%5d", freesd);
+    tft.print(cOutBuf);
 
-    mSecs = millis();
+    // 684 M
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
@@ -1144,34 +1200,11 @@ void tft_FreeSDRefresh( int interval, int displayTextColor, int displayBgColor,
 //
 void loop(void) 
 {
-
-  tft_DateRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gDay, gMonth, gYear );
-  tft_DateDot1Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_DateDot2Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-
-  tft_WDayRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gWDay );
-
-  tft_TimeRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gHour, gMinute, gSecond );
-  tft_TimeQuoteRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_TimeDotRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-
-  tft_TempRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, (char*)gDegree.c_str(), (char*)gDegreeTenth.c_str() );
-  tft_TempDotRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK);
-
-  tft_LoadRefresh( 1000, ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, (char*)gLoad.c_str(), (char*)gLoadTenth.c_str() );
-  tft_LoadDotRefresh( 1000, ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK);
-
-  tft_IPRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gAbyte, gBbyte, gCbyte, gDbyte );
-  tft_IPDot1Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_IPDot2Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_IPDot3Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-
-  tft_FreeMemRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gFreemem );
-
-  tft_FreeSDRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, gFreesd );
+  Tasks.Run();
 
   server.handleClient();
 
+  Tasks.Idle(LOOP_MAX_IDLE);
 }
 
 
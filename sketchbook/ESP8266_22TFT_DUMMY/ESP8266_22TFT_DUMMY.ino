@@ -20,6 +20,10 @@
 #include "Adafruit_ILI9340.h"
 // https://github.com/glennirwin/Adafruit_ILI9340
 
+// the refresh tasks of the display fields and the dummy values
+#define SIMPLE_TASK_MAX_TASKS    20
+#include <SimpleTask.h>
+
 // For the Adafruit shield, these are the default.
 // #define TFT_DC 9
 // #define TFT_CS 10
@@ -77,6 +81,35 @@ int tft_text_size;
 int tft_hor_spacing;
 int tft_vert_spacing;
 
+// each field of the display is redrawn by a task of the scheduler
+#define TFT_REFRESH_INTVAL     1000
+//  max. msecs loop() waits for the next task (see SimpleTask)
+#define LOOP_MAX_IDLE            10
+
+// colors of a field, passed to its refresh task as arg
+struct tftField {
+  int displayTextColor;
+  int displayBgColor;
+  int textColor;
+  int bgColor;
+};
+
+tftField tftWhiteField = { ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+tftField tftGreenField = { ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+tftField tftYellowField = { ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK };
+
+SimpleTask Tasks;
+
+// values shown, changed by the dummy tasks
+int gDay = 19, gMonth = 5, gYear = 2016;
+int gWDay = 4;
+int gHour = 1, gMinute = 32, gSecond = 16;
+int gDegree = 57, gDegreeTenth = 22;
+int gLoad = 2, gLoadTenth = 17;
+int gAbyte = 192, gBbyte = 168, gCbyte = 1, gDbyte = 23;
+long gFreemem = 1234;
+long gFreesd = 56789;
+
 
 
 
@@ -247,6 +280,34 @@ Serial.println("display_out");
   tft_drawFrames( ILI9340_BLACK, ILI9340_WHITE, ILI9340_CYAN );
   delay(3000);
   tft_drawFrameLabels();
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateRefresh, &tftWhiteField, "date");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateDot1Refresh, &tftWhiteField, "date dot 1");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_DateDot2Refresh, &tftWhiteField, "date dot 2");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_WDayRefresh, &tftWhiteField, "weekday");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeRefresh, &tftWhiteField, "time");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeQuoteRefresh, &tftWhiteField, "time quote");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TimeDotRefresh, &tftWhiteField, "time dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TempRefresh, &tftGreenField, "temp");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_TempDotRefresh, &tftGreenField, "temp dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_LoadRefresh, &tftYellowField, "load");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_LoadDotRefresh, &tftYellowField, "load dot");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPRefresh, &tftWhiteField, "ip");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot1Refresh, &tftWhiteField, "ip dot 1");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot2Refresh, &tftWhiteField, "ip dot 2");
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_IPDot3Refresh, &tftWhiteField, "ip dot 3");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_FreeMemRefresh, &tftGreenField, "free mem");
+
+  Tasks.Every(TFT_REFRESH_INTVAL, tft_FreeSDRefresh, &tftGreenField, "free sd");
+
+  Tasks.Every(5000, dummyNextValues, NULL, "dummy values");
+  Tasks.Every(1000, dummyNextSecond, NULL, "dummy second");
 }
 
 
@@ -410,350 +471,355 @@ Serial.println("drawFastVLine()");
 //
 // ************
 //
-void tft_DateDot1Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_DateDot1Refresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT1_X, POS_DATE_DOT1_Y);
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_DateDot2Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_DateDot2Refresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_DATE_DOT2_X, POS_DATE_DOT2_Y);
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_DateRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int day, int month, int year )
+void tft_DateRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int day = gDay;
+  int month = gMonth;
+  int year = gYear;
   static int lastDay, lastMonth, lastYear;
   int savX, savY;
   char cOutput[5];
 
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    if( day != lastDay )
-    {
-      lastDay = day;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
-      tft.print("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
-      sprintf(cOutput, "%02d", day);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    if( month != lastMonth )
-    {
-      lastMonth = month;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
-      tft.print("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
-      sprintf(cOutput, "%02d", month);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( day != lastDay )
+  {
+    lastDay = day;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
+    tft.print("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_DAY_X, POS_DATE_DAY_Y);
+    sprintf(cOutput, "%02d", day);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    if( year != lastYear )
-    {
-      lastYear = year;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
-      tft.println("    ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
-      sprintf(cOutput, "%04d", year);
-      tft.print(cOutput);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( month != lastMonth )
+  {
+    lastMonth = month;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
+    tft.print("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_MONTH_X, POS_DATE_MONTH_Y);
+    sprintf(cOutput, "%02d", month);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor); 
-    mSecs = millis();
+  if( year != lastYear )
+  {
+    lastYear = year;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
+    tft.println("    ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_DATE_YEAR_X, POS_DATE_YEAR_Y);
+    sprintf(cOutput, "%04d", year);
+    tft.print(cOutput);
+    tft.setTextColor(textColor, bgColor); 
   }
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor); 
 }
 //
 // ************
 //
-void tft_WDayRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int wDay )
+void tft_WDayRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int wDay = gWDay;
   static int lastWDay;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+
+  if( wDay != lastWDay )
   {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+    lastWDay = wDay;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
+    tft.print("  ");
+
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
 
-    if( wDay != lastWDay )
+    switch( wDay )
     {
-      lastWDay = wDay;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
-      tft.print("  ");
-
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_WDAY_X, POS_WDAY_Y);
-
-      switch( wDay )
-      {
-        case 0:
-          tft.print("So");
-          break;
-        case 1:
-          tft.print("Mo");
-          break;
-        case 2:
-          tft.print("Di");
-          break;
-        case 3:
-          tft.print("Mi");
-          break;
-        case 4:
-          tft.print("Do");
-          break;
-        case 5:
-          tft.print("Fr");
-          break;
-        case 6:
-          tft.print("Sa");
-          break;
-        default:
-          break;
-      }
-
-      tft.setTextColor(textColor, bgColor); 
+      case 0:
+        tft.print("So");
+        break;
+      case 1:
+        tft.print("Mo");
+        break;
+      case 2:
+        tft.print("Di");
+        break;
+      case 3:
+        tft.print("Mi");
+        break;
+      case 4:
+        tft.print("Do");
+        break;
+      case 5:
+        tft.print("Fr");
+        break;
+      case 6:
+        tft.print("Sa");
+        break;
+      default:
+        break;
     }
 
-    tft.setCursor( savX, savY );
     tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
   }
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_TimeRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int hour, int minute, int second )
+void tft_TimeRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int hour = gHour;
+  int minute = gMinute;
+  int second = gSecond;
   static int lastHour, lastMinute, lastSecond;
-  static long mSecs;
 
   char cOutBuf[3];
   int savX, savY;
 //
 //
 
-  if( millis() - mSecs >= interval )
-  {
 
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    if( hour != lastHour )
-    {
-      lastHour = hour;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);    
-      sprintf(cOutBuf, "%02d", hour);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    if( minute != lastMinute )
-    {
-      lastMinute = minute;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);    
-      sprintf(cOutBuf, "%02d", minute);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( hour != lastHour )
+  {
+    lastHour = hour;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_HOUR_X, POS_TIME_HOUR_Y);    
+    sprintf(cOutBuf, "%02d", hour);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    if( second != lastSecond )
-    {
-      lastSecond = second;
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);
-      tft.println("  ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);    
-      sprintf(cOutBuf, "%02d", second);
-      tft.print(cOutBuf);
-      tft.setTextColor(textColor, bgColor); 
-    }
+  if( minute != lastMinute )
+  {
+    lastMinute = minute;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_MINUTE_X, POS_TIME_MINUTE_Y);    
+    sprintf(cOutBuf, "%02d", minute);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
+  }
 
-    tft.setCursor( savX, savY );
-    mSecs = millis();
+  if( second != lastSecond )
+  {
+    lastSecond = second;
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);
+    tft.println("  ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_TIME_SECOND_X, POS_TIME_SECOND_Y);    
+    sprintf(cOutBuf, "%02d", second);
+    tft.print(cOutBuf);
+    tft.setTextColor(textColor, bgColor); 
   }
+
+  tft.setCursor( savX, savY );
 }
 //
 // ************
 //
-void tft_TimeQuoteRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_TimeQuoteRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
   
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-    
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
-    tft.print(" ");
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+  
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
+  tft.print(" ");
 
-    tft.setTextColor(displayTextColor, displayBgColor); 
-    tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
-    tft.print(":");
-    
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setTextColor(displayTextColor, displayBgColor); 
+  tft.setCursor(POS_TIME_QUOTE_X, POS_TIME_QUOTE_Y);
+  tft.print(":");
+  
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_TimeDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_TimeDotRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
   
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
-    tft.print(".");
-
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
+
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_TIME_DOT_X, POS_TIME_DOT_Y);
+  tft.print(".");
+
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_TempRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int degree, int tenth )
+void tft_TempRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int degree = gDegree;
+  int tenth = gDegreeTenth;
   static int lastDegree, lastTenth;
-  static long mSecs;
   static int DStatus;
   
   int savX, savY;
   char cOutBuf[3];
 
 
-  if( millis() - mSecs >= interval )
+  if( degree != lastDegree ||
+      tenth != lastTenth )
   {
-    if( degree != lastDegree ||
-        tenth != lastTenth )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastDegree = degree;
-      lastTenth = tenth;
-
-      tft.setTextSize( MEDIUM_TEXT_SIZE );
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%2d", degree);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
-      tft.print(cOutBuf);
-
-      if( millis() - mSecs >= 1000 )
-      {
-
-        if( DStatus <= 0)
-        {
-          DStatus = 1;
-          tft.print(".");
-        }
-        else
-        {
-          DStatus = 0;
-          tft.print(" ");        
-        }
-      }
-      
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%2d", tenth);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
-      tft.print(cOutBuf);
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
 
-      tft.setTextSize( SMALL_TEXT_SIZE );
+    lastDegree = degree;
+    lastTenth = tenth;
 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
+    tft.setTextSize( MEDIUM_TEXT_SIZE );
 
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
+    tft.print(" ");
+    sprintf(cOutBuf, "%2d", degree);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_TEMP_TEMP_X, POS_TEMP_TEMP_Y );
+    tft.print(cOutBuf);
+
+
+    if( DStatus <= 0)
+    {
+      DStatus = 1;
+      tft.print(".");
+    }
+    else
+    {
+      DStatus = 0;
+      tft.print(" ");        
     }
+    
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
+    tft.print(" ");
+    sprintf(cOutBuf, "%2d", tenth);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_TEMP_TENTH_X, POS_TEMP_TENTH_Y );
+    tft.print(cOutBuf);
+
+    tft.setTextSize( SMALL_TEXT_SIZE );
+
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
 
-    mSecs = millis();
   }
 }
 
@@ -764,499 +830,433 @@ void tft_TempRefresh( int interval, int displayTextColor, int displayBgColor, in
 
 
 
-void tft_TempDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_TempDotRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
-
-    tft.setTextSize( MEDIUM_TEXT_SIZE );
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
-    tft.print(".");
+  tft.setTextSize( MEDIUM_TEXT_SIZE );
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_TEMP_DOT_X, POS_TEMP_DOT_Y);
+  tft.print(".");
 
-    tft.setTextSize( SMALL_TEXT_SIZE );
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 
-    mSecs = millis();
-  }
+  tft.setTextSize( SMALL_TEXT_SIZE );
 }
 //
 // ************
 //
-void tft_LoadRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int load, int tenth )
+void tft_LoadRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int load = gLoad;
+  int tenth = gLoadTenth;
   static int lastLoad, lastTenth;
-  static long mSecs;
   int savX, savY;
   char cOutBuf[3];
 
-  if( millis() - mSecs >= interval )
+  if( load != lastLoad ||
+      tenth != lastTenth )
   {
-    if( load != lastLoad ||
-        tenth != lastTenth )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastLoad = load;
-      lastTenth = tenth;
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
 
-      tft.setTextSize( MEDIUM_TEXT_SIZE );
+    lastLoad = load;
+    lastTenth = tenth;
 
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
-      
-      tft.print(" ");
-      sprintf(cOutBuf, "%d", load);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
-      tft.print(cOutBuf);
+    tft.setTextSize( MEDIUM_TEXT_SIZE );
 
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
+    
+    tft.print(" ");
+    sprintf(cOutBuf, "%d", load);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_LOAD_LOAD_X, POS_LOAD_LOAD_Y );
+    tft.print(cOutBuf);
 
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
-      tft.print(" ");
-      sprintf(cOutBuf, "%2d", tenth);
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
-      tft.print(cOutBuf);
 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
+    tft.print(" ");
+    sprintf(cOutBuf, "%2d", tenth);
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(  POS_LOAD_TENTH_X, POS_LOAD_TENTH_Y );
+    tft.print(cOutBuf);
 
-      tft.setTextSize( SMALL_TEXT_SIZE );
-    }
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
 
-    mSecs = millis();
+    tft.setTextSize( SMALL_TEXT_SIZE );
   }
 }
 //
 // ************
 //
-void tft_LoadDotRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_LoadDotRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
-  static long mSecs;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextSize( MEDIUM_TEXT_SIZE );
+  tft.setTextSize( MEDIUM_TEXT_SIZE );
 
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
 
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
-        
-    tft.print(".");
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor(POS_LOAD_DOT_X, POS_LOAD_DOT_Y);
+      
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 
-    tft.setTextSize( SMALL_TEXT_SIZE );
-    mSecs = millis();
-  }
+  tft.setTextSize( SMALL_TEXT_SIZE );
 }
 //
 // ************
 //
-void tft_IPDot1Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot1Refresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT1_X, POS_IP_DOT1_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPDot2Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot2Refresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT2_X, POS_IP_DOT2_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPDot3Refresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor )
+void tft_IPDot3Refresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
   int savX, savY;
 
-  if( millis() - mSecs >= interval )
-  {
-    savX = tft.getCursorX();
-    savY = tft.getCursorY();
+  savX = tft.getCursorX();
+  savY = tft.getCursorY();
 
-    tft.setTextColor(displayBgColor, displayBgColor); 
-    tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
-    tft.print(" ");
-    tft.setTextColor(displayTextColor, displayBgColor ); 
-    tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
-    tft.print(".");
+  tft.setTextColor(displayBgColor, displayBgColor); 
+  tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
+  tft.print(" ");
+  tft.setTextColor(displayTextColor, displayBgColor ); 
+  tft.setCursor( POS_IP_DOT3_X, POS_IP_DOT3_Y );
+  tft.print(".");
 
-    tft.setCursor( savX, savY );
-    tft.setTextColor(textColor, bgColor); 
-    mSecs = millis();
-  }
+  tft.setCursor( savX, savY );
+  tft.setTextColor(textColor, bgColor); 
 }
 //
 // ************
 //
-void tft_IPRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, int abyte, int bbyte, int cbyte, int dbyte )
+void tft_IPRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  int abyte = gAbyte;
+  int bbyte = gBbyte;
+  int cbyte = gCbyte;
+  int dbyte = gDbyte;
   static int lastAByte, lastBByte, lastCByte, lastDByte;
-  static long mSecs;
   int savX, savY;
   char cOutBuf[6];
 
 
-  if( millis() - mSecs >= interval )
+
+  if( abyte != lastAByte ||
+      bbyte != lastBByte ||
+      cbyte != lastCByte ||
+      dbyte != lastDByte )
   {
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
+
+    lastAByte = abyte;
+    lastBByte = bbyte;
+    lastCByte = cbyte;
+    lastDByte = dbyte;
+
+    tft.setTextColor(displayBgColor, displayBgColor); 
+
+
+    tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
+    sprintf(cOutBuf, "%03d", abyte);
+    tft.print(cOutBuf);
+
+    tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
+    sprintf(cOutBuf, "%03d", bbyte);
+    tft.print(cOutBuf);
+
+    tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
+    sprintf(cOutBuf, "%03d", cbyte);
+    tft.print(cOutBuf);
+
+    tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
+    tft.print("   ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
+    sprintf(cOutBuf, "%03d", dbyte);
+    tft.print(cOutBuf);
 
-    if( abyte != lastAByte ||
-        bbyte != lastBByte ||
-        cbyte != lastCByte ||
-        dbyte != lastDByte )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastAByte = abyte;
-      lastBByte = bbyte;
-      lastCByte = cbyte;
-      lastDByte = dbyte;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-
-
-      tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_ABYTE_X, POS_IP_ABYTE_Y );
-      sprintf(cOutBuf, "%03d", abyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_BBYTE_X, POS_IP_BBYTE_Y );
-      sprintf(cOutBuf, "%03d", bbyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_CBYTE_X, POS_IP_CBYTE_Y );
-      sprintf(cOutBuf, "%03d", cbyte);
-      tft.print(cOutBuf);
-
-      tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
-      tft.print("   ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor( POS_IP_DBYTE_X, POS_IP_DBYTE_Y );
-      sprintf(cOutBuf, "%03d", dbyte);
-      tft.print(cOutBuf);
-
-
-
-      // 192.168.001.110
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
 
-    mSecs = millis();
+
+    // 192.168.001.110
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
 // ************
 //
-void tft_FreeMemRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, long freemem )
+void tft_FreeMemRefresh( void *arg )
 {
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  long freemem = gFreemem;
   static int lastFreemem;
-  static long mSecs;
   int savX, savY;
   char cOutBuf[6];
 
-  if( millis() - mSecs >= interval )
+  if( freemem != lastFreemem )
   {
-    if( freemem != lastFreemem )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastFreemem = freemem;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
-      tft.print("     ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
-      sprintf(cOutBuf, "%4d", freemem);
-      tft.print(cOutBuf);
-
-      // 684 M
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
+
+    lastFreemem = freemem;
+
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
+    tft.print("     ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_FREE_MEM_X, POS_FREE_MEM_Y);
+    sprintf(cOutBuf, "%4d", freemem);
+    tft.print(cOutBuf);
 
-    mSecs = millis();
+    // 684 M
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
 // ************
 //
-void tft_FreeSDRefresh( int interval, int displayTextColor, int displayBgColor, int textColor, int bgColor, long freesd )
+void tft_FreeSDRefresh( void *arg )
 {
-  static long mSecs;
+  tftField *field = (tftField *) arg;
+  int displayTextColor = field->displayTextColor;
+  int displayBgColor = field->displayBgColor;
+  int textColor = field->textColor;
+  int bgColor = field->bgColor;
+  long freesd = gFreesd;
   static int lastFreeSD;
   int savX, savY;
   char cOutBuf[6];
 
 
-  if( millis() - mSecs >= interval )
+  if( freesd != lastFreeSD )
   {
-    if( freesd != lastFreeSD )
-    {
-      savX = tft.getCursorX();
-      savY = tft.getCursorY();
-
-      lastFreeSD = freesd;
-
-      tft.setTextColor(displayBgColor, displayBgColor); 
-      tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
-      tft.print("     ");
-      tft.setTextColor(displayTextColor, displayBgColor ); 
-      tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
-      sprintf(cOutBuf, "%4d", freesd);
-      tft.print(cOutBuf);
-
-      // 684 M
-      // 
-      tft.setCursor( savX, savY );
-      tft.setTextColor(textColor, bgColor); 
-    }
+    savX = tft.getCursorX();
+    savY = tft.getCursorY();
+
+    lastFreeSD = freesd;
 
-    mSecs = millis();
+    tft.setTextColor(displayBgColor, displayBgColor); 
+    tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
+    tft.print("     ");
+    tft.setTextColor(displayTextColor, displayBgColor ); 
+    tft.setCursor(POS_FREE_SD_X, POS_FREE_SD_Y);
+    sprintf(cOutBuf, "%4d", freesd);
+    tft.print(cOutBuf);
+
+    // 684 M
+    // 
+    tft.setCursor( savX, savY );
+    tft.setTextColor(textColor, bgColor); 
   }
 }
 //
 // ************
 //
-void loop(void) 
+void dummyNextValues( void *arg )
 {
-  static int day, month, year;
-  static int wDay;
-  static int hour, minute, second;
-  static int degree, dgTenth;
-  static int load, ldTenth;
-  static int abyte, bbyte, cbyte, dbyte;
-  static long freemem;
-  static long freesd;
-  static long mSecs, sSecs;
-
-  if( mSecs == 0 )
+  gDay++;
+  gMonth++;
+  gYear++;
+  gWDay++;
+  gHour++;
+  gMinute++;
+  gDegree++;
+  gDegreeTenth++;
+  gLoad++;
+  gLoadTenth++;
+  gFreemem++;
+  gFreesd++;
+
+  if( gDay > 31 )
   {
-    day = 19;
-    month = 5;
-    year = 2016;
-
-    wDay = 4;
-
-    hour = 1;
-    minute = 32;
-    second = 16;
-
-    degree = 57;
-    dgTenth = 22;
-    load = 2;
-    ldTenth = 17;
-
-    freemem = 1234;
-    freesd = 56789;
-
-    mSecs = millis();
-
+    gDay = 1;
   }
 
-  if( millis() - mSecs >= 5000 )
+  if( gMonth > 12 )
   {
-    day++;
-    month++;
-    year++;
-    wDay++;
-    hour++;
-    minute++;
-//    second += 5;
-    degree++;
-    dgTenth++;
-    load++;
-    ldTenth++;
-    freemem++;
-    freesd++;
+    gMonth = 1;
   }
-  
-  if( millis() - sSecs >= 1000 )
+
+  if( gYear > 2050 )
   {
-    second++;
+    gYear = 2001;
   }
 
-  if( millis() - mSecs >= 5000 )
+  if( gWDay > 6 )
   {
-    if( day > 31 )
-    {
-      day = 1;
-    }
-
-    if( month > 12 )
-    {
-      month = 1;
-    }
-
-    if( year > 2050 )
-    {
-      year = 2001;
-    }
-
-    if( wDay > 6 )
-    {
-      wDay = 0;
-    }
-
-    if( hour > 24 )
-    {
-      hour = 0;
-    }
-
-    if( minute > 60 )
-    {
-      minute = 0;
-    }
-
-//    if( second > 60 )
-//    {
-//      second = 0;
-//    }
-
-    if( degree > 87 )
-    {
-      degree = 58;
-    }
-
-    if( dgTenth > 99 )
-    {
-      dgTenth = 17;
-    }
-
-    if( load > 3 )
-    {
-      load = 0;
-    }
-
-    if( ldTenth > 99 )
-    {
-      ldTenth = 17;
-    }
-
-    if( freemem > 1342 )
-    {
-      freemem = 1234;
-    }
-
-    if( freesd > 13547 )
-    {
-      freesd = 13490;
-    }
-    
-    mSecs = millis();
+    gWDay = 0;
   }
-  
-  if( millis() - sSecs >= 1000 )
+
+  if( gHour > 24 )
   {
-    if( second > 60 )
-    {
-      second = 0;
-    }    
-    sSecs = millis();
+    gHour = 0;
   }
-  
-  tft_DateRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, day, month, year );
-  tft_DateDot1Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_DateDot2Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
 
-  tft_WDayRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, wDay );
+  if( gMinute > 60 )
+  {
+    gMinute = 0;
+  }
 
-  tft_TimeRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, hour, minute, second );
-  tft_TimeQuoteRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_TimeDotRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
+  if( gDegree > 87 )
+  {
+    gDegree = 58;
+  }
 
-  tft_TempRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, degree, dgTenth );
-  tft_TempDotRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK);
+  if( gDegreeTenth > 99 )
+  {
+    gDegreeTenth = 17;
+  }
 
-  tft_LoadRefresh( 1000, ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, load, ldTenth );
-  tft_LoadDotRefresh( 1000, ILI9340_YELLOW, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK);
+  if( gLoad > 3 )
+  {
+    gLoad = 0;
+  }
 
-  tft_IPRefresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, 192, 168, 1, 23 );
-  tft_IPDot1Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_IPDot2Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
-  tft_IPDot3Refresh( 1000, ILI9340_WHITE, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK );
+  if( gLoadTenth > 99 )
+  {
+    gLoadTenth = 17;
+  }
 
-  tft_FreeMemRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, freemem );
+  if( gFreemem > 1342 )
+  {
+    gFreemem = 1234;
+  }
 
-  tft_FreeSDRefresh( 1000, ILI9340_GREEN, ILI9340_BLACK, ILI9340_WHITE, ILI9340_BLACK, freesd );
+  if( gFreesd > 13547 )
+  {
+    gFreesd = 13490;
+  }
+}
+//
+// ************
+//
+void dummyNextSecond( void *arg )
+{
+  gSecond++;
 
-  delay(10);
+  if( gSecond > 60 )
+  {
+    gSecond = 0;
+  }
+}
+//
+// ************
+//
+void loop(void) 
+{
+  Tasks.Run();
 
+  Tasks.Idle(LOOP_MAX_IDLE);
 }
 
 
@@ -36,6 +36,8 @@
 //         Join an existing WLAN, start a webserver, read temperature
 //         from a DS18B20 and show it on a "local webpage" ...
 // update:
+// 12/30/16: sensor table in EEPROM, loaded to serMappingTable at boot
+// 01/01/17: sensors are mapped to feeds on the /sensors page
 //
 // -----------------------------------------------------------------------
 //
@@ -151,6 +153,7 @@
 #include <ESP8266HTTPClient.h>
 #endif // USE_WIFICLIENT
 
+#include <limits.h>
 #include <ArduinoJson.h>
 #include <EEPROM.h>
 
@@ -177,6 +180,8 @@
 //
 // -------------------- EEPROM related stuff -----------------------------
 #define EEPROM_MAGIC_BYTE           0xEA
+#define EEPROM_RECORD_VALID         0xA6  // validation flag of a table record,
+                                          // the same as in Step5
 #define LEN_TRAILING_LENGTH            2  // means two byte representing 
                                           // the real length of the data field
 //
@@ -210,7 +215,7 @@
 // ----- data for DS18B20 table -----
 //
 #define LEN_DS18B20_ID_MAX            16
-#define LEN_DS18B20_FEEDER_ID_MAX      2
+#define LEN_DS18B20_FEEDER_ID_MAX     10  // digits of an int
 #define LEN_DS18B20_NAME_MAX          30
 #define LEN_DS18B20_NUM_ENTRIES        2
 #define LEN_DS18B20_VAL_FLAG           1
@@ -263,7 +268,7 @@
 //
 // ----- table of DS18B20 sensors -----
 //
-#define MAX_DS19B20_ENTRIES           10
+#define MAX_DS18B20_ENTRIES           10
 //
 #define DATA_POS_DS18B20_TBL_BEGIN (DATA_POS_SHC_FEED_FMT + DATA_LEN_SHC_FEED_FMT)
 //
@@ -276,15 +281,25 @@
 #define DATA_LEN_SENSOR_FEEDER_ID  (LEN_TRAILING_LENGTH + LEN_DS18B20_FEEDER_ID_MAX)
 #define DATA_LEN_SENSOR_NAME       (LEN_TRAILING_LENGTH + LEN_DS18B20_NAME_MAX)
 //
+// fields within a record
+#define REC_POS_VALIDATION_FLAG    0
+#define REC_POS_SENSOR_ID          (REC_POS_VALIDATION_FLAG + DATA_LEN_VALIDATION_FLAG)
+#define REC_POS_SENSOR_FEEDER_ID   (REC_POS_SENSOR_ID + DATA_LEN_SENSOR_ID)
+#define REC_POS_SENSOR_NAME        (REC_POS_SENSOR_FEEDER_ID + DATA_LEN_SENSOR_FEEDER_ID)
+//
 #define LEN_DS18B20_SENSOR_RECORD  (DATA_LEN_VALIDATION_FLAG + DATA_LEN_SENSOR_ID + DATA_LEN_SENSOR_FEEDER_ID + DATA_LEN_SENSOR_NAME)
 //
-#define LEN_DS18B20_TABLE_SIZE     ((LEN_DS18B20_SENSOR_RECORD * MAX_DS19B20_ENTRIES) + DATA_LEN_NUM_TBL_ENTRIES)
+#define LEN_DS18B20_TABLE_SIZE     ((LEN_DS18B20_SENSOR_RECORD * MAX_DS18B20_ENTRIES) + DATA_LEN_NUM_TBL_ENTRIES)
 //
 #define DATA_POS_DS18B20_TBL_END   (DATA_POS_DS18B20_TBL_BEGIN + LEN_DS18B20_TABLE_SIZE)
 //
 // ---- special marker to make life easier
 #define DATA_ENDPOS_EEPROM             DATA_POS_DS18B20_TBL_END
 
+#if DATA_ENDPOS_EEPROM > EEPROM_SIZE
+#error "EEPROM layout exceeds EEPROM_SIZE"
+#endif
+
 //
 //
 // ... further EEPROM stuff here like above scheme
@@ -360,19 +375,21 @@ int serverStatusCode;
 //
 struct _ser_map {
     int feedId;
-    char serial[LEN_DS18B20_FEEDER_ID_MAX];
-    char name[LEN_DS18B20_NAME_MAX];
+    int recno;              // record in EEPROM
+    char serial[LEN_DS18B20_ID_MAX + 1];
+    char name[LEN_DS18B20_NAME_MAX + 1];
 };
 
 //
-struct _ser_map serMappingTable[MAX_DS19B20_ENTRIES];
+struct _ser_map serMappingTable[MAX_DS18B20_ENTRIES];
+int serMappingCount;
 //
 
 int serToFeederId( char* feeder )
 {
     int i, found;
 
-    for( i = found = 0; found == 0 && serMappingTable[i].serial != NULL; i++ )
+    for( i = found = 0; found == 0 && i < serMappingCount; i++ )
     {
         if( feeder != NULL )
         {
@@ -700,64 +717,281 @@ bool eeStoreSettings( void )
   return( eeValidate() );
 }
 //
+// ************************************************************************
+// table of DS18B20 sensors in EEPROM. The records have a fixed size,
+// the position of a field is computed from the record number. A
+// record is written on its own, the others are not touched.
+// ************************************************************************
+//
+//
 // calculate position in EEPROM of record with given number
 //
 int eeRecordOffset( int recno )
 {
   int retVal = -1;
 
-  if( recno > 0 && recno < MAX_DS19B20_ENTRIES )
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES )
   {
-    retVal = DATA_POS_DS18B20_TBL_BEGIN;
+    retVal = DATA_POS_DS18B20_FIRST_REC;
 
     retVal += (LEN_DS18B20_SENSOR_RECORD * recno );
   }
   return( retVal );
 }
 //
+// calculate position in EEPROM of a field of a record
+//
+int eeRecordFieldOffset( int recno, int fieldPos )
+{
+  int retVal = eeRecordOffset( recno );
+
+  if( retVal >= 0 )
+  {
+    retVal += fieldPos;
+  }
+  return( retVal );
+}
+//
 // calculate position in EEPROM of validation flag of a record
 //
 int eeValidationFlagOffset( int recno )
 {
-  int retVal = -1;
+  return( eeRecordFieldOffset( recno, REC_POS_VALIDATION_FLAG ) );
+}
+//
+// calculate position in EEPROM of sensor id of a record
+//
+int eeSensorIdOffset( int recno )
+{
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_ID ) );
+}
+//
+// calculate position in EEPROM of feeder id of a record
+//
+int eeFeederIdOffset( int recno )
+{
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_FEEDER_ID ) );
+}
+//
+// calculate position in EEPROM of name of a sensor
+//
+int eeSensorNameOffset( int recno )
+{
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_NAME ) );
+}
+//
+// number of records in use, records behind are not read
+//
+int eeRestoreTableEntries( void )
+{
+  short entries = 0;
+
+  eeRestoreFieldLength( (char*) &entries, DATA_POS_DS18B20_TBL_BEGIN );
+
+  return( entries > 0 && entries <= MAX_DS18B20_ENTRIES ? entries : 0 );
+}
+//
+// restore a record, returns false for a free record
+//
+bool eeRestoreSensorRecord( int recno, String& sensorId, String& feederId, String& name )
+{
+  bool retVal = false;
+
+  sensorId = feederId = name = "";
 
-// DATA_LEN_VALIDATION_FLAG
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES &&
+      EEPROM.read( eeValidationFlagOffset(recno) ) == EEPROM_RECORD_VALID )
+  {
+    eeRestoreString( sensorId, eeSensorIdOffset(recno), LEN_DS18B20_ID_MAX );
+    eeRestoreString( feederId, eeFeederIdOffset(recno), LEN_DS18B20_FEEDER_ID_MAX );
+    eeRestoreString( name, eeSensorNameOffset(recno), LEN_DS18B20_NAME_MAX );
+    retVal = true;
+  }
 
   return( retVal );
 }
 //
-// calculate position in EEPROM of sensor id of a record
+// store a single record
 //
-int eeSensorIdOffset( int recno )
+bool eeStoreSensorRecord( int recno, String sensorId, String feederId, String name )
 {
-  int retVal = -1;
+  bool retVal = false;
+  short entries;
+
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES &&
+      sensorId.length() <= LEN_DS18B20_ID_MAX &&
+      feederId.length() <= LEN_DS18B20_FEEDER_ID_MAX &&
+      name.length() <= LEN_DS18B20_NAME_MAX )
+  {
+    EEPROM.write( eeValidationFlagOffset(recno), EEPROM_RECORD_VALID );
+    eeStoreString( sensorId, eeSensorIdOffset(recno) );
+    eeStoreString( feederId, eeFeederIdOffset(recno) );
+    eeStoreString( name, eeSensorNameOffset(recno) );
+
+    if( recno >= eeRestoreTableEntries() )
+    {
+      entries = recno + 1;
+      eeStoreFieldLength( (char*) &entries, DATA_POS_DS18B20_TBL_BEGIN );
+    }
 
-// DATA_LEN_SENSOR_ID
+    retVal = eeValidate();
+  }
 
   return( retVal );
 }
 //
-// calculate position in EEPROM of feeder id of a record
+// mark a record as free
 //
-int eeFeederIdOffset( int recno )
+bool eeClearSensorRecord( int recno )
+{
+  bool retVal = false;
+
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES )
+  {
+    EEPROM.write( eeValidationFlagOffset(recno), '\0' );
+    retVal = eeValidate();
+  }
+
+  return( retVal );
+}
+#ifdef USE_DS18B20
+//
+// a feeder id is a positive int given in decimal, 0 for anything else
+//
+int serParseFeederId( String feederId )
+{
+  unsigned long long value = 0;
+  bool valid = feederId.length() > 0 &&
+               feederId.length() <= LEN_DS18B20_FEEDER_ID_MAX;
+  int retVal = 0;
+
+  for( unsigned int i = 0; valid && i < feederId.length(); i++ )
+  {
+    valid = isdigit( feederId[i] );
+    value = value * 10 + (feederId[i] - '0');
+  }
+
+  if( valid && value > 0 && value <= INT_MAX )
+  {
+    retVal = (int) value;
+  }
+
+  return( retVal );
+}
+//
+// set an entry of serMappingTable
+//
+void serMapSet( int idx, int feedId, String sensorId, String name, int recno )
+{
+  serMappingTable[idx].feedId = feedId;
+  serMappingTable[idx].recno = recno;
+  strncpy( serMappingTable[idx].serial, sensorId.c_str(), LEN_DS18B20_ID_MAX );
+  serMappingTable[idx].serial[LEN_DS18B20_ID_MAX] = '\0';
+  strncpy( serMappingTable[idx].name, name.c_str(), LEN_DS18B20_NAME_MAX );
+  serMappingTable[idx].name[LEN_DS18B20_NAME_MAX] = '\0';
+}
+//
+// entry of a sensor in serMappingTable, -1 if not mapped
+//
+int serMapIndex( String sensorId )
 {
   int retVal = -1;
 
-// DATA_LEN_SENSOR_FEEDER_ID
+  for( int i = 0; retVal < 0 && i < serMappingCount; i++ )
+  {
+    if( strcmp( sensorId.c_str(), serMappingTable[i].serial ) == 0 )
+    {
+      retVal = i;
+    }
+  }
 
   return( retVal );
 }
 //
-// calculate position in EEPROM of name of a sensor
+// first record in EEPROM not used by a mapping, -1 if the table is full
 //
-int eeSensorNameOffset( int recno )
+int serMapFreeRecord( void )
 {
   int retVal = -1;
+  bool used = true;
+
+  for( int recno = 0; used && recno < MAX_DS18B20_ENTRIES; recno++ )
+  {
+    used = false;
+
+    for( int i = 0; !used && i < serMappingCount; i++ )
+    {
+      used = serMappingTable[i].recno == recno;
+    }
+
+    if( !used )
+    {
+      retVal = recno;
+    }
+  }
+
+  return( retVal );
+}
+//
+// load the sensor table to serMappingTable in one pass
+//
+int serMapLoad( void )
+{
+  String sensorId, feederId, name;
+  int entries = eeRestoreTableEntries();
+
+  serMappingCount = 0;
+
+  for( int recno = 0; recno < entries; recno++ )
+  {
+    if( eeRestoreSensorRecord( recno, sensorId, feederId, name ) &&
+        serParseFeederId( feederId ) > 0 )
+    {
+      serMapSet( serMappingCount++, serParseFeederId( feederId ),
+                 sensorId, name, recno );
+    }
+  }
+
+  return( serMappingCount );
+}
+//
+// map a sensor to a feed and store the mapping in its record. An
+// empty feeder id removes the mapping.
+//
+bool serMapStore( String sensorId, String feederId, String name )
+{
+  int idx = serMapIndex( sensorId );
+  int recno = idx >= 0 ? serMappingTable[idx].recno : serMapFreeRecord();
+  bool retVal = false;
 
-// DATA_LEN_SENSOR_NAME
+  if( feederId.length() == 0 )
+  {
+    if( idx >= 0 )
+    {
+      retVal = eeClearSensorRecord( recno );
+      serMappingCount--;
+      memmove( &serMappingTable[idx], &serMappingTable[idx + 1],
+               (serMappingCount - idx) * sizeof(serMappingTable[0]) );
+    }
+    else
+    {
+      retVal = true;
+    }
+  }
+  else if( recno >= 0 && serParseFeederId( feederId ) > 0 &&
+           eeStoreSensorRecord( recno, sensorId, feederId, name ) )
+  {
+    if( idx < 0 )
+    {
+      idx = serMappingCount++;
+    }
+    serMapSet( idx, serParseFeederId( feederId ), sensorId, name, recno );
+    retVal = true;
+  }
 
   return( retVal );
 }
+#endif // USE_DS18B20
 
 //
 // ************************************************************************
@@ -940,6 +1174,10 @@ void setup()
     Serial.println("eeprom content is valid");
     eeRestoreString( n_ssid, DATA_POS_SSID, LEN_SSID_MAX );
     eeRestoreString( n_password, DATA_POS_PASSWORD, LEN_PASSWORD_MAX );
+#ifdef USE_DS18B20
+    Serial.print("sensors in table: ");
+    Serial.println(serMapLoad());
+#endif // USE_DS18B20
   }
   else
   {
@@ -1000,6 +1238,9 @@ void setup()
 
   server.on("/", handleIndexPage);
   server.on("/admin", handleAdminPage);
+#ifdef USE_DS18B20
+  server.on("/sensors", handleSensorPage);
+#endif // USE_DS18B20
 #ifdef USE_WEBAPI_EMONCMS
   server.on("/emoncms", feed2EMONCMS);
 #endif // USE_WEBAPI_EMONCMS
@@ -1323,6 +1564,115 @@ void handleAdminPage()
   }
 }
 
+#ifdef USE_DS18B20
+//
+// ROM code of a sensor as shown on the page and kept in the table
+//
+String addrToHex( const uint8_t *addr )
+{
+  char val[2 * sizeof(DeviceAddress) + 1];
+
+  for( int x = 0; x < sizeof(DeviceAddress); x++ )
+  {
+    sprintf(&val[2 * x], "%02X", addr[x]);
+  }
+  return( String(val) );
+}
+//
+// handle /sensors page, maps the sensors on the bus to feeds
+//
+void handleSensorPage()
+{
+  DeviceAddress addr;
+  String n_sensorId = "";
+  String n_feederId = "";
+  String n_sensorName = "";
+  int idx;
+  int failed = 0;
+
+  Serial.println("Sensor page");
+
+  if( server.method() == SERVER_METHOD_GET )
+  {
+    pageContent = "<!DOCTYPE HTML>\r\n";
+    pageContent += "<html></p>";
+    pageContent +=   "<form method='post' action='sensors'>";
+
+    for( int i = 0; i < DS18B20.getDeviceCount(); i++ )
+    {
+      if( DS18B20.getAddress(addr, i) )
+      {
+        n_sensorId = addrToHex( addr );
+
+        if( (idx = serMapIndex( n_sensorId )) >= 0 )
+        {
+          n_feederId = String(serMappingTable[idx].feedId);
+          n_sensorName = serMappingTable[idx].name;
+        }
+        else
+        {
+          n_feederId = "";
+          n_sensorName = "";
+        }
+//
+        pageContent +=     "<br>";
+        pageContent +=     "<label>Id: " + n_sensorId + "</label>";
+        pageContent +=     "<br>";
+        pageContent +=     "<label>Feeder-Id: </label>";
+        pageContent +=      "<input name='feederId_" + n_sensorId +
+                             "' value='" + n_feederId + "' length=" +
+                             String(LEN_DS18B20_FEEDER_ID_MAX) + "> (max. " +
+                             String(LEN_DS18B20_FEEDER_ID_MAX) + " chars)";
+        pageContent +=     "<label>Name: </label>";
+        pageContent +=      "<input name='name_" + n_sensorId +
+                             "' value='" + n_sensorName + "' length=" +
+                             String(LEN_DS18B20_NAME_MAX) + "> (max. " +
+                             String(LEN_DS18B20_NAME_MAX) + " chars)";
+      }
+    }
+
+    pageContent +=      "<br>";
+    pageContent +=      "<input type='submit'>";
+    pageContent +=   "</form>";
+    pageContent += "</html>";
+    server.send(200, "text/html", pageContent);
+  }
+  else
+  {
+    if( server.method() == SERVER_METHOD_POST )
+    {
+      for( int i = 0; i < DS18B20.getDeviceCount(); i++ )
+      {
+        if( DS18B20.getAddress(addr, i) )
+        {
+          n_sensorId = addrToHex( addr );
+
+          if( server.hasArg("feederId_" + n_sensorId) &&
+              !serMapStore( n_sensorId, server.arg("feederId_" + n_sensorId),
+                            server.arg("name_" + n_sensorId) ) )
+          {
+            failed++;
+          }
+        }
+      }
+
+      pageContent = "<!DOCTYPE HTML>\r\n";
+      pageContent += "<html></p>";
+      if( failed == 0 )
+      {
+        pageContent += "<br>Settings stored<br>";
+      }
+      else
+      {
+        pageContent += "<br>" + String(failed) + " sensor(s) not stored, invalid feeder id or name!<br>";
+      }
+      pageContent += "</html>";
+      server.send(200, "text/html", pageContent);
+    }
+  }
+}
+#endif // USE_DS18B20
+
 //
 // handle / page containing the actual temperature
 //
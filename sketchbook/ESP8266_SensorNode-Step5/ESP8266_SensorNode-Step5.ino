@@ -36,6 +36,25 @@
 //         Join an existing WLAN, start a webserver, read temperature
 //         from a DS18B20 and show it on a "local webpage" ...
 // update:
+// 12/30/16: sensors are read by tasks of the SimpleTask scheduler
+//           DS18B20 conversion does not block, sensors are read by
+//           ROM code, resolution per sensor
+//           sensors are mapped to feeds by their ROM code
+//           sensor table in EEPROM, mapping is stored on /sensors
+//           values are sent in batches to the EMONCMS bulk input API
+//           samples are queued and spooled to SD while EMONCMS is down
+//           upload runs in the background, the web pages show its state
+// 12/31/16: samples go to data sinks (dataSink.h), EMONCMS, SHC, MQTT
+//           and InfluxDB at once, each with its own rate and retries
+// 01/01/17: SHC settings have their own place in the EEPROM
+//           history of each value with min/max/mean/EWMA, downsampled
+//           by /api/history, sinks get the mean of each minute
+//           feeder ids up to 10 digits, host test of the EEPROM layout
+//           and the sensor table in tests/ (make test)
+//           a channel for each value, live ones are not replaced
+//           without SD card the sinks spool to SPIFFS
+//           EMONCMS and SHC settings are restored at boot, the admin
+//           page changes them at once, the feeder format is gone
 //
 // -----------------------------------------------------------------------
 //
@@ -77,6 +96,7 @@
 // ------------------ DS18B20 dependend macros ---------------------------
 #ifdef USE_DS18B20
 #define DS18B20_READINTVAL   5000  // read interval in ms
+#define DS18B20_RESOLUTION     12  // default, 9..12 bits (94..750 ms)
 #define ONE_WIRE_BUS            2  // pin DS18B20 is connected to
                                    // note: be careful if using GPIO0 for that
                                    //       cause of ESP boots to UPLOAD mode
@@ -122,6 +142,10 @@
 // --------------------- SHC dependend macros ----------------------------
 #ifdef USE_WEBAPI_SHC
 //
+// SHC takes the samples like the EMONCMS bulk input API
+#define SHC_NODE                       10  // node of the inputs
+#define SHC_POST_INTVAL             60000  // queue is sent each ms
+#define SHC_SPOOL_FILE       "/SHC.SPL"    // samples that did not fit
 #endif // USE_WEBAPI_SHC
 //
 // ----------- use EMONCMS to store and visualize data -------------------
@@ -131,8 +155,75 @@
 #ifdef USE_WEBAPI_EMONCMS
 //
 #define EMONCMS_FEEDERID_CUMM          26
+//
+// values are queued as samples and sent in one request to the
+// bulk input API, see emoncmsSink in dataSink.h
+#define EMONCMS_NODE                   10  // node of the inputs
+#define EMONCMS_POST_INTVAL         60000  // queue is sent each ms
+#define EMONCMS_SPOOL_FILE   "/EMONCMS.SPL"  // samples that did not fit
 
 #endif // USE_WEBAPI_EMONCMS
+//
+// -------------- use MQTT to publish data (PubSubClient) ----------------
+// #define USE_MQTT
+#undef USE_MQTT
+// -------------------- MQTT dependend macros ----------------------------
+#ifdef USE_MQTT
+//
+// each sample is published to <topic>/<input>
+#define MQTT_CLIENT_ID       "SensorNode"
+#define MQTT_POST_INTVAL             5000  // queue is sent each ms
+#define MQTT_SPOOL_FILE      "/MQTT.SPL"   // samples that did not fit
+#endif // USE_MQTT
+//
+// ---------------- use InfluxDB to store data ---------------------------
+// #define USE_INFLUXDB
+#undef USE_INFLUXDB
+// ------------------ InfluxDB dependend macros --------------------------
+#ifdef USE_INFLUXDB
+//
+#define INFLUX_NODE                    10  // tag node of the points
+#define INFLUX_MEASUREMENT   "sensor"
+#define INFLUX_POST_INTVAL          60000  // queue is sent each ms
+#define INFLUX_SPOOL_FILE    "/INFLUX.SPL" // samples that did not fit
+#endif // USE_INFLUXDB
+//
+// ---------------- data sinks (all of the above) ------------------------
+//
+// the mean of each value since the last time is queued for each sink,
+// with SINK_SEND_PEAKS min and max too as inputs <name>_min, <name>_max
+#define SINK_SAMPLE_INTVAL          60000  // values are aggregated each ms
+// #define SINK_SEND_PEAKS
+#undef SINK_SEND_PEAKS
+#define SINK_QUEUE_LEN                 64  // samples a sink keeps in RAM
+#define SINK_BACKOFF_MAX          1800000  // max. ms between retries
+#define MAX_DATA_SINKS                  4
+//
+// ----------------------- history of values -----------------------------
+//
+// each value read (a channel, e.g. a DS18B20 by its feed id) keeps
+// its last samples, see channelHistory.h. There is a channel for each
+// value of the sensors enabled above.
+#define CHANNEL_HISTORY_LEN           120  // samples kept per channel
+#define CHANNEL_HISTORY_RAM_MAX     16384  // bytes all histories may take
+#define CHANNEL_STALE_MILLIS       600000  // channel not updated may be reused
+#define CHANNEL_EWMA_ALPHA            0.1  // weight of a new value
+#ifdef USE_DS18B20
+#define CHANNELS_DS18B20      MAX_DS18B20_ENTRIES
+#else
+#define CHANNELS_DS18B20                0
+#endif // USE_DS18B20
+#ifdef USE_DHT
+#define CHANNELS_DHT                    2  // temperature, humidity
+#else
+#define CHANNELS_DHT                    0
+#endif // USE_DHT
+#ifdef USE_BMP085
+#define CHANNELS_BMP085                 2  // temperature, pressure
+#else
+#define CHANNELS_BMP085                 0
+#endif // USE_BMP085
+#define MAX_CHANNELS                    (CHANNELS_DS18B20 + CHANNELS_DHT + CHANNELS_BMP085)
 
 //
 // ************************************************************************
@@ -144,8 +235,17 @@
 #define USE_WWWSERVER
 //  port for the webserver
 #define WWW_LISTENPORT         80
+//  time server, samples are stamped with the time from there
+#define NTP_SERVER             "pool.ntp.org"
+#define TIME_VALID_MIN         1451606400UL  // 01/01/16, time is set
 //  support for SD cards
 #define SD_SUPPORT
+//  max. msecs loop() waits for the next task (see SimpleTask)
+#define LOOP_MAX_IDLE         10
+//  let the ESP light-sleep while it waits. Requests to the webserver
+//  are answered with the delay of the DTIM interval of the access point
+// #define USE_LIGHT_SLEEP
+#undef USE_LIGHT_SLEEP
 //
 // ************************************************************************
 // set pin that is used as CS for sd ard reader
@@ -156,7 +256,7 @@
 #undef SD_SUPPORT
 #else
 #ifdef SD_SUPPORT
-##define SERVER_ROOT          "/WWWROOT"
+#define SERVER_ROOT          "/WWWROOT"
 #define CHECKSUM_FILE       "CRCDEF.TXT"
 #define SPI_CHIPSEL                    2
 #endif // SD_SUPPORT
@@ -176,15 +276,21 @@
 
 #ifdef USE_WIFICLIENT
 // #include <WiFiClient.h>
-#include <ESP8266HTTPClient.h>
+#include <time.h>
 #endif // USE_WIFICLIENT
 
+#include <limits.h>
 #include <ArduinoJson.h>
 #include <EEPROM.h>
+// sensor tasks, sampling and a task per data sink
+#define SIMPLE_TASK_MAX_TASKS         12
+#include <SimpleTask.h>
 
 #ifdef SD_SUPPORT
 #include <SPI.h>
 #include <SD.h>
+#else
+#include <FS.h>
 #endif // SD_SUPPORT
 
 #ifdef USE_DS18B20
@@ -201,6 +307,9 @@
 #include <Adafruit_BMP085.h>
 #endif // USE_BMP085
 
+#include "dataSink.h"
+#include "channelHistory.h"
+
 //
 // ************************************************************************
 // define some default values
@@ -211,6 +320,8 @@
 //
 // -------------------- EEPROM related stuff -----------------------------
 #define EEPROM_MAGIC_BYTE           0xEA
+#define EEPROM_RECORD_VALID         0xA6  // validation flag of a table record,
+                                          // changes with the record layout
 #define LEN_TRAILING_LENGTH            2  // means two byte representing 
                                           // the real length of the data field
 //
@@ -231,10 +342,11 @@
 #define LEN_EMONCMS_READAPI_KEY_MAX   32  // max. length of a emoncms key
 #define LEN_EMONCMS_WRITEAPI_KEY_MAX  32  // max. length of a emoncms key
 #define LEN_EMONCMS_HOST_MAX          80  // max. length for the emoncms host
-#define LEN_EMONCMS_PORT_MAX           2  // max. length for the emoncms port
+#define LEN_EMONCMS_PORT_MAX           5  // max. length for the emoncms port
 #define LEN_EMONCMS_URL_MAX           80  // max. length for the emoncms url
-#define LEN_EMONCMS_FEED_FMT_MAX      80  // max. length for the formatter
+#define LEN_EMONCMS_FEED_FMT_MAX      80  // no longer used, keeps the layout
 #define LEN_EMONCMS_FEED_URLBUF_MAX  160  // max. length for the feeder url
+#define LEN_EMONCMS_BATCH_MAX       1536  // max. length of a bulk request
 
 //
 // ----- data to access SHC -----
@@ -242,19 +354,25 @@
 #define LEN_SHC_READAPI_KEY_MAX       32  // max. length of a SHC key
 #define LEN_SHC_WRITEAPI_KEY_MAX      32  // max. length of a SHC key
 #define LEN_SHC_HOST_MAX              80  // max. length for the SHC host
-#define LEN_SHC_PORT_MAX               2  // max. length for the SHC port
+#define LEN_SHC_PORT_MAX               5  // max. length for the SHC port
 #define LEN_SHC_URL_MAX               80  // max. length for the SHC url
-#define LEN_SHC_FEED_FMT_MAX          80  // max. length for the formatter
+#define LEN_SHC_FEED_FMT_MAX          80  // no longer used, keeps the layout
 #define LEN_SHC_FEED_URLBUF_MAX      160  // max. length for the feeder url
+#define LEN_SHC_BATCH_MAX           1536  // max. length of a bulk request
+//
+// ----- data to access InfluxDB -----
+//
+#define LEN_INFLUX_BATCH_MAX        1024  // max. length of a write request
 
 //
 // ----- data for DS18B20 table -----
 //
 #define LEN_DS18B20_ID_MAX            16
-#define LEN_DS18B20_FEEDER_ID_MAX      2
+#define LEN_DS18B20_FEEDER_ID_MAX     10  // digits of an int
 #define LEN_DS18B20_NAME_MAX          30
 #define LEN_DS18B20_NUM_ENTRIES        2
 #define LEN_DS18B20_VAL_FLAG           1
+#define LEN_DS18B20_RESOLUTION         1  // bits, 9..12
 
 //
 // ----------------------- EEPROM layout ---------------------------------
@@ -300,7 +418,7 @@
 //
 // ----- data to access SHC -----
 //
-#define DATA_POS_SHC_READAPI_KEY   (DATA_POS_PASSWORD + DATA_LEN_PASSWORD)
+#define DATA_POS_SHC_READAPI_KEY   (DATA_POS_EMONCMS_FEED_FMT + DATA_LEN_EMONCMS_FEED_FMT)
 #define DATA_LEN_SHC_READAPI_KEY   (LEN_TRAILING_LENGTH + LEN_SHC_READAPI_KEY_MAX)
 #define DATA_POS_SHC_WRITEAPI_KEY  (DATA_POS_SHC_READAPI_KEY + DATA_LEN_SHC_READAPI_KEY)
 #define DATA_LEN_SHC_WRITEAPI_KEY  (LEN_TRAILING_LENGTH + LEN_SHC_WRITEAPI_KEY_MAX)
@@ -327,8 +445,16 @@
 #define DATA_LEN_SENSOR_ID         (LEN_TRAILING_LENGTH + LEN_DS18B20_ID_MAX)
 #define DATA_LEN_SENSOR_FEEDER_ID  (LEN_TRAILING_LENGTH + LEN_DS18B20_FEEDER_ID_MAX)
 #define DATA_LEN_SENSOR_NAME       (LEN_TRAILING_LENGTH + LEN_DS18B20_NAME_MAX)
+#define DATA_LEN_SENSOR_RESOLUTION LEN_DS18B20_RESOLUTION
+//
+// fields within a record
+#define REC_POS_VALIDATION_FLAG    0
+#define REC_POS_SENSOR_ID          (REC_POS_VALIDATION_FLAG + DATA_LEN_VALIDATION_FLAG)
+#define REC_POS_SENSOR_FEEDER_ID   (REC_POS_SENSOR_ID + DATA_LEN_SENSOR_ID)
+#define REC_POS_SENSOR_NAME        (REC_POS_SENSOR_FEEDER_ID + DATA_LEN_SENSOR_FEEDER_ID)
+#define REC_POS_SENSOR_RESOLUTION  (REC_POS_SENSOR_NAME + DATA_LEN_SENSOR_NAME)
 //
-#define LEN_DS18B20_SENSOR_RECORD  (DATA_LEN_VALIDATION_FLAG + DATA_LEN_SENSOR_ID + DATA_LEN_SENSOR_FEEDER_ID + DATA_LEN_SENSOR_NAME)
+#define LEN_DS18B20_SENSOR_RECORD  (DATA_LEN_VALIDATION_FLAG + DATA_LEN_SENSOR_ID + DATA_LEN_SENSOR_FEEDER_ID + DATA_LEN_SENSOR_NAME + DATA_LEN_SENSOR_RESOLUTION)
 //
 #define LEN_DS18B20_TABLE_SIZE     ((LEN_DS18B20_SENSOR_RECORD * MAX_DS18B20_ENTRIES) + DATA_LEN_NUM_TBL_ENTRIES)
 //
@@ -337,6 +463,10 @@
 // ---- special marker to make life easier
 #define DATA_ENDPOS_EEPROM             DATA_POS_DS18B20_TBL_END
 
+#if DATA_ENDPOS_EEPROM > EEPROM_SIZE
+#error "EEPROM layout exceeds EEPROM_SIZE"
+#endif
+
 //
 //
 // ... further EEPROM stuff here like above scheme
@@ -374,8 +504,14 @@ static const PROGMEM uint32_t crc_table[16] = {
 //
 #ifdef SD_SUPPORT
 bool hasSD;
+#else
+bool hasSpiffs;           // spool files of the sinks are kept there
 #endif // SD_SUPPORT
 //
+// ------------------------- scheduler -----------------------------------
+//
+SimpleTask Tasks;
+//
 // ------------------------- WWWSERVER -----------------------------------
 //
 #ifdef USE_WWWSERVER
@@ -390,7 +526,15 @@ int serverStatusCode;
 #define SERVER_METHOD_POST              2
 
 // amount of input fields in the form
-#define ARGS_ADMIN_PAGE                 6
+#define ARGS_ADMIN_PAGE_WLAN            2
+#define ARGS_ADMIN_PAGE_WEBAPI          5  // per web API
+#if defined( USE_WEBAPI_EMONCMS ) && defined( USE_WEBAPI_SHC )
+#define ARGS_ADMIN_PAGE                 (ARGS_ADMIN_PAGE_WLAN + 2 * ARGS_ADMIN_PAGE_WEBAPI)
+#elif defined( USE_WEBAPI_EMONCMS ) || defined( USE_WEBAPI_SHC )
+#define ARGS_ADMIN_PAGE                 (ARGS_ADMIN_PAGE_WLAN + ARGS_ADMIN_PAGE_WEBAPI)
+#else
+#define ARGS_ADMIN_PAGE                 ARGS_ADMIN_PAGE_WLAN
+#endif
 
 // names of the input fields for emoncms
 #define FORM_DATAFIELD_NAME_SSID        "ssid"
@@ -400,7 +544,6 @@ int serverStatusCode;
 #define FORM_DATAFIELD_NAME_EMON_HOST   "emonhost"
 #define FORM_DATAFIELD_NAME_EMON_PORT   "emonport"
 #define FORM_DATAFIELD_NAME_EMON_URL    "emonurl"
-#define FORM_DATAFIELD_NAME_EMON_FORMAT "emonfmt"
 
 // names of the input fields for shc
 #define FORM_DATAFIELD_NAME_SSID        "ssid"
@@ -410,39 +553,201 @@ int serverStatusCode;
 #define FORM_DATAFIELD_NAME_SHC_HOST   "shchost"
 #define FORM_DATAFIELD_NAME_SHC_PORT   "shcport"
 #define FORM_DATAFIELD_NAME_SHC_URL    "shcurl"
-#define FORM_DATAFIELD_NAME_SHC_FORMAT "shcfmt"
 
 #endif // USE_WWWSERVER
 //
 // -------------------------- DS18B20 ------------------------------------
 //
 #ifdef USE_DS18B20
+// mapping of sensors to feeds. Built once at boot from the sensor
+// table in EEPROM and kept sorted by the ROM code, so a sensor is
+// found by a binary search on the raw 64 bit code. Hex strings are
+// made for the web pages only.
 //
 struct _ser_map {
-    int feedId;
-    char serial[LEN_DS18B20_FEEDER_ID_MAX];
-    char name[LEN_DS18B20_NAME_MAX];
+    uint64_t rom;           // ROM code, family code most significant
+    int feedId;             // 0 if the record holds the resolution only
+    int recno;              // record in EEPROM
+    uint8_t resolution;
+    char name[LEN_DS18B20_NAME_MAX + 1];
 };
 
 //
 struct _ser_map serMappingTable[MAX_DS18B20_ENTRIES];
+int serMappingCount;
+//
+// ROM code as key, in the order the bytes are shown
+//
+uint64_t romToKey( const uint8_t *addr )
+{
+    uint64_t retVal = 0;
+
+    for( int i = 0; i < 8; i++ )
+    {
+        retVal = (retVal << 8) | addr[i];
+    }
+    return( retVal );
+}
+//
+// ROM code from the 16 hex digits stored in EEPROM
+//
+bool hexToRomKey( const char *hex, uint64_t *key )
+{
+    bool retVal = strlen(hex) == 2 * 8;
+    uint64_t rom = 0;
+    char c;
+
+    for( int i = 0; retVal && i < 2 * 8; i++ )
+    {
+        c = toupper(hex[i]);
+
+        if( c >= '0' && c <= '9' )
+        {
+            rom = (rom << 4) | (c - '0');
+        }
+        else if( c >= 'A' && c <= 'F' )
+        {
+            rom = (rom << 4) | (c - 'A' + 10);
+        }
+        else
+        {
+            retVal = false;
+        }
+    }
+
+    if( retVal )
+    {
+        *key = rom;
+    }
+    return( retVal );
+}
+//
+// index of the entry for rom resp. of the place to insert it
+//
+int serMapSearch( uint64_t rom, bool *found )
+{
+    int lo = 0;
+    int hi = serMappingCount;
+    int mid;
+
+    *found = false;
+
+    while( !*found && lo < hi )
+    {
+        mid = (lo + hi) / 2;
+
+        if( serMappingTable[mid].rom < rom )
+        {
+            lo = mid + 1;
+        }
+        else if( serMappingTable[mid].rom > rom )
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid;
+            *found = true;
+        }
+    }
+    return( lo );
+}
 //
+// add resp. replace the mapping of a sensor
+//
+bool serMapSet( uint64_t rom, int feedId, const char *name, int recno, uint8_t resolution )
+{
+    bool found;
+    bool retVal = true;
+    int pos = serMapSearch( rom, &found );
+
+    if( !found )
+    {
+        if( serMappingCount < MAX_DS18B20_ENTRIES )
+        {
+            memmove(&serMappingTable[pos + 1], &serMappingTable[pos],
+                    (serMappingCount - pos) * sizeof(serMappingTable[0]));
+            serMappingCount++;
+        }
+        else
+        {
+            retVal = false;
+        }
+    }
+
+    if( retVal )
+    {
+        serMappingTable[pos].rom = rom;
+        serMappingTable[pos].feedId = feedId;
+        serMappingTable[pos].recno = recno;
+        serMappingTable[pos].resolution = resolution;
+        strncpy(serMappingTable[pos].name, name, LEN_DS18B20_NAME_MAX);
+        serMappingTable[pos].name[LEN_DS18B20_NAME_MAX] = '\0';
+    }
+    return( retVal );
+}
+//
+// remove the mapping of a sensor
+//
+void serMapRemove( struct _ser_map *entry )
+{
+    int pos = entry - serMappingTable;
 
-int serToFeederId( char* feeder )
+    memmove(&serMappingTable[pos], &serMappingTable[pos + 1],
+            (serMappingCount - pos - 1) * sizeof(serMappingTable[0]));
+    serMappingCount--;
+}
+//
+// first record in EEPROM not used by a mapping, -1 if the table is full
+//
+int serMapFreeRecord( void )
 {
-    int i, found;
+    int retVal = -1;
+    bool used = true;
 
-    for( i = found = 0; found == 0 && serMappingTable[i].serial != NULL; i++ )
+    for( int recno = 0; used && recno < MAX_DS18B20_ENTRIES; recno++ )
     {
-        if( feeder != NULL )
+        used = false;
+
+        for( int i = 0; !used && i < serMappingCount; i++ )
+        {
+            used = serMappingTable[i].recno == recno;
+        }
+
+        if( !used )
         {
-            if(strcmp(feeder, serMappingTable[i].serial) == 0 )
-            {
-                found = serMappingTable[i].feedId;
-            }
+            retVal = recno;
         }
     }
-    return(found);
+    return( retVal );
+}
+//
+// mapping of a sensor, NULL if there is none
+//
+struct _ser_map *serMapFind( const uint8_t *addr )
+{
+    bool found;
+    int pos = serMapSearch( romToKey(addr), &found );
+
+    return( found ? &serMappingTable[pos] : NULL );
+}
+//
+// feed of a sensor, 0 if it is not mapped
+//
+int serToFeederId( const uint8_t *addr )
+{
+    struct _ser_map *entry = serMapFind( addr );
+
+    return( entry != NULL ? entry->feedId : 0 );
+}
+//
+// resolution stored for a sensor, the default for a sensor without record
+//
+uint8_t serToResolution( const uint8_t *addr )
+{
+    struct _ser_map *entry = serMapFind( addr );
+
+    return( entry != NULL ? entry->resolution : DS18B20_RESOLUTION );
 }
 
   // Initialize 1wire bus
@@ -450,16 +755,29 @@ OneWire oneWire(ONE_WIRE_BUS);
   // create DS18B20 object on the bus
 DallasTemperature DS18B20(&oneWire);
 
-  // temperature - phase 1, one DS18B20 only
-  // will go to a structure/array in one of the next steps
-float ds18b20Temp;
+  // sensors found on the bus. The bus is searched once, afterwards
+  // each sensor is addressed by its ROM code. A conversion is started
+  // for all sensors together, the scratchpads are read one per task
+  // run when the slowest sensor is ready.
+struct _ds18b20_sensor {
+    DeviceAddress addr;
+    int feedId;             // from serMappingTable, 0 if not mapped
+    uint8_t resolution;
+    float tempC;
+    bool valid;
+};
+
+struct _ds18b20_sensor ds18b20Sensors[MAX_DS18B20_ENTRIES];
+int ds18b20Count;
+int ds18b20Next;          // sensor read next
+bool ds18b20Busy;         // conversion resp. reading in progress
+bool ds18b20Rescan;       // search the bus again before the next conversion
 
 #endif // USE_DS18B20
 //
 // ------------------------ DHT11/DHT22 ----------------------------------
 //
 #ifdef USE_DHT
-float dhtHumidity, dhtTemp;    // Values read from sensor
 
 // Initialize DHT sensor 
 // NOTE: For working with a faster than ATmega328p 16 MHz Arduino chip, like an ESP8266,
@@ -489,7 +807,6 @@ String emoncmsWriteApiKey = "2a580c6225c0c3366dfbb17490554bb6";
 String emoncmsHost = "192.168.1.121";
 String emoncmsPort = "80";
 String emoncmsUrl = "/emoncms/feed/";
-String emoncmsFeedFmt = "insert.json?apikey=%s&id=%d&value=%s";
 
 #else // not defined USE_WEBAPI_EMONCMS
   // set variables to empty string to avoid errors when storing values to EEPROM
@@ -498,7 +815,6 @@ String emoncmsWriteApiKey = "";
 String emoncmsHost = "";
 String emoncmsPort = "";
 String emoncmsUrl = "";
-String emoncmsFeedFmt = "";
 //
 #endif // USE_WEBAPI_EMONCMS
 //
@@ -511,7 +827,6 @@ String shcWriteApiKey = "2a580c6225c0c3366dfbb17490554bb6";
 String shcHost = "192.168.1.121";
 String shcPort = "80";
 String shcUrl = "/emoncms/feed/";
-String shcFeedFmt = "insert.json?apikey=%s&id=%d&value=%s";
 
 #else // not defined USE_WEBAPI_SHC
   // set variables to empty string to avoid errors when storing values to EEPROM
@@ -520,10 +835,89 @@ String shcWriteApiKey = "";
 String shcHost = "";
 String shcPort = "";
 String shcUrl = "";
-String shcFeedFmt = "";
 //
 #endif // USE_WEBAPI_SHC
 //
+// ---------------------------- MQTT -------------------------------------
+//
+#ifdef USE_MQTT
+//
+String mqttHost = "192.168.1.121";
+String mqttPort = "1883";
+String mqttTopic = "sensornode/10";
+//
+#endif // USE_MQTT
+//
+// -------------------------- InfluxDB -----------------------------------
+//
+#ifdef USE_INFLUXDB
+//
+String influxHost = "192.168.1.121";
+String influxPort = "8086";
+String influxDatabase = "sensors";
+//
+#endif // USE_INFLUXDB
+//
+// ------------------------- data sinks ----------------------------------
+//
+// each sink has its own queue and keeps the settings above by reference.
+// They are restored from the EEPROM at boot, the admin page changes them
+// and closes a kept connection, the next batch goes to the new server
+//
+#ifdef USE_WIFICLIENT
+//
+#ifdef USE_WEBAPI_EMONCMS
+dataSample emoncmsQueue[SINK_QUEUE_LEN];
+char emoncmsBatch[LEN_EMONCMS_BATCH_MAX + 1];
+emoncmsSink emoncmsSender("EMONCMS", emoncmsQueue, SINK_QUEUE_LEN,
+                          EMONCMS_POST_INTVAL, SINK_BACKOFF_MAX,
+                          emoncmsBatch, sizeof(emoncmsBatch),
+                          emoncmsHost, emoncmsPort, emoncmsUrl,
+                          emoncmsWriteApiKey, EMONCMS_NODE);
+#endif // USE_WEBAPI_EMONCMS
+
+#ifdef USE_WEBAPI_SHC
+dataSample shcQueue[SINK_QUEUE_LEN];
+char shcBatch[LEN_SHC_BATCH_MAX + 1];
+emoncmsSink shcSender("SHC", shcQueue, SINK_QUEUE_LEN,
+                      SHC_POST_INTVAL, SINK_BACKOFF_MAX,
+                      shcBatch, sizeof(shcBatch),
+                      shcHost, shcPort, shcUrl,
+                      shcWriteApiKey, SHC_NODE);
+#endif // USE_WEBAPI_SHC
+
+#ifdef USE_MQTT
+dataSample mqttQueue[SINK_QUEUE_LEN];
+mqttSink mqttSender("MQTT", mqttQueue, SINK_QUEUE_LEN,
+                    MQTT_POST_INTVAL, SINK_BACKOFF_MAX,
+                    mqttHost, mqttPort, mqttTopic, MQTT_CLIENT_ID);
+#endif // USE_MQTT
+
+#ifdef USE_INFLUXDB
+dataSample influxQueue[SINK_QUEUE_LEN];
+char influxBatch[LEN_INFLUX_BATCH_MAX + 1];
+influxSink influxSender("InfluxDB", influxQueue, SINK_QUEUE_LEN,
+                        INFLUX_POST_INTVAL, SINK_BACKOFF_MAX,
+                        influxBatch, sizeof(influxBatch),
+                        influxHost, influxPort, influxDatabase,
+                        INFLUX_MEASUREMENT, INFLUX_NODE);
+#endif // USE_INFLUXDB
+//
+#endif // USE_WIFICLIENT
+
+dataSink *dataSinks[MAX_DATA_SINKS];
+int dataSinkCount;
+//
+// ------------------------- channels ------------------------------------
+//
+// a sample takes 8 bytes (time and value)
+#if MAX_CHANNELS * CHANNEL_HISTORY_LEN * 8 > CHANNEL_HISTORY_RAM_MAX
+#error "channel histories exceed CHANNEL_HISTORY_RAM_MAX, lower CHANNEL_HISTORY_LEN"
+#endif
+
+channelHistory channels[MAX_CHANNELS];
+int channelCount;
+//
 // ------------------------ WIFICLIENT -----------------------------------
 //
 #ifdef USE_WIFICLIENT
@@ -748,19 +1142,17 @@ bool eeStoreSettings( void )
   eeStoreString( emoncmsHost, DATA_POS_EMONCMS_HOST );
   eeStoreString( emoncmsPort, DATA_POS_EMONCMS_PORT );
   eeStoreString( emoncmsUrl, DATA_POS_EMONCMS_URL );
-  eeStoreString( emoncmsFeedFmt, DATA_POS_EMONCMS_FEED_FMT );
 //
 #endif // USE_WEBAPI_EMONCMS
 //
 //
 #ifdef USE_WEBAPI_SHC
 //
-  eeStoreString( shcReadApiKey, DATA_POS_EMONCMS_READAPI_KEY );
-  eeStoreString( shcWriteApiKey, DATA_POS_EMONCMS_WRITEAPI_KEY );
-  eeStoreString( shcHost, DATA_POS_EMONCMS_HOST );
-  eeStoreString( shcPort, DATA_POS_EMONCMS_PORT );
-  eeStoreString( shcUrl, DATA_POS_EMONCMS_URL );
-  eeStoreString( shcFeedFmt, DATA_POS_EMONCMS_FEED_FMT );
+  eeStoreString( shcReadApiKey, DATA_POS_SHC_READAPI_KEY );
+  eeStoreString( shcWriteApiKey, DATA_POS_SHC_WRITEAPI_KEY );
+  eeStoreString( shcHost, DATA_POS_SHC_HOST );
+  eeStoreString( shcPort, DATA_POS_SHC_PORT );
+  eeStoreString( shcUrl, DATA_POS_SHC_URL );
 //
 #endif // USE_WEBAPI_SHC
 //
@@ -768,216 +1160,614 @@ bool eeStoreSettings( void )
   return( eeValidate() );
 }
 //
+// restore the settings of the web APIs, a field never stored keeps
+// its default
+//
+void eeRestoreSettings( void )
+{
+//
+#ifdef USE_WEBAPI_EMONCMS
+//
+  eeRestoreString( emoncmsReadApiKey, DATA_POS_EMONCMS_READAPI_KEY, LEN_EMONCMS_READAPI_KEY_MAX );
+  eeRestoreString( emoncmsWriteApiKey, DATA_POS_EMONCMS_WRITEAPI_KEY, LEN_EMONCMS_WRITEAPI_KEY_MAX );
+  eeRestoreString( emoncmsHost, DATA_POS_EMONCMS_HOST, LEN_EMONCMS_HOST_MAX );
+  eeRestoreString( emoncmsPort, DATA_POS_EMONCMS_PORT, LEN_EMONCMS_PORT_MAX );
+  eeRestoreString( emoncmsUrl, DATA_POS_EMONCMS_URL, LEN_EMONCMS_URL_MAX );
+//
+#endif // USE_WEBAPI_EMONCMS
+//
+//
+#ifdef USE_WEBAPI_SHC
+//
+  eeRestoreString( shcReadApiKey, DATA_POS_SHC_READAPI_KEY, LEN_SHC_READAPI_KEY_MAX );
+  eeRestoreString( shcWriteApiKey, DATA_POS_SHC_WRITEAPI_KEY, LEN_SHC_WRITEAPI_KEY_MAX );
+  eeRestoreString( shcHost, DATA_POS_SHC_HOST, LEN_SHC_HOST_MAX );
+  eeRestoreString( shcPort, DATA_POS_SHC_PORT, LEN_SHC_PORT_MAX );
+  eeRestoreString( shcUrl, DATA_POS_SHC_URL, LEN_SHC_URL_MAX );
+//
+#endif // USE_WEBAPI_SHC
+//
+}
+//
+// ************************************************************************
+// table of DS18B20 sensors in EEPROM. The records have a fixed size,
+// the position of a field is computed from the record number. A
+// record is written on its own, the others are not touched.
+// ************************************************************************
+//
+//
 // calculate position in EEPROM of record with given number
 //
 int eeRecordOffset( int recno )
 {
   int retVal = -1;
 
-  if( recno > 0 && recno < MAX_DS18B20_ENTRIES )
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES )
   {
-    retVal = DATA_POS_DS18B20_TBL_BEGIN;
+    retVal = DATA_POS_DS18B20_FIRST_REC;
 
     retVal += (LEN_DS18B20_SENSOR_RECORD * recno );
   }
   return( retVal );
 }
 //
-// calculate position in EEPROM of validation flag of a record
+// calculate position in EEPROM of a field of a record
 //
-int eeValidationFlagOffset( int recno )
+int eeRecordFieldOffset( int recno, int fieldPos )
 {
-  int retVal = -1;
-
-// DATA_LEN_VALIDATION_FLAG
+  int retVal = eeRecordOffset( recno );
 
+  if( retVal >= 0 )
+  {
+    retVal += fieldPos;
+  }
   return( retVal );
 }
 //
+// calculate position in EEPROM of validation flag of a record
+//
+int eeValidationFlagOffset( int recno )
+{
+  return( eeRecordFieldOffset( recno, REC_POS_VALIDATION_FLAG ) );
+}
+//
 // calculate position in EEPROM of sensor id of a record
 //
 int eeSensorIdOffset( int recno )
 {
-  int retVal = -1;
-
-// DATA_LEN_SENSOR_ID
-
-  return( retVal );
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_ID ) );
 }
 //
 // calculate position in EEPROM of feeder id of a record
 //
 int eeFeederIdOffset( int recno )
 {
-  int retVal = -1;
-
-// DATA_LEN_SENSOR_FEEDER_ID
-
-  return( retVal );
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_FEEDER_ID ) );
 }
 //
 // calculate position in EEPROM of name of a sensor
 //
 int eeSensorNameOffset( int recno )
 {
-  int retVal = -1;
-
-// DATA_LEN_SENSOR_NAME
-
-  return( retVal );
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_NAME ) );
 }
-
 //
-// ************************************************************************
-// RESTART the ESP ... trial an error phase to this feature
-// ************************************************************************
+// calculate position in EEPROM of resolution of a sensor
 //
-void espRestart()
+int eeSensorResolutionOffset( int recno )
 {
-  ESP.restart();
+  return( eeRecordFieldOffset( recno, REC_POS_SENSOR_RESOLUTION ) );
 }
 //
-// ************************************************************************
-// functions for SD card support
-// ************************************************************************
+// number of records in use, records behind are not read
 //
-#ifdef SD_SUPPORT
+int eeRestoreTableEntries( void )
+{
+  short entries = 0;
+
+  eeRestoreFieldLength( (char*) &entries, DATA_POS_DS18B20_TBL_BEGIN );
+
+  return( entries > 0 && entries <= MAX_DS18B20_ENTRIES ? entries : 0 );
+}
 //
-// check for valid sd card
+// restore a record, returns false for a free record
 //
-bool validateCard( void )
+bool eeRestoreSensorRecord( int recno, String& sensorId, String& feederId, String& name )
 {
   bool retVal = false;
-  String pathStr = SERVER_ROOT;
 
-  if( SD.exists(pathStr.c_str()) )
+  sensorId = feederId = name = "";
+
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES &&
+      EEPROM.read( eeValidationFlagOffset(recno) ) == EEPROM_RECORD_VALID )
   {
-    pathStr += "/";
-    pathStr += CHECKSUM_FILE;
-    if( SD.exists(pathStr.c_str()) )
-    {
-      retVal = true;
-    }
+    eeRestoreString( sensorId, eeSensorIdOffset(recno), LEN_DS18B20_ID_MAX );
+    eeRestoreString( feederId, eeFeederIdOffset(recno), LEN_DS18B20_FEEDER_ID_MAX );
+    eeRestoreString( name, eeSensorNameOffset(recno), LEN_DS18B20_NAME_MAX );
+    retVal = true;
   }
 
   return( retVal );
 }
-#endif // SD_SUPPORT
-//
-// ************************************************************************
-// functions related to EMONCMS ( e.g. get feed url )
-// ************************************************************************
 //
+// store a single record
 //
-// --- feed2EMONCMS ----------------------------------
-//
-// Perform an HTTP GET request to EMONCMS
-void feed2EMONCMS() 
+bool eeStoreSensorRecord( int recno, String sensorId, String feederId, String name )
 {
+  bool retVal = false;
+  short entries;
 
-#ifdef USE_WIFICLIENT
-  HTTPClient http;
-  char urlBuffer[LEN_EMONCMS_FEED_URLBUF_MAX+1];
-  char str_temp[6];
-
-
-// emoncmsHost
-// emoncmsPort
-// emoncmsUrl
-// emoncmsFeedFmt
-
-#ifdef USE_LOGGING
-  Logger.Log(LOGLEVEL_DEBUG,"try to connect to [%s], port is %d\n", emoncmsHost.c_str(), emoncmsPort.toInt());
-#endif // USE_LOGGING
-
-#ifdef USE_DHT
-  /* 4 is mininum width, 2 is precision; float value is copied onto str_temp*/
-  dtostrf(dhtHumidity, 4, 2, str_temp);  
-#endif // USE_DHT
-
-  memset(urlBuffer, '\0', sizeof(urlBuffer));
-  sprintf(urlBuffer, "%s", emoncmsUrl.c_str());
-  sprintf(&urlBuffer[strlen(urlBuffer)], emoncmsFeedFmt.c_str(), emoncmsWriteApiKey.c_str(), 987, str_temp);
-
-#ifdef USE_LOGGING
-  Logger.Log(LOGLEVEL_DEBUG,"feed url is: %s", urlBuffer);
-#endif // USE_LOGGING
-
-  // configure traged server and url
-  http.begin(emoncmsHost.c_str(), emoncmsPort.toInt(), String(urlBuffer));
-
-  // start connection and send HTTP header
-  int httpCode = http.GET();
-  if(httpCode) 
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES &&
+      sensorId.length() <= LEN_DS18B20_ID_MAX &&
+      feederId.length() <= LEN_DS18B20_FEEDER_ID_MAX &&
+      name.length() <= LEN_DS18B20_NAME_MAX )
   {
-    // HTTP header has been send and Server response header has been handled
-//    Logger.Logf("GET... code: %d\n", httpCode);
+    EEPROM.write( eeValidationFlagOffset(recno), EEPROM_RECORD_VALID );
+    eeStoreString( sensorId, eeSensorIdOffset(recno) );
+    eeStoreString( feederId, eeFeederIdOffset(recno) );
+    eeStoreString( name, eeSensorNameOffset(recno) );
 
-    // file found at server
-    if(httpCode == 200) 
+    if( recno >= eeRestoreTableEntries() )
     {
-      String payload = http.getString();
-#ifdef USE_LOGGING
-      Logger.Log(LOGLEVEL_DEBUG, "Payload = %s\n", payload.c_str() );
-#endif // USE_LOGGING
-      server.send(200, "text/html", payload); 
+      entries = recno + 1;
+      eeStoreFieldLength( (char*) &entries, DATA_POS_DS18B20_TBL_BEGIN );
+    }
 
-      StaticJsonBuffer<200> jsonBuffer;
-      JsonObject& root = jsonBuffer.parseObject(payload.c_str());
+    retVal = eeValidate();
+  }
 
-      bool success       = root["success"];
-      const char* infoMsg = root["message"];
+  return( retVal );
+}
+//
+// restore the resolution of a record, 0 for a free record resp. a
+// value out of 9..12
+//
+uint8_t eeRestoreSensorResolution( int recno )
+{
+  uint8_t retVal = 0;
 
-#ifdef USE_LOGGING
-      Logger.Log(LOGLEVEL_DEBUG,"result is successfully [");
-//      Logger.Log(LOGLEVEL_DEBUG,success);
-      Logger.Log(LOGLEVEL_DEBUG,"] ... message from server: ");
-      Logger.Log(LOGLEVEL_DEBUG, "%s\n", infoMsg);
-#endif // USE_LOGGING
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES &&
+      EEPROM.read( eeValidationFlagOffset(recno) ) == EEPROM_RECORD_VALID )
+  {
+    retVal = EEPROM.read( eeSensorResolutionOffset(recno) );
 
-     } 
-     else 
-     {
-#ifdef USE_LOGGING
-       Logger.Log(LOGLEVEL_DEBUG,"GET... failed\n");
-#endif // USE_LOGGING
-       String payload = "<!DOCTYPE HTML>\r\n";
-       payload += "<html></p>";
-       payload += "<br>call to feed API failed!<br>";
-       payload += "</html>";
-       server.send(200, "text/html", payload);  
-     }
-   }
-   else
-   {
-#ifdef USE_LOGGING
-     Logger.Log(LOGLEVEL_DEBUG,"send header... failed\n");
-#endif // USE_LOGGING
-     String payload = "<!DOCTYPE HTML>\r\n";
-     payload += "<html></p>";
-     payload += "<br>send GET header failed!<br>";
-     payload += "</html>";
-     server.send(200, "text/html", payload);  
-   }
+    if( retVal < 9 || retVal > 12 )
+    {
+      retVal = 0;
+    }
+  }
 
-#endif // USE_WIFICLIENT
+  return( retVal );
 }
-
-
 //
-// ************************************************************************
-// setup module ...
-// ************************************************************************
+// store the resolution of a record written by eeStoreSensorRecord()
 //
-void setup() 
+bool eeStoreSensorResolution( int recno, uint8_t bits )
 {
-  String n_ssid = "";
-  String n_password = "";
+  bool retVal = false;
 
-//  logLevel = LOGLEVEL_ERROR;
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES && bits >= 9 && bits <= 12 &&
+      EEPROM.read( eeValidationFlagOffset(recno) ) == EEPROM_RECORD_VALID )
+  {
+    EEPROM.write( eeSensorResolutionOffset(recno), bits );
+    retVal = eeValidate();
+  }
 
-  // startup serial console ...
-  Serial.begin(SERIAL_BAUD);
+  return( retVal );
+}
+//
+// mark a record as free
+//
+bool eeClearSensorRecord( int recno )
+{
+  bool retVal = false;
+
+  if( recno >= 0 && recno < MAX_DS18B20_ENTRIES )
+  {
+    EEPROM.write( eeValidationFlagOffset(recno), '\0' );
+    retVal = eeValidate();
+  }
+
+  return( retVal );
+}
+#ifdef USE_DS18B20
+//
+// a feeder id is a positive int given in decimal, 0 for anything else
+//
+int serParseFeederId( String feederId )
+{
+  unsigned long long value = 0;
+  bool valid = feederId.length() > 0 &&
+               feederId.length() <= LEN_DS18B20_FEEDER_ID_MAX;
+  int retVal = 0;
+
+  for( unsigned int i = 0; valid && i < feederId.length(); i++ )
+  {
+    valid = isdigit( feederId[i] );
+    value = value * 10 + (feederId[i] - '0');
+  }
+
+  if( valid && value > 0 && value <= INT_MAX )
+  {
+    retVal = (int) value;
+  }
+
+  return( retVal );
+}
+//
+// build the sensor to feed mapping from the sensor table
+//
+int serMapLoad( void )
+{
+  String sensorId, feederId, name;
+  uint64_t rom;
+  uint8_t resolution;
+  int entries = eeRestoreTableEntries();
+
+  serMappingCount = 0;
+
+  // one pass over the records in use
+  for( int recno = 0; recno < entries; recno++ )
+  {
+    // a record without feeder id keeps the resolution of a sensor
+    if( eeRestoreSensorRecord( recno, sensorId, feederId, name ) &&
+        hexToRomKey( sensorId.c_str(), &rom ) &&
+        (feederId.length() == 0 || serParseFeederId( feederId ) > 0) )
+    {
+      if( (resolution = eeRestoreSensorResolution( recno )) == 0 )
+      {
+        resolution = DS18B20_RESOLUTION;
+      }
+      serMapSet( rom, serParseFeederId( feederId ), name.c_str(), recno, resolution );
+    }
+  }
+
+#ifdef USE_LOGGING
+  Logger.Log(LOGLEVEL_DEBUG,"%d sensors mapped to feeds\n", serMappingCount);
+#endif // USE_LOGGING
+
+  return( serMappingCount );
+}
+//
+// map a sensor to a feed and store the mapping and the resolution of
+// the sensor in its record. An empty feeder id removes the mapping,
+// the record is kept as long as the resolution is not the default.
+//
+bool serMapStore( int idx, String feederId, String name )
+{
+  struct _ser_map *entry = serMapFind( ds18b20Sensors[idx].addr );
+  String sensorId = p_addrToHex( ds18b20Sensors[idx].addr );
+  uint8_t resolution = ds18b20Sensors[idx].resolution;
+  int recno = entry != NULL ? entry->recno : serMapFreeRecord();
+  bool retVal = false;
+
+  if( feederId.length() == 0 && resolution == DS18B20_RESOLUTION )
+  {
+    if( entry != NULL )
+    {
+      retVal = eeClearSensorRecord( recno );
+      serMapRemove( entry );
+    }
+    else
+    {
+      retVal = true;
+    }
+  }
+  else if( recno >= 0 &&
+           (feederId.length() == 0 || serParseFeederId( feederId ) > 0) &&
+           eeStoreSensorRecord( recno, sensorId, feederId, name ) &&
+           eeStoreSensorResolution( recno, resolution ) )
+  {
+    retVal = serMapSet( romToKey(ds18b20Sensors[idx].addr),
+                        serParseFeederId( feederId ), name.c_str(), recno,
+                        resolution );
+  }
+
+  ds18b20Sensors[idx].feedId = serToFeederId( ds18b20Sensors[idx].addr );
+
+  return( retVal );
+}
+#endif // USE_DS18B20
+
+//
+// ************************************************************************
+// RESTART the ESP ... trial an error phase to this feature
+// ************************************************************************
+//
+void espRestart()
+{
+  ESP.restart();
+}
+//
+// ************************************************************************
+// functions for SD card support
+// ************************************************************************
+//
+#ifdef SD_SUPPORT
+//
+// check for valid sd card
+//
+bool validateCard( void )
+{
+  bool retVal = false;
+  String pathStr = SERVER_ROOT;
+
+  if( SD.exists(pathStr.c_str()) )
+  {
+    pathStr += "/";
+    pathStr += CHECKSUM_FILE;
+    if( SD.exists(pathStr.c_str()) )
+    {
+      retVal = true;
+    }
+  }
+
+  return( retVal );
+}
+#endif // SD_SUPPORT
+//
+// ************************************************************************
+// functions related to the channels (history of the values read)
+// ************************************************************************
+//
+// channel of a name, NULL if there is none and create is false. If all
+// channels are used, one not updated for CHANNEL_STALE_MILLIS (e.g. of
+// a feed id that was changed) is taken for a new name, else there is
+// none for it.
+//
+channelHistory *channelFind( const char *name, bool create )
+{
+  channelHistory *retVal = NULL;
+  int oldest = 0;
+
+  for( int i = 0; retVal == NULL && i < channelCount; i++ )
+  {
+    if( strcmp(channels[i].Name(), name) == 0 )
+    {
+      retVal = &channels[i];
+    }
+    else if( millis() - channels[i].LastMillis() > millis() - channels[oldest].LastMillis() )
+    {
+      oldest = i;
+    }
+  }
+
+  if( retVal == NULL && create )
+  {
+    if( channelCount < MAX_CHANNELS )
+    {
+      retVal = &channels[channelCount++];
+      retVal->Begin( name, CHANNEL_EWMA_ALPHA );
+    }
+    else if( millis() - channels[oldest].LastMillis() > CHANNEL_STALE_MILLIS )
+    {
+#ifdef USE_LOGGING
+      Logger.Log(LOGLEVEL_DEBUG,"channel %s replaces %s\n", name, channels[oldest].Name());
+#endif // USE_LOGGING
+      retVal = &channels[oldest];
+      retVal->Begin( name, CHANNEL_EWMA_ALPHA );
+    }
+#ifdef USE_LOGGING
+    else
+    {
+      Logger.Log(LOGLEVEL_WARNING,"no channel left for %s\n", name);
+    }
+#endif // USE_LOGGING
+  }
+
+  return( retVal );
+}
+//
+// a value read from a sensor. It goes to the history once the time
+// is known from NTP.
+//
+void channelAdd( const char *name, float value )
+{
+  unsigned long now = time(NULL);
+  channelHistory *channel = channelFind( name, true );
+
+  if( channel != NULL )
+  {
+    channel->Add( now, value, now >= TIME_VALID_MIN );
+  }
+}
+//
+// ************************************************************************
+// functions related to the data sinks (EMONCMS, SHC, MQTT, InfluxDB)
+// ************************************************************************
+//
+// spool file of a sink, on the SD card resp. in SPIFFS without
+// SD_SUPPORT. None if the file system is not there.
+//
+const char *dataSinkSpool( const char *spoolFile )
+{
+  const char *retVal = NULL;
+
+#ifdef SD_SUPPORT
+  if( hasSD )
+  {
+    retVal = spoolFile;
+  }
+#else
+  if( hasSpiffs )
+  {
+    retVal = spoolFile;
+  }
+#endif // SD_SUPPORT
+
+  return( retVal );
+}
+//
+// --- start the sinks enabled ------------------------
+//
+void dataSinksBegin()
+{
+#ifdef USE_WIFICLIENT
+#ifdef USE_WEBAPI_EMONCMS
+  emoncmsSender.Begin( &Tasks, dataSinkSpool(EMONCMS_SPOOL_FILE) );
+  dataSinks[dataSinkCount++] = &emoncmsSender;
+#endif // USE_WEBAPI_EMONCMS
+#ifdef USE_WEBAPI_SHC
+  shcSender.Begin( &Tasks, dataSinkSpool(SHC_SPOOL_FILE) );
+  dataSinks[dataSinkCount++] = &shcSender;
+#endif // USE_WEBAPI_SHC
+#ifdef USE_MQTT
+  mqttSender.Begin( &Tasks, dataSinkSpool(MQTT_SPOOL_FILE) );
+  dataSinks[dataSinkCount++] = &mqttSender;
+#endif // USE_MQTT
+#ifdef USE_INFLUXDB
+  influxSender.Begin( &Tasks, dataSinkSpool(INFLUX_SPOOL_FILE) );
+  dataSinks[dataSinkCount++] = &influxSender;
+#endif // USE_INFLUXDB
+#endif // USE_WIFICLIENT
+}
+//
+// --- queue a sample for each sink -------------------
+//
+void dataSinksAdd( unsigned long stamp, const char *input, float value )
+{
+  for( int i = 0; i < dataSinkCount; i++ )
+  {
+    dataSinks[i]->Add( stamp, input, value );
+  }
+}
+//
+// queue the mean of each channel since the last run for the sinks,
+// runs every SINK_SAMPLE_INTVAL. The aggregate is stamped with the
+// time of its first sample.
+//
+void sendAggregates( void *arg )
+{
+  channelAggregate window;
+#ifdef SINK_SEND_PEAKS
+  char input[DATA_SAMPLE_INPUT_MAX + 1];
+#endif // SINK_SEND_PEAKS
+
+  for( int i = 0; i < channelCount; i++ )
+  {
+    if( channels[i].TakeWindow( &window ) )
+    {
+      dataSinksAdd( window.time, channels[i].Name(), window.sum / window.count );
+#ifdef SINK_SEND_PEAKS
+      sprintf(input, "%s_min", channels[i].Name());
+      dataSinksAdd( window.time, input, window.min );
+      sprintf(input, "%s_max", channels[i].Name());
+      dataSinksAdd( window.time, input, window.max );
+#endif // SINK_SEND_PEAKS
+    }
+  }
+}
+//
+// result of a batch as text
+//
+const char *dataSinkResultText( int result )
+{
+  const char *retVal;
+
+  switch( result )
+  {
+    case DATA_SINK_OK:
+      retVal = "ok";
+      break;
+    case DATA_SINK_ERR_CONNECT:
+      retVal = "connect failed";
+      break;
+    case DATA_SINK_ERR_TIMEOUT:
+      retVal = "timeout";
+      break;
+    case DATA_SINK_ERR_REJECTED:
+      retVal = "rejected";
+      break;
+    default:
+      retVal = "bad response";
+      break;
+  }
+
+  return( retVal );
+}
+//
+// state of the sinks for the web pages, never waits for a server
+//
+String dataSinkStatusText()
+{
+  const dataSinkStats *stats;
+  String retVal = "";
+
+  for( int i = 0; i < dataSinkCount; i++ )
+  {
+    stats = dataSinks[i]->Stats();
+
+    retVal += String(dataSinks[i]->Name()) + " queue: ";
+    retVal += String(dataSinks[i]->QueueCount()) + " samples";
+    retVal += ", spool: " + String(dataSinks[i]->SpoolPending()) + " bytes";
+    retVal += ", sent: " + String(stats->sent);
+    retVal += ", spooled: " + String(stats->spooled);
+    retVal += ", dropped: " + String(stats->dropped);
+    retVal += ", failed posts: " + String(stats->failures);
+    retVal += "<br>last post: ";
+
+    if( dataSinks[i]->Busy() )
+    {
+      retVal += "in progress";
+    }
+    else if( stats->posts == 0 )
+    {
+      retVal += "none";
+    }
+    else
+    {
+      retVal += String(dataSinkResultText(dataSinks[i]->LastResult())) + " (" +
+                String(dataSinks[i]->Code()) + "), " +
+                String(dataSinks[i]->LastSamples()) + " samples, " +
+                String(dataSinks[i]->LastDuration()) + " ms, " +
+                String((millis() - dataSinks[i]->LastMillis()) / 1000) + " s ago";
+    }
+    retVal += "<br>";
+  }
+
+  return( retVal );
+}
+//
+// --- handleSinksPage --------------------------------
+//
+// show the state of the sinks and let them send their queues at once.
+// The page does not wait for the servers.
+void handleSinksPage() 
+{
+  String payload = "<!DOCTYPE HTML>\r\n";
+
+  if( dataSinkCount == 0 )
+  {
+    server.send(501, "text/plain", "no data sink enabled\n");
+  }
+  else
+  {
+    for( int i = 0; i < dataSinkCount; i++ )
+    {
+      dataSinks[i]->Flush();
+    }
+
+    payload += "<html></p>";
+    payload += "<br>" + dataSinkStatusText();
+    payload += "</html>";
+    server.send(200, "text/html", payload);  
+  }
+}
+
+//
+// ************************************************************************
+// setup module ...
+// ************************************************************************
+//
+void setup() 
+{
+  String n_ssid = "";
+  String n_password = "";
+
+//  logLevel = LOGLEVEL_ERROR;
+
+  // startup serial console ...
+  Serial.begin(SERIAL_BAUD);
   delay(10);
 
 #ifdef USE_LOGGING
@@ -1012,7 +1802,7 @@ void setup()
   else
   {
 #ifdef USE_LOGGING
-    Logger.Log(LOGLEVEL_DEBUG,LOGLEVEL_DEBUG, "... initialization done.\nValidating SD card ...");
+    Logger.Log(LOGLEVEL_DEBUG, "... initialization done.\nValidating SD card ...");
 #endif // USE_LOGGING
     if( (hasSD = validateCard()) )
     {
@@ -1029,6 +1819,14 @@ void setup()
       hasSD = false;
     }
   }
+#else
+  // a module without SD card spools to the flash
+  if( !(hasSpiffs = SPIFFS.begin()) )
+  {
+#ifdef USE_LOGGING
+    Logger.Log(LOGLEVEL_DEBUG,"no SPIFFS, samples are not spooled.\n");
+#endif // USE_LOGGING
+  }
 #endif // SD_SUPPORT
 
   // prepare access to EEPROM 
@@ -1045,6 +1843,7 @@ void setup()
 #endif // USE_LOGGING
     eeRestoreString( n_ssid, DATA_POS_SSID, LEN_SSID_MAX );
     eeRestoreString( n_password, DATA_POS_PASSWORD, LEN_PASSWORD_MAX );
+    eeRestoreSettings();
   }
   else
   {
@@ -1067,9 +1866,29 @@ void setup()
 #endif // USE_DHT
 
 #ifdef USE_DS18B20  
-  DS18B20.begin();
+  if( eeIsValid() )
+  {
+    serMapLoad();
+  }
+  ds18b20Scan();
+  Tasks.Every(DS18B20_READINTVAL, readDS18B20, NULL, "DS18B20");
 #endif // USE_DS18B20
 
+#ifdef USE_DHT
+  Tasks.Every(DHT_READINTVAL, readDHT, NULL, "DHT");
+#endif // USE_DHT
+
+#ifdef USE_BMP085
+  Tasks.Every(BMP_READINTVAL, readBMP, NULL, "BMP085");
+#endif // USE_BMP085
+
+  dataSinksBegin();
+
+  if( dataSinkCount > 0 )
+  {
+    Tasks.Every(SINK_SAMPLE_INTVAL, sendAggregates, NULL, "aggregate");
+  }
+
 #ifdef USE_WIFICLIENT
 #ifdef USE_LOGGING
   Logger.Log(LOGLEVEL_DEBUG,"Connecting to %s\n", ssid.c_str() );
@@ -1094,6 +1913,13 @@ void setup()
 #ifdef USE_LOGGING
   Logger.Log(LOGLEVEL_DEBUG,"WiFi connected.\n");
 #endif // USE_LOGGING
+
+#ifdef USE_LIGHT_SLEEP
+  WiFi.setSleepMode(WIFI_LIGHT_SLEEP);
+#endif // USE_LIGHT_SLEEP
+
+  // UTC from NTP, the time stamps of the samples
+  configTime(0, 0, NTP_SERVER);
 #endif // USE_WIFICLIENT
    
   // that's a quite funny feature of the ESP8266WebServer-class
@@ -1110,12 +1936,14 @@ void setup()
   server.on("/", handleIndexPage);
   server.on("/admin", handleAdminPage);
   server.on("/sensors", handleDS18B20Page);
+  server.on("/sinks", handleSinksPage);
+  server.on("/api/history", handleHistoryApi);
 #ifdef USE_WEBAPI_EMONCMS
-  server.on("/emoncms", feed2EMONCMS);
+  server.on("/emoncms", handleSinksPage);
 #endif // USE_WEBAPI_EMONCMS
 //
 #ifdef USE_WEBAPI_SHC
-  server.on("/shc", feed2EMONCMS);
+  server.on("/shc", handleSinksPage);
 #endif // USE_WEBAPI_SHC
 
 #ifdef USE_WWWSERVER
@@ -1147,25 +1975,30 @@ void setup()
 //
 #ifdef USE_DS18B20
 
-char *p_toHex( uint8_t c )
+//
+// ROM code of a sensor as hex string
+//
+String p_addrToHex( const uint8_t *addr )
 {
-  char val[3];
-  sprintf(val, "%X", c);
-  return( val );
+  char val[2 * sizeof(DeviceAddress) + 1];
+
+  for( int x = 0; x < sizeof(DeviceAddress); x++ )
+  {
+    sprintf(&val[2 * x], "%02X", addr[x]);
+  }
+  return( String(val) );
 }
 
 
 void handleDS18B20Page()
 {
 
-//  DeviceAddress addr;
-  uint8_t addr[8];
   String n_sensorId = "Sensor xx";
   String n_feederId = "2";
   String n_sensorName = "Ich habe einen Namen";
+  struct _ser_map *mapping;
   int nSensors;
-
-  static int pageArgs = 0;
+  int failed;
 
   if( server.method() == SERVER_METHOD_GET )
   {
@@ -1175,17 +2008,23 @@ void handleDS18B20Page()
     pageContent += "<html></p>";
     pageContent +=   "<form method='post' action='sensors'>";
 
-    nSensors = DS18B20.getDeviceCount();
+    // the sensors found by the last scan, no search on the bus here
+    nSensors = ds18b20Count;
 
     for( int i = 0; i < nSensors && i < MAX_DS18B20_ENTRIES; i++ )
     {
-      DS18B20.getAddress(addr, i);
-
-      n_sensorId = "";
+      n_sensorId = p_addrToHex( ds18b20Sensors[i].addr );
 
-      for( int x = 0; x < sizeof(addr); x++ )
+      if( (mapping = serMapFind( ds18b20Sensors[i].addr )) != NULL &&
+          mapping->feedId > 0 )
       {
-        n_sensorId += p_toHex( addr[x] );
+        n_feederId = String(mapping->feedId);
+        n_sensorName = mapping->name;
+      }
+      else
+      {
+        n_feederId = "";
+        n_sensorName = "";
       }
 
 //
@@ -1206,8 +2045,16 @@ void handleDS18B20Page()
                            String(LEN_DS18B20_NAME_MAX) + "> (max. " +
                            String(LEN_DS18B20_NAME_MAX)  + " chars)";
 //
-
-      pageArgs += 3;
+      pageContent +=     "<label>Aufl&ouml;sung: </label>";
+      pageContent +=      "<select name='res_" + n_sensorId + "'>";
+      for( int bits = 9; bits <= 12; bits++ )
+      {
+        pageContent +=     "<option value='" + String(bits) + "'" +
+                           (ds18b20Sensors[i].resolution == bits ? " selected" : "") +
+                           ">" + String(bits) + " bit</option>";
+      }
+      pageContent +=      "</select>";
+//
 
     } // end for i < MAX_DS18B20_ENTRIES
 
@@ -1227,32 +2074,49 @@ void handleDS18B20Page()
       // reset page content
       pageContent = "";
 
-      if( server.args() == pageArgs )
+      // a new resolution is written to the sensor at once, to its
+      // record together with the feeder id below
+      for( int i = 0; i < ds18b20Count; i++ )
       {
+        n_sensorId = "res_" + p_addrToHex( ds18b20Sensors[i].addr );
 
-          pageContent = "<!DOCTYPE HTML>\r\n";
-          pageContent += "<html></p>";
-          pageContent += "<br>Settings stored<br>";
-          pageContent += "</html>";
-          server.send(200, "text/html", pageContent); 
-
-           if(0)
-            { 
-            }
-            else
-            {
-              pageContent = "<!DOCTYPE HTML>\r\n";
-              pageContent += "<html></p>";
-              pageContent += "<br>empty strings for ssid/password are not allowed!<br>";
-              pageContent += "</html>";
-              server.send(200, "text/html", pageContent);  
-            }
+        if( server.hasArg(n_sensorId) &&
+            server.arg(n_sensorId).toInt() != ds18b20Sensors[i].resolution )
+        {
+          ds18b20SetResolution( i, server.arg(n_sensorId).toInt() );
+        }
+      }
+
+      // store the record of each sensor of the form
+      failed = 0;
+
+      for( int i = 0; i < ds18b20Count; i++ )
+      {
+        n_sensorId = p_addrToHex( ds18b20Sensors[i].addr );
+
+        if( server.hasArg("feederId_" + n_sensorId) )
+        {
+          if( !serMapStore( i, server.arg("feederId_" + n_sensorId),
+                            server.arg("name_" + n_sensorId) ) )
+          {
+            failed++;
+          }
+        }
+      }
+
+      if( failed == 0 )
+      {
+        pageContent = "<!DOCTYPE HTML>\r\n";
+        pageContent += "<html></p>";
+        pageContent += "<br>Settings stored<br>";
+        pageContent += "</html>";
+        server.send(200, "text/html", pageContent); 
       }
       else
       {
         pageContent = "<!DOCTYPE HTML>\r\n";
         pageContent += "<html></p>";
-        pageContent += "<br>too few arguments<br>";
+        pageContent += "<br>" + String(failed) + " sensor(s) not stored, invalid feeder id or name!<br>";
         pageContent += "</html>";
         server.send(200, "text/html", pageContent);  
       }
@@ -1273,7 +2137,12 @@ void handleAdminPage()
   String n_Host = "";
   String n_Port = "";
   String n_Url = "";
-  String n_FeedFmt = "";
+  String n_ShcReadApiKey = "";
+  String n_ShcWriteApiKey = "";
+  String n_ShcHost = "";
+  String n_ShcPort = "";
+  String n_ShcUrl = "";
+  bool complete;
 
 #ifdef USE_LOGGING
   Logger.Log(LOGLEVEL_DEBUG,"AdminIndex page.\n");
@@ -1340,13 +2209,6 @@ void handleAdminPage()
                          String(LEN_EMONCMS_URL_MAX) + "> (max. " +
                          String(LEN_EMONCMS_URL_MAX) + " chars)";
     pageContent +=      "<br>";
-//
-    pageContent +=     "<label>EMONCMS feeder format: </label>";
-    pageContent +=      "<input name='" + String(FORM_DATAFIELD_NAME_EMON_FORMAT) +
-                        "' value=" + emoncmsFeedFmt + " length=" +
-                         String(LEN_EMONCMS_FEED_FMT_MAX) + "> (max. " +
-                         String(LEN_EMONCMS_FEED_FMT_MAX) + " chars)";
-    pageContent +=      "<br>";
 //
 #endif // USE_WEBAPI_EMONCMS
 //
@@ -1387,13 +2249,6 @@ void handleAdminPage()
                          String(LEN_SHC_URL_MAX) + "> (max. " +
                          String(LEN_SHC_URL_MAX) + " chars)";
     pageContent +=      "<br>";
-//
-    pageContent +=     "<label>SHC feeder format: </label>";
-    pageContent +=      "<input name='" + String(FORM_DATAFIELD_NAME_SHC_FORMAT) +
-                        "' value=" + shcFeedFmt + " length=" +
-                         String(LEN_SHC_FEED_FMT_MAX) + "> (max. " +
-                         String(LEN_SHC_FEED_FMT_MAX) + " chars)";
-    pageContent +=      "<br>";
 //
 #endif // USE_WEBAPI_SHC
 //
@@ -1431,7 +2286,6 @@ void handleAdminPage()
         n_Host = server.arg(FORM_DATAFIELD_NAME_EMON_HOST);
         n_Port = server.arg(FORM_DATAFIELD_NAME_EMON_PORT);
         n_Url = server.arg(FORM_DATAFIELD_NAME_EMON_URL);
-        n_FeedFmt = server.arg(FORM_DATAFIELD_NAME_EMON_FORMAT);
 //
 #endif // USE_WEBAPI_EMONCMS
 //
@@ -1439,24 +2293,35 @@ void handleAdminPage()
 //
 #ifdef USE_WEBAPI_SHC
 //
-        n_ReadApiKey = server.arg(FORM_DATAFIELD_NAME_SHC_RDKEY);
-        n_WriteApiKey = server.arg(FORM_DATAFIELD_NAME_SHC_WRKEY);
-        n_Host = server.arg(FORM_DATAFIELD_NAME_SHC_HOST);
-        n_Port = server.arg(FORM_DATAFIELD_NAME_SHC_PORT);
-        n_Url = server.arg(FORM_DATAFIELD_NAME_SHC_URL);
-        n_FeedFmt = server.arg(FORM_DATAFIELD_NAME_SHC_FORMAT);
+        n_ShcReadApiKey = server.arg(FORM_DATAFIELD_NAME_SHC_RDKEY);
+        n_ShcWriteApiKey = server.arg(FORM_DATAFIELD_NAME_SHC_WRKEY);
+        n_ShcHost = server.arg(FORM_DATAFIELD_NAME_SHC_HOST);
+        n_ShcPort = server.arg(FORM_DATAFIELD_NAME_SHC_PORT);
+        n_ShcUrl = server.arg(FORM_DATAFIELD_NAME_SHC_URL);
 //
 #endif // USE_WEBAPI_SHC
 //
+        complete = n_ssid.length() > 0 && n_password.length() > 0;
 
-        if (n_ssid.length() > 0 && 
-            n_password.length() > 0 &&
-            n_ReadApiKey.length() > 0 && 
-            n_WriteApiKey.length() > 0 &&
-            n_Host.length() > 0 &&
-            n_Port.length() > 0 &&
-            n_Url.length() > 0 &&
-            n_FeedFmt.length() > 0 )
+#ifdef USE_WEBAPI_EMONCMS
+        complete = complete &&
+                   n_ReadApiKey.length() > 0 && 
+                   n_WriteApiKey.length() > 0 &&
+                   n_Host.length() > 0 &&
+                   n_Port.length() > 0 &&
+                   n_Url.length() > 0;
+#endif // USE_WEBAPI_EMONCMS
+
+#ifdef USE_WEBAPI_SHC
+        complete = complete &&
+                   n_ShcReadApiKey.length() > 0 && 
+                   n_ShcWriteApiKey.length() > 0 &&
+                   n_ShcHost.length() > 0 &&
+                   n_ShcPort.length() > 0 &&
+                   n_ShcUrl.length() > 0;
+#endif // USE_WEBAPI_SHC
+
+        if( complete )
         {
 
           //
@@ -1472,7 +2337,16 @@ void handleAdminPage()
         eeStoreString( n_Host, DATA_POS_EMONCMS_HOST );
         eeStoreString( n_Port, DATA_POS_EMONCMS_PORT );
         eeStoreString( n_Url, DATA_POS_EMONCMS_URL );
-        eeStoreString( n_FeedFmt, DATA_POS_EMONCMS_FEED_FMT );
+
+        // the sink keeps these by reference
+        emoncmsReadApiKey = n_ReadApiKey;
+        emoncmsWriteApiKey = n_WriteApiKey;
+        emoncmsHost = n_Host;
+        emoncmsPort = n_Port;
+        emoncmsUrl = n_Url;
+#ifdef USE_WIFICLIENT
+        emoncmsSender.Reconnect();
+#endif // USE_WIFICLIENT
 //
 #endif // USE_WEBAPI_EMONCMS
 //
@@ -1480,12 +2354,21 @@ void handleAdminPage()
 //
 #ifdef USE_WEBAPI_SHC
 //
-        eeStoreString( n_ReadApiKey, DATA_POS_SHC_READAPI_KEY );
-        eeStoreString( n_WriteApiKey, DATA_POS_SHC_WRITEAPI_KEY );
-        eeStoreString( n_Host, DATA_POS_SHC_HOST );
-        eeStoreString( n_Port, DATA_POS_SHC_PORT );
-        eeStoreString( n_Url, DATA_POS_SHC_URL );
-        eeStoreString( n_FeedFmt, DATA_POS_SHC_FEED_FMT );
+        eeStoreString( n_ShcReadApiKey, DATA_POS_SHC_READAPI_KEY );
+        eeStoreString( n_ShcWriteApiKey, DATA_POS_SHC_WRITEAPI_KEY );
+        eeStoreString( n_ShcHost, DATA_POS_SHC_HOST );
+        eeStoreString( n_ShcPort, DATA_POS_SHC_PORT );
+        eeStoreString( n_ShcUrl, DATA_POS_SHC_URL );
+
+        // the sink keeps these by reference
+        shcReadApiKey = n_ShcReadApiKey;
+        shcWriteApiKey = n_ShcWriteApiKey;
+        shcHost = n_ShcHost;
+        shcPort = n_ShcPort;
+        shcUrl = n_ShcUrl;
+#ifdef USE_WIFICLIENT
+        shcSender.Reconnect();
+#endif // USE_WIFICLIENT
 //
 #endif // USE_WEBAPI_SHC
 //
@@ -1502,7 +2385,7 @@ void handleAdminPage()
         {
           pageContent = "<!DOCTYPE HTML>\r\n";
           pageContent += "<html></p>";
-          pageContent += "<br>empty strings for ssid/password are not allowed!<br>";
+          pageContent += "<br>empty strings are not allowed!<br>";
           pageContent += "</html>";
           server.send(200, "text/html", pageContent);  
         }
@@ -1531,28 +2414,19 @@ void handleIndexPage()
   // send response to client
   pageContent  = "<!DOCTYPE HTML>\r\n<html>";
 
-#ifdef USE_DS18B20  
-  pageContent += "Temperature is now: ";
-  pageContent += String(ds18b20Temp);  
-  pageContent += " &deg;C";
-#endif // USE_DS18B20
-
-#ifdef USE_DHT
-  pageContent += "Temperature is now: ";
-  pageContent += String(dhtTemp);  
-  // what kind of unit? 
-  if( DHT_DEGREE_UNIT == DHT_READ_CELSIUS )
-  {
-    pageContent += " &deg;C<br>";
-  }
-  else
+  // last value of each channel, min/max/mean of its history
+  for( int i = 0; i < channelCount; i++ )
   {
-    pageContent += " &deg;F<br>";
+    pageContent += String(channels[i].Name()) + " is now: ";
+    pageContent += String(channels[i].Last());
+    pageContent += " (min " + String(channels[i].Min());
+    pageContent += ", max " + String(channels[i].Max());
+    pageContent += ", mean " + String(channels[i].Mean());
+    pageContent += ", EWMA " + String(channels[i].Ewma());
+    pageContent += " of " + String(channels[i].Count()) + " samples)<br>";
   }
-  pageContent += "Humidity is now ..: ";
-  pageContent += String(dhtHumidity);  
-  pageContent += " %";
-#endif // USE_DHT
+
+  pageContent += "<br><br>" + dataSinkStatusText();
 
   pageContent += "<br><br>";
   pageContent += "</html>";
@@ -1561,85 +2435,286 @@ void handleIndexPage()
  
 }
 
+//
+// handle /api/history?channel=<name>&step=<seconds>
+// The samples of the channel as [time,value], with step > 0 as
+// [time,mean,min,max,count] per step seconds. Without a channel the
+// channels and their statistics are listed.
+//
+void handleHistoryApi()
+{
+  channelHistory *channel;
+  channelAggregate agg;
+  unsigned long step = server.arg("step").toInt();
+  String name = server.arg("channel");
+  int idx;
+
+  if( name.length() == 0 )
+  {
+    pageContent = "{\"channels\":[";
+
+    for( int i = 0; i < channelCount; i++ )
+    {
+      pageContent += String(i > 0 ? "," : "") + "{\"name\":\"" + channels[i].Name() + "\"";
+      pageContent += ",\"count\":" + String(channels[i].Count());
+      pageContent += ",\"last\":" + String(channels[i].Last());
+      pageContent += ",\"min\":" + String(channels[i].Min());
+      pageContent += ",\"max\":" + String(channels[i].Max());
+      pageContent += ",\"mean\":" + String(channels[i].Mean());
+      pageContent += ",\"ewma\":" + String(channels[i].Ewma()) + "}";
+    }
+
+    pageContent += "]}";
+    server.send(200, "application/json", pageContent);
+  }
+  else if( (channel = channelFind( name.c_str(), false )) == NULL )
+  {
+    server.send(404, "application/json", "{\"error\":\"unknown channel\"}");
+  }
+  else
+  {
+    pageContent = "{\"channel\":\"" + name + "\",\"step\":" + String(step) + ",\"samples\":[";
+
+    for( idx = 0; idx < channel->Count(); )
+    {
+      pageContent += idx > 0 ? "," : "";
+
+      if( step == 0 )
+      {
+        pageContent += "[" + String(channel->At(idx)->time) + "," +
+                       String(channel->At(idx)->value) + "]";
+        idx++;
+      }
+      else
+      {
+        idx = channel->Downsample( idx, step, &agg );
+        pageContent += "[" + String(agg.time) + "," +
+                       String(agg.sum / agg.count) + "," +
+                       String(agg.min) + "," +
+                       String(agg.max) + "," +
+                       String(agg.count) + "]";
+      }
+    }
+
+    pageContent += "]}";
+    server.send(200, "application/json", pageContent);
+  }
+}
+
 //
 // ************************************************************************
-// main loop is quite simple ...
+// sensor tasks, run by the scheduler in loop()
 // ************************************************************************
 //
-void loop() 
+#ifdef USE_DS18B20
+//
+// search the bus and give new sensors the resolution of their record.
+// The sensor keeps it in its EEPROM, it is written only if it differs.
+//
+void ds18b20Scan()
 {
-  static long lastDS18B20Cycle;
-  static long lastDHTCycle;
-  static long lastBMPCycle;
+  DeviceAddress addr;
+  int n = 0;
 
-#ifdef USE_DS18B20
-  // check for next read interval has reached
-  if( (millis() - lastDS18B20Cycle) >= DS18B20_READINTVAL )
-  {
-    DS18B20.requestTemperatures();
+  DS18B20.begin();
 
-    for( int i = 0; i < DS18B20.getDeviceCount(); i++ )
+  for( int i = 0; i < DS18B20.getDeviceCount() && n < MAX_DS18B20_ENTRIES; i++ )
+  {
+    if( DS18B20.getAddress(addr, i) )
     {
-      ds18b20Temp = DS18B20.getTempCByIndex(i);
-      // info output to serial console ...
+      if( memcmp(ds18b20Sensors[n].addr, addr, sizeof(addr)) != 0 ||
+          ds18b20Sensors[n].resolution == 0 )
+      {
+        memcpy(ds18b20Sensors[n].addr, addr, sizeof(addr));
+        ds18b20Sensors[n].resolution = serToResolution( addr );
+        ds18b20Sensors[n].valid = false;
+      }
+
+      // looked up once here, not per sample
+      ds18b20Sensors[n].feedId = serToFeederId( ds18b20Sensors[n].addr );
+
+      if( DS18B20.getResolution(ds18b20Sensors[n].addr) != ds18b20Sensors[n].resolution )
+      {
+        DS18B20.setResolution(ds18b20Sensors[n].addr, ds18b20Sensors[n].resolution);
+      }
+      n++;
+    }
+  }
+
+  ds18b20Count = n;
+  ds18b20Rescan = false;
+  // requestTemperatures() must not wait for the conversion
+  DS18B20.setWaitForConversion(false);
+
 #ifdef USE_LOGGING
-      Logger.Log(LOGLEVEL_DEBUG,"Temperature: %f\n", ds18b20Temp);
+  Logger.Log(LOGLEVEL_DEBUG,"%d DS18B20 found\n", ds18b20Count);
 #endif // USE_LOGGING
+}
+//
+// change the resolution of a sensor, 9..12 bits. The sensor is written
+// only if the resolution changes, serMapStore() keeps it in the record.
+//
+bool ds18b20SetResolution( int idx, uint8_t bits )
+{
+  bool retVal = false;
+
+  if( idx >= 0 && idx < ds18b20Count && bits >= 9 && bits <= 12 )
+  {
+    retVal = true;
+
+    if( ds18b20Sensors[idx].resolution != bits )
+    {
+      ds18b20Sensors[idx].resolution = bits;
+      retVal = DS18B20.setResolution(ds18b20Sensors[idx].addr, bits);
     }
-    lastDS18B20Cycle = millis();
   }
-#endif // USE_DS18B20
 
-#ifdef USE_DHT
-  // check for next read interval has reached
-  if( (millis() - lastDHTCycle) >= DHT_READINTVAL )
+  return( retVal );
+}
+//
+// read the scratchpad of the next sensor, one per run
+//
+void readDS18B20Next( void *arg )
+{
+  struct _ds18b20_sensor *sensor = &ds18b20Sensors[ds18b20Next];
+  float tempC = DS18B20.getTempC(sensor->addr);
+  char name[LEN_DS18B20_FEEDER_ID_MAX + 1];
+
+  sensor->valid = tempC != DEVICE_DISCONNECTED_C;
+
+  if( sensor->valid )
   {
-    lastDHTCycle = millis();
-    dhtHumidity = dht.readHumidity();          // Read humidity (percent)
-    dhtTemp = dht.readTemperature(DHT_DEGREE_UNIT);     // Read temperature as Fahrenheit
+    sensor->tempC = tempC;
+
+    // channels of the sensors are named by their feed ids
+    if( sensor->feedId > 0 )
+    {
+      sprintf(name, "%d", sensor->feedId);
+      channelAdd( name, tempC );
+    }
     // info output to serial console ...
 #ifdef USE_LOGGING
-    Logger.Log(LOGLEVEL_DEBUG,"Temperature: %f - Humidity: %f\n", dhtTemp, dhtHumidity);
+    Logger.Log(LOGLEVEL_DEBUG,"Temperature %d: %f\n", ds18b20Next, tempC);
 #endif // USE_LOGGING
   }
+  else
+  {
+    ds18b20Rescan = true;
+#ifdef USE_LOGGING
+    Logger.Log(LOGLEVEL_DEBUG,"DS18B20 %d does not answer\n", ds18b20Next);
+#endif // USE_LOGGING
+  }
+
+  if( ++ds18b20Next < ds18b20Count )
+  {
+    Tasks.After(0, readDS18B20Next, NULL, "DS18B20 read");
+  }
+  else
+  {
+    ds18b20Busy = false;
+  }
+}
+//
+// start a conversion on all sensors and come back when the slowest
+// one is ready
+//
+void readDS18B20( void *arg )
+{
+  unsigned long wait = 0;
 
-  // Check if any reads failed and exit early (to try again).
+  if( !ds18b20Busy )
+  {
+    if( ds18b20Rescan || ds18b20Count == 0 )
+    {
+      ds18b20Scan();
+    }
+
+    if( ds18b20Count > 0 )
+    {
+      DS18B20.requestTemperatures();
+
+      for( int i = 0; i < ds18b20Count; i++ )
+      {
+        if( DS18B20.millisToWaitForConversion(ds18b20Sensors[i].resolution) > wait )
+        {
+          wait = DS18B20.millisToWaitForConversion(ds18b20Sensors[i].resolution);
+        }
+      }
+
+      ds18b20Next = 0;
+      ds18b20Busy = true;
+      Tasks.After(wait, readDS18B20Next, NULL, "DS18B20 read");
+    }
+  }
+}
+#endif // USE_DS18B20
+
+#ifdef USE_DHT
+void readDHT( void *arg )
+{
+  float dhtHumidity = dht.readHumidity();          // Read humidity (percent)
+  float dhtTemp = dht.readTemperature(DHT_DEGREE_UNIT);     // Read temperature as Fahrenheit
+  // info output to serial console ...
+#ifdef USE_LOGGING
+  Logger.Log(LOGLEVEL_DEBUG,"Temperature: %f - Humidity: %f\n", dhtTemp, dhtHumidity);
+#endif // USE_LOGGING
+
+  // Check if any reads failed, try again with the next run
   if (isnan(dhtHumidity) || isnan(dhtTemp)) 
   {
 #ifdef USE_LOGGING
     Logger.Log(LOGLEVEL_DEBUG,"Failed to read from DHT sensor!\n");
 #endif // USE_LOGGING
   }
+  else
+  {
+    channelAdd( "dhtTemp", dhtTemp );
+    channelAdd( "dhtHumidity", dhtHumidity );
+  }
+}
 #endif // USE_DHT
 
- 
 #ifdef USE_BMP085
-  // check for next read interval has reached
-  if( (millis() - lastBMPCycle) >= BMP_READINTVAL )
-  {
-    lastBMPCycle = millis();
+void readBMP( void *arg )
+{
+  channelAdd( "bmpTemp", bmp.readTemperature() );
+  channelAdd( "bmpPressure", bmp.readPressure() / 100.0 );    // hPa
+
 #ifdef USE_LOGGING
-    Logger.Log(LOGLEVEL_DEBUG, "Temperature = %f *C\n", bmp.readTemperature());
-    Logger.Log(LOGLEVEL_DEBUG, "Pressure = %d Pa\n", bmp.readPressure());
+  Logger.Log(LOGLEVEL_DEBUG, "Temperature = %f *C\n", bmp.readTemperature());
+  Logger.Log(LOGLEVEL_DEBUG, "Pressure = %d Pa\n", bmp.readPressure());
 #endif // USE_LOGGING
-    // Calculate altitude assuming 'standard' barometric
-    // pressure of 1013.25 millibar = 101325 Pascal
+  // Calculate altitude assuming 'standard' barometric
+  // pressure of 1013.25 millibar = 101325 Pascal
 #ifdef USE_LOGGING
-    Logger.Log(LOGLEVEL_DEBUG, "Altitude = %f meters\n", bmp.readAltitude());
-    Logger.Log(LOGLEVEL_DEBUG, "Pressure at sealevel (calculated) = %d Pa\n", bmp.readSealevelPressure());
+  Logger.Log(LOGLEVEL_DEBUG, "Altitude = %f meters\n", bmp.readAltitude());
+  Logger.Log(LOGLEVEL_DEBUG, "Pressure at sealevel (calculated) = %d Pa\n", bmp.readSealevelPressure());
 #endif // USE_LOGGING
-    // you can get a more precise measurement of altitude
-    // if you know the current sea level pressure which will
-    // vary with weather and such. If it is 1015 millibars
-    // that is equal to 101500 Pascals.
+  // you can get a more precise measurement of altitude
+  // if you know the current sea level pressure which will
+  // vary with weather and such. If it is 1015 millibars
+  // that is equal to 101500 Pascals.
 #ifdef USE_LOGGING
-    Logger.Log(LOGLEVEL_DEBUG, "Real altitude = %f meters\n", bmp.readAltitude(101500));
+  Logger.Log(LOGLEVEL_DEBUG, "Real altitude = %f meters\n", bmp.readAltitude(101500));
 #endif // USE_LOGGING
-  }
+}
 #endif // USE_BMP085
 
+//
+// ************************************************************************
+// main loop is quite simple ...
+// - the scheduler runs at most one due sensor task per loop, the
+//   webserver is served in between
+// - the rest of the time until the next task is idle
+// ************************************************************************
+//
+void loop() 
+{
+  Tasks.Run();
+
   server.handleClient();
 
+  Tasks.Idle(LOOP_MAX_IDLE);
 }
 
 // -------------------------------- nothing behind this line ------------------------------------------
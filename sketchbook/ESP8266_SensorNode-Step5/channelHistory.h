@@ -0,0 +1,262 @@
+//
+// ************************************************************************
+// channelHistory
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   History of one measured value (a channel), e.g. the temperature of
+//   a sensor. The last CHANNEL_HISTORY_LEN samples are kept in a ring
+//   with their unix time.
+//
+//   Min, max and mean of the ring and an EWMA are kept up to date with
+//   each sample instead of being computed from the ring: the sum is
+//   corrected by the sample that drops out, min/max are searched again
+//   only if that sample was the min resp. the max.
+//
+//   Besides, a window collects count, sum, min and max of the samples
+//   since it was taken last, e.g. to send one aggregate per minute.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/31: initial version
+//
+//
+// ************************************************************************
+
+#ifndef _CHANNEL_HISTORY_H_
+#define _CHANNEL_HISTORY_H_
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// samples kept per channel
+
+#ifndef CHANNEL_HISTORY_LEN
+#define CHANNEL_HISTORY_LEN       120
+#endif
+
+#define CHANNEL_NAME_MAX           11
+
+struct channelSample {
+    unsigned long time;
+    float value;
+};
+
+// aggregate of several samples
+
+struct channelAggregate {
+    unsigned long time;            // time of the first sample
+    unsigned int count;
+    float sum;
+    float min;
+    float max;
+};
+
+class channelHistory {
+private:
+    char _name[CHANNEL_NAME_MAX + 1];
+    channelSample _ring[CHANNEL_HISTORY_LEN];
+    int _head;
+    int _count;
+    double _sum;                   // of the ring, double to keep the
+                                   // subtractions exact enough
+    float _min;
+    float _max;
+    float _ewma;
+    float _alpha;
+    float _last;
+    unsigned long _lastMillis;     // millis() of the last value, 0 none
+    channelAggregate _window;
+
+    static void aggregateAdd(channelAggregate *agg, unsigned long time, float value)
+    {
+        if( agg->count == 0 )
+        {
+            agg->time = time;
+            agg->sum = 0;
+            agg->min = value;
+            agg->max = value;
+        }
+
+        agg->count++;
+        agg->sum += value;
+
+        if( value < agg->min )
+        {
+            agg->min = value;
+        }
+
+        if( value > agg->max )
+        {
+            agg->max = value;
+        }
+    }
+
+    void rescan()
+    {
+        _min = _max = At(0)->value;
+
+        for( int i = 1; i < _count; i++ )
+        {
+            if( At(i)->value < _min )
+            {
+                _min = At(i)->value;
+            }
+
+            if( At(i)->value > _max )
+            {
+                _max = At(i)->value;
+            }
+        }
+    }
+
+public:
+    channelHistory()
+    {
+        Begin("", 0.1);
+    };
+
+    //
+    // start a new channel. alpha is the weight of a new sample in the
+    // EWMA, 0 < alpha <= 1.
+    //
+    void Begin(const char *name, float alpha)
+    {
+        strncpy(_name, name, CHANNEL_NAME_MAX);
+        _name[CHANNEL_NAME_MAX] = '\0';
+        _head = 0;
+        _count = 0;
+        _sum = 0;
+        _min = 0;
+        _max = 0;
+        _ewma = 0;
+        _alpha = alpha;
+        _last = 0;
+        _lastMillis = 0;
+        _window.count = 0;
+    };
+
+    //
+    // a new value. It goes to the ring and the window only with a valid
+    // time, the last value is kept anyway.
+    //
+    void Add(unsigned long time, float value, bool timeValid = true)
+    {
+        channelSample *sample;
+        bool search = false;
+
+        _ewma = _lastMillis == 0 ? value : _ewma + _alpha * (value - _ewma);
+        _last = value;
+        _lastMillis = millis();
+
+        // 0 is "no value" for _lastMillis
+        if( _lastMillis == 0 )
+        {
+            _lastMillis = 1;
+        }
+
+        if( timeValid )
+        {
+            if( _count == CHANNEL_HISTORY_LEN )
+            {
+                sample = &_ring[_head];
+                _sum -= sample->value;
+                search = sample->value <= _min || sample->value >= _max;
+                _head = (_head + 1) % CHANNEL_HISTORY_LEN;
+                _count--;
+            }
+
+            sample = &_ring[(_head + _count++) % CHANNEL_HISTORY_LEN];
+            sample->time = time;
+            sample->value = value;
+            _sum += value;
+
+            if( search || _count == 1 )
+            {
+                rescan();
+            }
+            else
+            {
+                _min = value < _min ? value : _min;
+                _max = value > _max ? value : _max;
+            }
+
+            aggregateAdd(&_window, time, value);
+        }
+    };
+
+    //
+    // the samples since the last call, false if there are none
+    //
+    bool TakeWindow(channelAggregate *window)
+    {
+        bool retVal = _window.count > 0;
+
+        *window = _window;
+        _window.count = 0;
+
+        return( retVal );
+    };
+
+    //
+    // sample idx of the ring, 0 is the oldest
+    //
+    const channelSample *At(int idx)
+    {
+        return( &_ring[(_head + idx) % CHANNEL_HISTORY_LEN] );
+    };
+
+    //
+    // aggregate the samples from idx on that fall into the same step
+    // seconds, aligned to multiples of step. Returns the index of the
+    // next sample. Called with 0 first, done when Count() is returned.
+    //
+    int Downsample(int idx, unsigned long step, channelAggregate *agg)
+    {
+        unsigned long slot = At(idx)->time - At(idx)->time % step;
+
+        agg->count = 0;
+
+        while( idx < _count && At(idx)->time - At(idx)->time % step == slot )
+        {
+            aggregateAdd(agg, At(idx)->time, At(idx)->value);
+            idx++;
+        }
+        agg->time = slot;
+
+        return( idx );
+    };
+
+    const char *Name() { return( _name ); };
+    int Count() { return( _count ); };
+    float Min() { return( _min ); };
+    float Max() { return( _max ); };
+    float Mean() { return( _count > 0 ? _sum / _count : 0 ); };
+    float Ewma() { return( _ewma ); };
+    float Last() { return( _last ); };
+    bool HasValue() { return( _lastMillis != 0 ); };
+    unsigned long LastMillis() { return( _lastMillis ); };
+};
+
+#endif // _CHANNEL_HISTORY_H_
@@ -0,0 +1,1266 @@
+//
+// ************************************************************************
+// dataSink
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Sinks the samples of the SensorNode are sent to. Each sink has its
+//   own queue, rate, retry backoff and spool file, so a server that is
+//   down does not hold back the others. The spool files are kept on
+//   the SD card resp. in SPIFFS without SD_SUPPORT, see dataSpoolFs.
+//
+//   dataSink keeps the queue and runs as task of a SimpleTask scheduler.
+//   A protocol only implements Publish(), that starts sending a batch
+//   of samples, and Poll(), that tells if the batch was accepted. The
+//   samples are removed only then, after a failure the batch is sent
+//   again after the backoff.
+//
+//   dataHttpSink sends a batch as POST request without waiting for the
+//   answer, emoncmsSink and influxSink format the body for the EMONCMS
+//   bulk input API resp. the InfluxDB line protocol. mqttSink publishes
+//   each sample on a kept MQTT connection (USE_MQTT, needs PubSubClient).
+//
+//   The header is included by the sketch after its configuration, it
+//   uses SD_SUPPORT and USE_MQTT from there. Queues and buffers are
+//   supplied by the sketch, it mounts SPIFFS resp. the SD card, too.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/31: initial version
+// 2017/01/01: answers are read up to their end, the trailer of a
+//             chunked one, too. A body ended by the closed connection
+//             without newline is taken.
+// 2017/01/01: connects to the MQTT broker are rate limited
+// 2017/01/01: spool in SPIFFS without SD card
+// 2017/01/01: a connect to a HTTP server is limited in time and rate
+// 2017/01/01: Reconnect() after a change of the settings
+// 2017/01/01: a connect to the MQTT broker is limited in time, too
+//
+//
+// ************************************************************************
+
+#ifndef _DATA_SINK_H_
+#define _DATA_SINK_H_
+
+#include <ESP8266WiFi.h>
+#include <SimpleTask.h>
+
+#ifdef SD_SUPPORT
+#include <SD.h>
+#else
+#include <FS.h>
+#endif // SD_SUPPORT
+
+#ifdef USE_MQTT
+#include <PubSubClient.h>
+#endif // USE_MQTT
+
+#define DATA_SAMPLE_INPUT_MAX        15    // max. length of an input name
+
+#define DATA_SINK_SPOOL_BATCH        16    // samples read from the spool at once
+#define DATA_SINK_SPOOL_LINE         48    // max. length of a line in the spool
+#define DATA_SINK_POLL_INTVAL        10    // ms between checks for the answer
+#define DATA_SINK_DRAIN_INTVAL     1000    // next batch while a backlog is sent
+#define DATA_SINK_TIMEOUT          5000    // max. ms to wait for the answer
+#define DATA_SINK_HTTP_LINE         128    // longer lines of an answer are cut
+#define DATA_SINK_CONNECT_TIMEOUT  2000    // max. ms a connect may block
+#define DATA_SINK_HTTP_RECONNECT  30000    // min. ms after a failed connect
+#define DATA_SINK_MQTT_RECONNECT  30000    // min. ms between connects to the broker
+#define DATA_SINK_MQTT_SOCKET_TIMEOUT  2    // max. s to wait for the broker
+
+// results of Poll() resp. of the last batch
+
+#define DATA_SINK_BUSY                1
+#define DATA_SINK_OK                  0
+#define DATA_SINK_ERR_CONNECT        -1
+#define DATA_SINK_ERR_TIMEOUT        -2
+#define DATA_SINK_ERR_RESPONSE       -3
+#define DATA_SINK_ERR_REJECTED       -4
+
+// a value with the unix time it was sampled at
+
+struct dataSample {
+    unsigned long time;
+    float value;
+    char input[DATA_SAMPLE_INPUT_MAX + 1];
+};
+
+struct dataSinkStats {
+    unsigned long queued;
+    unsigned long sent;
+    unsigned long spooled;         // samples written to the spool
+    unsigned long dropped;         // samples lost, queue full and no spool
+    unsigned long posts;
+    unsigned long failures;
+};
+
+// ************************************************************************
+// the file system of the spool files. Both SD and SPIFFS hand out a
+// File the spool is read and written with, they differ in opening and
+// removing it only.
+// ************************************************************************
+
+struct dataSpoolFs {
+    static File Open(const char *path, bool append)
+    {
+#ifdef SD_SUPPORT
+        return( SD.open(path, append ? FILE_WRITE : FILE_READ) );
+#else
+        return( SPIFFS.open(path, append ? "a" : "r") );
+#endif // SD_SUPPORT
+    }
+
+    static bool Remove(const char *path)
+    {
+#ifdef SD_SUPPORT
+        return( SD.remove(path) );
+#else
+        return( SPIFFS.remove(path) );
+#endif // SD_SUPPORT
+    }
+};
+
+class dataSink {
+private:
+    const char *_name;
+    SimpleTask *_tasks;
+    int _taskId;
+    unsigned long _interval;
+    unsigned long _backoffMax;
+    unsigned long _backoff;        // ms to the next try after a failure
+
+    // samples not sent yet, oldest first. If the queue is full, the
+    // older half goes to the spool file resp. is dropped without one.
+    // The spool is sent before the queue.
+    dataSample *_queue;
+    int _queueLen;
+    int _head;
+    int _count;
+
+    const char *_spoolFile;
+    unsigned long _spoolPos;       // first line of the spool not sent
+    dataSample _spoolBuf[DATA_SINK_SPOOL_BATCH];
+    unsigned long _spoolEnds[DATA_SINK_SPOOL_BATCH];
+
+    // the batch in flight
+    bool _busy;
+    bool _fromSpool;
+    int _taken;                    // samples of the batch
+    int _fromQueue;                // of these still in the queue
+    bool _more;                    // queue had samples behind the batch
+    unsigned long _start;
+
+    dataSinkStats _stats;
+    int _result;
+    int _lastSamples;
+    unsigned long _lastMillis;     // millis() of the completion
+    unsigned long _lastDuration;
+
+    dataSample *at(int idx)
+    {
+        return( &_queue[(_head + idx) % _queueLen] );
+    }
+
+    void remove(int count)
+    {
+        _head = (_head + count) % _queueLen;
+        _count -= count;
+    }
+
+    //
+    // append the oldest samples to the spool, one line "time,input,value"
+    // each
+    //
+    int spoolWrite(int count)
+    {
+        File spool;
+        char str_temp[16];
+        int retVal = 0;
+
+        if( _spoolFile != NULL && (spool = dataSpoolFs::Open(_spoolFile, true)) )
+        {
+            for( retVal = 0; retVal < count; retVal++ )
+            {
+                dtostrf(at(retVal)->value, 1, 2, str_temp);
+                spool.printf("%lu,%s,%s\n", at(retVal)->time, at(retVal)->input, str_temp);
+            }
+            spool.close();
+        }
+
+        return( retVal );
+    }
+
+    //
+    // read the oldest samples of the spool into _spoolBuf, lines that
+    // can not be parsed are skipped
+    //
+    int spoolRead()
+    {
+        File spool;
+        char line[DATA_SINK_SPOOL_LINE + 1];
+        char *input, *value;
+        int len;
+        int retVal = 0;
+
+        if( SpoolPending() > 0 && (spool = dataSpoolFs::Open(_spoolFile, false)) )
+        {
+            spool.seek(_spoolPos);
+
+            while( retVal < DATA_SINK_SPOOL_BATCH && spool.available() )
+            {
+                len = spool.readBytesUntil('\n', line, DATA_SINK_SPOOL_LINE);
+                line[len] = '\0';
+
+                if( (input = strchr(line, ',')) != NULL &&
+                    (value = strchr(input + 1, ',')) != NULL )
+                {
+                    *input++ = '\0';
+                    *value++ = '\0';
+                    _spoolBuf[retVal].time = strtoul(line, NULL, 10);
+                    _spoolBuf[retVal].value = atof(value);
+                    strncpy(_spoolBuf[retVal].input, input, DATA_SAMPLE_INPUT_MAX);
+                    _spoolBuf[retVal].input[DATA_SAMPLE_INPUT_MAX] = '\0';
+                    _spoolEnds[retVal++] = spool.position();
+                }
+                else if( retVal == 0 )
+                {
+                    _spoolPos = spool.position();
+                }
+            }
+            spool.close();
+        }
+
+        return( retVal );
+    }
+
+    //
+    // remove the first count samples of the batch
+    //
+    void skip(int count)
+    {
+        if( _fromSpool )
+        {
+            _spoolPos = _spoolEnds[count - 1];
+
+            if( SpoolPending() == 0 )
+            {
+                dataSpoolFs::Remove(_spoolFile);
+                _spoolPos = 0;
+            }
+        }
+        else
+        {
+            remove(count);
+        }
+    }
+
+    //
+    // true if there are more samples than the next interval should wait for
+    //
+    bool backlog()
+    {
+        return( _more || _count > _queueLen / 2 || SpoolPending() > 0 );
+    }
+
+    void schedule(unsigned long delayMillis)
+    {
+        if( _tasks != NULL )
+        {
+            _tasks->Cancel(_taskId);
+            _taskId = _tasks->After(delayMillis, task, this, _name);
+        }
+    }
+
+    //
+    // the batch is done. A backlog is sent batch by batch, after a
+    // failure the interval doubles up to backoffMax.
+    //
+    void complete(int result)
+    {
+        unsigned long next = _interval;
+
+        _busy = false;
+        _result = result;
+        _lastSamples = _taken;
+        _lastMillis = millis();
+        _lastDuration = _lastMillis - _start;
+
+        if( result == DATA_SINK_OK )
+        {
+            _stats.sent += _taken;
+            skip(_fromSpool ? _taken : _fromQueue);
+            _backoff = 0;
+
+            if( backlog() )
+            {
+                next = DATA_SINK_DRAIN_INTVAL;
+            }
+        }
+        else
+        {
+            _stats.failures++;
+            _backoff = _backoff == 0 ? _interval : 2 * _backoff;
+
+            if( _backoff > _backoffMax )
+            {
+                _backoff = _backoffMax;
+            }
+            next = _backoff;
+        }
+
+        schedule(next);
+    }
+
+    //
+    // send the oldest samples. The spool is sent first, from the queue
+    // only the part up to its wrap is taken at once.
+    //
+    void start()
+    {
+        const dataSample *samples = NULL;
+        int count = 0;
+
+        _fromSpool = false;
+
+        if( (count = spoolRead()) > 0 )
+        {
+            samples = _spoolBuf;
+            _fromSpool = true;
+        }
+
+        if( count == 0 && _count > 0 )
+        {
+            samples = at(0);
+            count = min(_count, _queueLen - _head);
+        }
+
+        if( count == 0 )
+        {
+            schedule(_interval);
+        }
+        else
+        {
+            _start = millis();
+            _taken = Publish(samples, count);
+
+            if( _taken > 0 )
+            {
+                _fromQueue = _fromSpool ? 0 : _taken;
+                _more = !_fromSpool && _taken < _count;
+                _stats.posts++;
+                _busy = true;
+                schedule(DATA_SINK_POLL_INTVAL);
+            }
+            else
+            {
+                // the sink can not take the oldest sample at all
+                skip(1);
+                _stats.dropped++;
+                schedule(0);
+            }
+        }
+    }
+
+    void run()
+    {
+        int result;
+
+        // the running task is free again when run() returns
+        _taskId = -1;
+        Service();
+
+        if( _busy )
+        {
+            if( (result = Poll()) != DATA_SINK_BUSY )
+            {
+                complete(result);
+            }
+            else if( millis() - _start > DATA_SINK_TIMEOUT )
+            {
+                Abort();
+                complete(DATA_SINK_ERR_TIMEOUT);
+            }
+            else
+            {
+                schedule(DATA_SINK_POLL_INTVAL);
+            }
+        }
+        else
+        {
+            start();
+        }
+    }
+
+    static void task(void *arg)
+    {
+        ((dataSink *) arg)->run();
+    }
+
+protected:
+    //
+    // start to send samples[0..count-1], oldest first. Returns the number
+    // of samples taken into the batch, 0 if the first one can not be sent
+    // at all. The result is reported by Poll().
+    //
+    virtual int Publish(const dataSample *samples, int count) = 0;
+
+    //
+    // DATA_SINK_BUSY while the batch is sent, then DATA_SINK_OK if it
+    // was accepted resp. DATA_SINK_ERR_*
+    //
+    virtual int Poll() = 0;
+
+    //
+    // give up the batch, e.g. after DATA_SINK_TIMEOUT
+    //
+    virtual void Abort() {};
+
+    //
+    // called each time the task runs, e.g. to keep a connection alive
+    //
+    virtual void Service() {};
+
+public:
+    dataSink(const char *name, dataSample *queue, int queueLen,
+             unsigned long interval, unsigned long backoffMax)
+    {
+        _name = name;
+        _tasks = NULL;
+        _taskId = -1;
+        _interval = interval;
+        _backoffMax = backoffMax;
+        _backoff = 0;
+        _queue = queue;
+        _queueLen = queueLen;
+        _head = 0;
+        _count = 0;
+        _spoolFile = NULL;
+        _spoolPos = 0;
+        _busy = false;
+        _fromSpool = false;
+        _taken = 0;
+        _fromQueue = 0;
+        _more = false;
+        _start = 0;
+        memset(&_stats, 0, sizeof(_stats));
+        _result = DATA_SINK_OK;
+        _lastSamples = 0;
+        _lastMillis = 0;
+        _lastDuration = 0;
+    };
+
+    //
+    // start sending, the first batch after the interval. Without a
+    // spool file samples are dropped if the queue is full.
+    //
+    void Begin(SimpleTask *tasks, const char *spoolFile = NULL)
+    {
+        _tasks = tasks;
+        _spoolFile = spoolFile;
+        schedule(_interval);
+    };
+
+    //
+    // queue a sample, makes room if the queue is full
+    //
+    void Add(unsigned long time, const char *input, float value)
+    {
+        dataSample *sample;
+        int removed = 0;
+
+        if( _count == _queueLen )
+        {
+            removed = spoolWrite(_queueLen / 2);
+            _stats.spooled += removed;
+
+            if( removed == 0 )
+            {
+                removed = 1;
+                _stats.dropped++;
+            }
+
+            remove(removed);
+
+            // the batch in flight begins with the removed samples
+            if( _busy && !_fromSpool )
+            {
+                _fromQueue -= min(removed, _fromQueue);
+            }
+        }
+
+        sample = at(_count++);
+        sample->time = time;
+        sample->value = value;
+        strncpy(sample->input, input, DATA_SAMPLE_INPUT_MAX);
+        sample->input[DATA_SAMPLE_INPUT_MAX] = '\0';
+
+        _stats.queued++;
+    };
+
+    //
+    // send the queue now, does not wait for the result
+    //
+    void Flush()
+    {
+        if( !_busy )
+        {
+            schedule(0);
+        }
+    };
+
+    //
+    // host or port were changed, the next batch opens a new connection
+    // and a server that failed before is tried at once
+    //
+    virtual void Reconnect() {};
+
+    //
+    // state for the web pages
+    //
+    const char *Name() { return( _name ); };
+    int QueueCount() { return( _count ); };
+    bool Busy() { return( _busy ); };
+    const dataSinkStats *Stats() { return( &_stats ); };
+    int LastResult() { return( _result ); };
+    int LastSamples() { return( _lastSamples ); };
+    unsigned long LastMillis() { return( _lastMillis ); };
+    unsigned long LastDuration() { return( _lastDuration ); };
+
+    //
+    // bytes of the spool not sent yet
+    //
+    unsigned long SpoolPending()
+    {
+        unsigned long retVal = 0;
+        File spool;
+
+        if( _spoolFile != NULL && (spool = dataSpoolFs::Open(_spoolFile, false)) )
+        {
+            if( spool.size() > _spoolPos )
+            {
+                retVal = spool.size() - _spoolPos;
+            }
+            spool.close();
+        }
+
+        return( retVal );
+    };
+
+    //
+    // protocol specific code of the last batch, e.g. the HTTP status
+    //
+    virtual int Code() { return( 0 ); };
+};
+
+// ************************************************************************
+// a batch is the body of a POST request. The request is sent at once,
+// the answer is read by Poll() while the sketch goes on.
+// ************************************************************************
+
+class dataHttpSink : public dataSink {
+private:
+    enum {
+        HTTP_CONNECT_FAILED,
+        HTTP_STATUS,
+        HTTP_HEADER,
+        HTTP_CHUNK_SIZE,
+        HTTP_BODY,
+        HTTP_CHUNK_END,            // CRLF behind the data of a chunk
+        HTTP_TRAILER,              // lines behind the last chunk
+        HTTP_DONE
+    } _state;
+    long _contentLength;           // -1 unknown
+    long _chunkLeft;               // bytes of the chunk not read yet
+    bool _chunkExt;                // in the extension of a chunk size line
+    bool _chunked;
+    bool _close;                   // server closes the connection
+    char _line[DATA_SINK_HTTP_LINE + 1];
+    int _lineLen;
+
+    const String &_host;
+    const String &_port;
+
+    unsigned long _lastFailed;     // millis() of the last failed connect
+    bool _connectFailed;
+    bool _reconnect;               // settings changed, drop the connection
+
+    // kept to reuse the connection (keep-alive) for the next batch
+    WiFiClient _client;
+
+    //
+    // WiFiClient::connect() blocks the sketch until the server answers
+    // or the timeout is over. A server that is down is tried again
+    // once per DATA_SINK_HTTP_RECONNECT only, however short the interval
+    // and the backoff of the sink are, e.g. after Flush().
+    //
+    bool connect()
+    {
+        if( _reconnect )
+        {
+            _reconnect = false;
+            _connectFailed = false;
+            _client.stop();
+        }
+
+        if( !_client.connected() &&
+            (!_connectFailed || millis() - _lastFailed >= DATA_SINK_HTTP_RECONNECT) )
+        {
+            _client.setTimeout(DATA_SINK_CONNECT_TIMEOUT);
+
+            if( (_connectFailed = !_client.connect(_host.c_str(), _port.toInt())) )
+            {
+                _lastFailed = millis();
+            }
+        }
+
+        return( _client.connected() );
+    }
+
+    //
+    // _line is complete, drop the CR of a CRLF
+    //
+    char *endLine()
+    {
+        if( _lineLen > 0 && _line[_lineLen - 1] == '\r' )
+        {
+            _lineLen--;
+        }
+        _line[_lineLen] = '\0';
+        _lineLen = 0;
+
+        return( _line );
+    }
+
+    //
+    // the body has ended, a last line without newline is passed on, too
+    //
+    void bodyEnd()
+    {
+        if( _lineLen > 0 )
+        {
+            BodyLine(endLine());
+        }
+    }
+
+    //
+    // a complete line of the status, the header or the trailer
+    //
+    void responseLine(char *line)
+    {
+        switch( _state )
+        {
+            case HTTP_STATUS:
+                if( strncmp(line, "HTTP/", 5) == 0 && strchr(line, ' ') != NULL )
+                {
+                    _code = atoi(strchr(line, ' ') + 1);
+                }
+                _state = HTTP_HEADER;
+                break;
+            case HTTP_HEADER:
+                if( line[0] == '\0' )
+                {
+                    if( _chunked )
+                    {
+                        _chunkLeft = 0;
+                        _chunkExt = false;
+                        _state = HTTP_CHUNK_SIZE;
+                    }
+                    else
+                    {
+                        _state = _contentLength == 0 ? HTTP_DONE : HTTP_BODY;
+                    }
+                }
+                else if( strncasecmp(line, "Content-Length:", 15) == 0 )
+                {
+                    _contentLength = atol(&line[15]);
+                }
+                else if( strncasecmp(line, "Transfer-Encoding:", 18) == 0 )
+                {
+                    _chunked = strstr(&line[18], "chunked") != NULL;
+                }
+                else if( strncasecmp(line, "Connection:", 11) == 0 )
+                {
+                    _close = strstr(&line[11], "close") != NULL;
+                }
+                break;
+            case HTTP_TRAILER:
+                // the empty line ends the answer, the connection is
+                // then ready for the next request
+                if( line[0] == '\0' )
+                {
+                    _state = HTTP_DONE;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    //
+    // a character of the answer, true if the answer is complete. The
+    // body is split into lines across chunks, its end is known from
+    // Content-Length, the last chunk or the closed connection.
+    //
+    bool responseChar(char c)
+    {
+        int digit;
+
+        switch( _state )
+        {
+            case HTTP_CHUNK_SIZE:
+                digit = isdigit(c) ? c - '0' : (isxdigit(c) ? tolower(c) - 'a' + 10 : -1);
+
+                if( c == '\n' )
+                {
+                    if( _chunkLeft > 0 )
+                    {
+                        _state = HTTP_BODY;
+                    }
+                    else
+                    {
+                        bodyEnd();
+                        _state = HTTP_TRAILER;
+                    }
+                }
+                else if( c == ';' )
+                {
+                    _chunkExt = true;
+                }
+                else if( digit >= 0 && !_chunkExt )
+                {
+                    _chunkLeft = _chunkLeft * 16 + digit;
+                }
+                break;
+            case HTTP_BODY:
+                if( c == '\n' )
+                {
+                    BodyLine(endLine());
+                }
+                else if( _lineLen < DATA_SINK_HTTP_LINE )
+                {
+                    _line[_lineLen++] = c;
+                }
+
+                if( _chunked )
+                {
+                    if( --_chunkLeft == 0 )
+                    {
+                        _state = HTTP_CHUNK_END;
+                    }
+                }
+                else if( _contentLength > 0 && --_contentLength == 0 )
+                {
+                    bodyEnd();
+                    _state = HTTP_DONE;
+                }
+                break;
+            case HTTP_CHUNK_END:
+                if( c == '\n' )
+                {
+                    _chunkLeft = 0;
+                    _chunkExt = false;
+                    _state = HTTP_CHUNK_SIZE;
+                }
+                break;
+            case HTTP_STATUS:
+            case HTTP_HEADER:
+            case HTTP_TRAILER:
+                if( c == '\n' )
+                {
+                    responseLine(endLine());
+                }
+                else if( _lineLen < DATA_SINK_HTTP_LINE )
+                {
+                    _line[_lineLen++] = c;
+                }
+                break;
+            default:
+                break;
+        }
+
+        return( _state == HTTP_DONE );
+    }
+
+    int result()
+    {
+        return( Accepted() ? DATA_SINK_OK : (_code > 0 ? DATA_SINK_ERR_REJECTED : DATA_SINK_ERR_RESPONSE) );
+    }
+
+protected:
+    char *_buf;
+    size_t _bufSize;
+    size_t _len;                   // length of the body in _buf
+    int _code;                     // HTTP status of the answer
+
+    //
+    // write the body for samples[0..count-1] to _buf, returns the number
+    // of samples that fit
+    //
+    virtual int Format(const dataSample *samples, int count) = 0;
+
+    //
+    // path and query of the request for the body in _buf
+    //
+    virtual String Path() = 0;
+
+    virtual const char *ContentType() = 0;
+
+    //
+    // a line of the body of the answer
+    //
+    virtual void BodyLine(const char *line) {};
+
+    //
+    // true if the server has stored the batch
+    //
+    virtual bool Accepted()
+    {
+        return( _code >= 200 && _code < 300 );
+    };
+
+    int Publish(const dataSample *samples, int count)
+    {
+        int retVal = Format(samples, count);
+
+        if( retVal > 0 )
+        {
+            _state = HTTP_STATUS;
+            _code = 0;
+            _contentLength = -1;
+            _chunked = false;
+            _close = false;
+            _lineLen = 0;
+
+            // a kept connection is reused, unless there is something left
+            // of an earlier answer, it would be taken for this one
+            if( _client.connected() && _client.available() > 0 )
+            {
+                _client.stop();
+            }
+
+            if( connect() )
+            {
+                _client.print(String("POST ") + Path() + " HTTP/1.1\r\n" +
+                              "Host: " + _host + "\r\n" +
+                              "Content-Type: " + ContentType() + "\r\n" +
+                              "Content-Length: " + String(_len) + "\r\n" +
+                              "Connection: keep-alive\r\n\r\n");
+                _client.write((const uint8_t *) _buf, _len);
+            }
+            else
+            {
+                _state = HTTP_CONNECT_FAILED;
+            }
+        }
+
+        return( retVal );
+    }
+
+    int Poll()
+    {
+        int retVal = DATA_SINK_BUSY;
+        bool done = false;
+
+        if( _state == HTTP_CONNECT_FAILED )
+        {
+            retVal = DATA_SINK_ERR_CONNECT;
+        }
+        else
+        {
+            while( !done && _client.available() > 0 )
+            {
+                done = responseChar(_client.read());
+            }
+
+            if( done )
+            {
+                retVal = result();
+            }
+            else if( !_client.connected() )
+            {
+                // the end of a body without length is the closed connection
+                _close = true;
+
+                if( _state == HTTP_BODY && !_chunked && _contentLength < 0 )
+                {
+                    bodyEnd();
+                    retVal = result();
+                }
+                else
+                {
+                    retVal = DATA_SINK_ERR_RESPONSE;
+                }
+            }
+        }
+
+        if( retVal != DATA_SINK_BUSY && (retVal != DATA_SINK_OK || _close) )
+        {
+            _client.stop();
+        }
+
+        return( retVal );
+    }
+
+    void Abort()
+    {
+        _client.stop();
+    }
+
+public:
+    dataHttpSink(const char *name, dataSample *queue, int queueLen,
+                 unsigned long interval, unsigned long backoffMax,
+                 char *buffer, size_t bufferSize,
+                 const String &host, const String &port) :
+        dataSink(name, queue, queueLen, interval, backoffMax),
+        _host(host), _port(port)
+    {
+        _lastFailed = 0;
+        _connectFailed = false;
+        _reconnect = false;
+        _state = HTTP_DONE;
+        _contentLength = -1;
+        _chunkLeft = 0;
+        _chunkExt = false;
+        _chunked = false;
+        _close = false;
+        _lineLen = 0;
+        _buf = buffer;
+        _bufSize = bufferSize;
+        _len = 0;
+        _code = 0;
+    };
+
+    int Code() { return( _code ); };
+
+    //
+    // the batch in flight keeps its connection, the next one connects
+    //
+    void Reconnect() { _reconnect = true; };
+};
+
+// ************************************************************************
+// EMONCMS bulk input API. A row is [ offset, node, { "input": value, ... } ]
+// with the samples of one time, offset is relative to the time of the
+// first sample, which is sent as time parameter. url is the one of the
+// feed API, ".../feed/".
+// ************************************************************************
+
+#define EMONCMS_SINK_BULK_PATH    "input/bulk.json"   // relative to the API root
+
+class emoncmsSink : public dataHttpSink {
+private:
+    const String &_url;
+    const String &_apiKey;
+    int _node;
+    unsigned long _batchTime;      // time of the first sample
+    bool _ok;                      // body of the answer is "ok"
+
+protected:
+    int Format(const dataSample *samples, int count)
+    {
+        char item[DATA_SAMPLE_INPUT_MAX + 48];
+        char str_temp[16];
+        int len;
+        int retVal = 0;
+
+        _len = snprintf(_buf, _bufSize, "data=[");
+        _batchTime = samples[0].time;
+        _ok = false;
+
+        while( retVal < count )
+        {
+            /* 1 is mininum width, 2 is precision */
+            dtostrf(samples[retVal].value, 1, 2, str_temp);
+
+            if( retVal > 0 && samples[retVal].time == samples[retVal - 1].time )
+            {
+                len = snprintf(item, sizeof(item), ",\"%s\":%s",
+                               samples[retVal].input, str_temp);
+            }
+            else
+            {
+                len = snprintf(item, sizeof(item), "%s[%lu,%d,{\"%s\":%s",
+                               retVal > 0 ? "}]," : "",
+                               samples[retVal].time - _batchTime, _node,
+                               samples[retVal].input, str_temp);
+            }
+
+            // room for the closing "}]]" and the terminating zero
+            if( len >= (int) sizeof(item) || _len + len + 4 > _bufSize )
+            {
+                break;
+            }
+
+            strcpy(&_buf[_len], item);
+            _len += len;
+            retVal++;
+        }
+
+        if( retVal > 0 )
+        {
+            strcpy(&_buf[_len], "}]]");
+            _len += 3;
+        }
+
+        return( retVal );
+    }
+
+    String Path()
+    {
+        String retVal = _url;
+
+        if( retVal.endsWith("feed/") )
+        {
+            retVal.remove(retVal.length() - strlen("feed/"));
+        }
+        retVal += EMONCMS_SINK_BULK_PATH;
+        retVal += "?time=" + String(_batchTime);
+        retVal += "&apikey=" + _apiKey;
+
+        return( retVal );
+    }
+
+    const char *ContentType()
+    {
+        return( "application/x-www-form-urlencoded" );
+    }
+
+    void BodyLine(const char *line)
+    {
+        _ok = _ok || strncmp(line, "ok", 2) == 0;
+    }
+
+    //
+    // EMONCMS answers 200 to a bad key too, only "ok" means stored
+    //
+    bool Accepted()
+    {
+        return( _code == 200 && _ok );
+    }
+
+public:
+    emoncmsSink(const char *name, dataSample *queue, int queueLen,
+                unsigned long interval, unsigned long backoffMax,
+                char *buffer, size_t bufferSize,
+                const String &host, const String &port,
+                const String &url, const String &apiKey, int node) :
+        dataHttpSink(name, queue, queueLen, interval, backoffMax,
+                     buffer, bufferSize, host, port),
+        _url(url), _apiKey(apiKey)
+    {
+        _node = node;
+        _batchTime = 0;
+        _ok = false;
+    };
+};
+
+// ************************************************************************
+// InfluxDB line protocol, "measurement,node=N,input=I value=V time" per
+// sample. The server answers 204 if the batch is stored.
+// ************************************************************************
+
+class influxSink : public dataHttpSink {
+private:
+    const String &_database;
+    const char *_measurement;
+    int _node;
+
+protected:
+    int Format(const dataSample *samples, int count)
+    {
+        char str_temp[16];
+        int len;
+        int retVal = 0;
+
+        _len = 0;
+
+        while( retVal < count )
+        {
+            dtostrf(samples[retVal].value, 1, 2, str_temp);
+            len = snprintf(&_buf[_len], _bufSize - _len, "%s,node=%d,input=%s value=%s %lu\n",
+                           _measurement, _node, samples[retVal].input,
+                           str_temp, samples[retVal].time);
+
+            if( len < 0 || _len + len >= _bufSize )
+            {
+                _buf[_len] = '\0';
+                break;
+            }
+
+            _len += len;
+            retVal++;
+        }
+
+        return( retVal );
+    }
+
+    String Path()
+    {
+        return( String("/write?db=") + _database + "&precision=s" );
+    }
+
+    const char *ContentType()
+    {
+        return( "text/plain" );
+    }
+
+public:
+    influxSink(const char *name, dataSample *queue, int queueLen,
+               unsigned long interval, unsigned long backoffMax,
+               char *buffer, size_t bufferSize,
+               const String &host, const String &port,
+               const String &database, const char *measurement, int node) :
+        dataHttpSink(name, queue, queueLen, interval, backoffMax,
+                     buffer, bufferSize, host, port),
+        _database(database)
+    {
+        _measurement = measurement;
+        _node = node;
+    };
+};
+
+#ifdef USE_MQTT
+// ************************************************************************
+// MQTT, each sample is published to "<topic>/<input>" as
+// {"time":T,"value":V}. The connection is kept and serviced each time
+// the task runs. PubSubClient publishes with QoS 0, a batch counts as
+// accepted once it is written to the connection.
+// ************************************************************************
+
+class mqttSink : public dataSink {
+private:
+    const String &_host;
+    const String &_port;
+    const String &_topic;
+    const char *_clientId;
+    int _result;
+
+    unsigned long _lastConnect;    // millis() of the last connect
+    bool _connectTried;
+
+    WiFiClient _client;
+    PubSubClient _mqtt;
+
+    //
+    // PubSubClient::setSocketTimeout() exists from version 2.7 on, older
+    // ones wait MQTT_SOCKET_TIMEOUT (15 s) unless it is defined smaller
+    //
+    template <class T>
+    static auto socketTimeout(T &mqtt, int secs, int) -> decltype(mqtt.setSocketTimeout(secs), void())
+    {
+        mqtt.setSocketTimeout(secs);
+    }
+
+    template <class T>
+    static void socketTimeout(T &mqtt, int secs, long) {}
+
+    //
+    // PubSubClient::connect() blocks: the TCP connect to an unreachable
+    // broker inside WiFiClient, up to DATA_SINK_CONNECT_TIMEOUT, then up
+    // to DATA_SINK_MQTT_SOCKET_TIMEOUT for the CONNACK. Meanwhile neither
+    // the web server nor the other tasks run, so a lost broker is tried
+    // again once per DATA_SINK_MQTT_RECONNECT only, however short the
+    // interval and the backoff of the sink are.
+    //
+    bool connect()
+    {
+        if( !_mqtt.connected() &&
+            (!_connectTried || millis() - _lastConnect >= DATA_SINK_MQTT_RECONNECT) )
+        {
+            _connectTried = true;
+            _lastConnect = millis();
+            _client.setTimeout(DATA_SINK_CONNECT_TIMEOUT);
+            socketTimeout(_mqtt, DATA_SINK_MQTT_SOCKET_TIMEOUT, 0);
+            _mqtt.setServer(_host.c_str(), _port.toInt());
+            _mqtt.connect(_clientId);
+        }
+
+        return( _mqtt.connected() );
+    }
+
+protected:
+    int Publish(const dataSample *samples, int count)
+    {
+        char topic[80];
+        char payload[48];
+        char str_temp[16];
+        int retVal = 0;
+
+        _result = DATA_SINK_OK;
+        connect();
+
+        while( _mqtt.connected() && retVal < count )
+        {
+            dtostrf(samples[retVal].value, 1, 2, str_temp);
+            snprintf(topic, sizeof(topic), "%s/%s", _topic.c_str(), samples[retVal].input);
+            snprintf(payload, sizeof(payload), "{\"time\":%lu,\"value\":%s}",
+                     samples[retVal].time, str_temp);
+
+            if( !_mqtt.publish(topic, payload) )
+            {
+                break;
+            }
+            retVal++;
+        }
+
+        // nothing sent, the batch is tried again after the backoff
+        if( retVal == 0 )
+        {
+            _result = DATA_SINK_ERR_CONNECT;
+            _mqtt.disconnect();
+            retVal = count;
+        }
+
+        return( retVal );
+    }
+
+    int Poll()
+    {
+        return( _result );
+    }
+
+    void Service()
+    {
+        if( _mqtt.connected() )
+        {
+            _mqtt.loop();
+        }
+    }
+
+public:
+    mqttSink(const char *name, dataSample *queue, int queueLen,
+             unsigned long interval, unsigned long backoffMax,
+             const String &host, const String &port,
+             const String &topic, const char *clientId) :
+        dataSink(name, queue, queueLen, interval, backoffMax),
+        _host(host), _port(port), _topic(topic), _mqtt(_client)
+    {
+        _clientId = clientId;
+        _result = DATA_SINK_OK;
+        _lastConnect = 0;
+        _connectTried = false;
+    };
+
+    int Code() { return( _mqtt.state() ); };
+};
+#endif // USE_MQTT
+
+#endif // _DATA_SINK_H_
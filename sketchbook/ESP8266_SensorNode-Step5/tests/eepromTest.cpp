@@ -0,0 +1,265 @@
+//
+// ************************************************************************
+// SensorNode - host test of the EEPROM layout and the sensor table
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Checks the offsets of the records of the DS18B20 table and their
+//   fields against the layout defines: no record may overlap the
+//   settings in front of it, its neighbours or the end of the EEPROM.
+//   Records are stored, restored and cleared with the longest values
+//   the fields take, feeder ids are parsed like the web API does. The
+//   resolution of a sensor is kept in its record (Step5 only).
+//
+//   The functions are taken from the sketch by extract.py, see the
+//   Makefile, NODE_SKETCH selects Step5 resp. Step4. Build and run on
+//   a Linux host with "make test".
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/31: initial version
+// 2017/01/01: resolution of the sensor in the record, Step4 too
+//
+//
+// ************************************************************************
+//
+
+#include <stdio.h>
+#include <limits.h>
+#include "nodeStubs.h"
+
+#ifndef NODE_SKETCH
+#define NODE_SKETCH "nodeSketch.inc"
+#endif
+
+#include NODE_SKETCH
+
+static_assert( DATA_ENDPOS_EEPROM <= EEPROM_SIZE, "table does not fit into the EEPROM" );
+static_assert( EEPROM_SIZE <= sizeof(EEPROM.data), "EEPROM stub too small" );
+
+static int fails = 0;
+static int total = 0;
+
+static void expectTrue(const char *what, bool ok)
+{
+    total++;
+    if( !ok )
+    {
+        fails++;
+        printf("FAIL %s\n", what);
+    }
+}
+
+static void expectInt(const char *what, long result, long expected)
+{
+    total++;
+    if( result != expected )
+    {
+        fails++;
+        printf("FAIL %s: got %ld, expected %ld\n", what, result, expected);
+    }
+}
+
+static String repeat(char c, int len)
+{
+    return( String(std::string(len, c).c_str()) );
+}
+
+//
+// resolution of a record, only Step5 has one
+//
+static bool storeResolution(int recno, uint8_t bits)
+{
+#ifdef REC_POS_SENSOR_RESOLUTION
+    return( eeStoreSensorResolution(recno, bits) );
+#else
+    return( true );
+#endif
+}
+
+static bool resolutionRestored(int recno, uint8_t bits)
+{
+#ifdef REC_POS_SENSOR_RESOLUTION
+    return( eeRestoreSensorResolution(recno) == bits );
+#else
+    return( true );
+#endif
+}
+
+//
+// end of the last field of a record
+//
+static int recordFieldsEnd(int recno)
+{
+#ifdef REC_POS_SENSOR_RESOLUTION
+    return( eeSensorResolutionOffset(recno) >= eeSensorNameOffset(recno) + DATA_LEN_SENSOR_NAME ?
+            eeSensorResolutionOffset(recno) + DATA_LEN_SENSOR_RESOLUTION : INT_MAX );
+#else
+    return( eeSensorNameOffset(recno) + DATA_LEN_SENSOR_NAME );
+#endif
+}
+
+//
+// offsets of the records and of their fields
+//
+static void testOffsets()
+{
+    bool inside = true;
+    bool ordered = true;
+
+    expectInt("record -1", eeRecordOffset(-1), -1);
+    expectInt("record past the table", eeRecordOffset(MAX_DS18B20_ENTRIES), -1);
+    expectInt("field of record past the table",
+              eeSensorNameOffset(MAX_DS18B20_ENTRIES), -1);
+
+    expectInt("first record", eeRecordOffset(0), DATA_POS_DS18B20_FIRST_REC);
+    expectTrue("table behind the SHC feed format",
+               DATA_POS_DS18B20_TBL_BEGIN >= DATA_POS_SHC_FEED_FMT + DATA_LEN_SHC_FEED_FMT);
+    expectInt("end of the last record",
+              eeRecordOffset(MAX_DS18B20_ENTRIES - 1) + LEN_DS18B20_SENSOR_RECORD,
+              DATA_POS_DS18B20_TBL_END);
+
+    for( int recno = 0; recno < MAX_DS18B20_ENTRIES; recno++ )
+    {
+        int rec = eeRecordOffset(recno);
+
+        inside = inside &&
+                 eeValidationFlagOffset(recno) == rec &&
+                 eeSensorIdOffset(recno) >= rec + DATA_LEN_VALIDATION_FLAG &&
+                 eeFeederIdOffset(recno) >= eeSensorIdOffset(recno) + DATA_LEN_SENSOR_ID &&
+                 eeSensorNameOffset(recno) >= eeFeederIdOffset(recno) + DATA_LEN_SENSOR_FEEDER_ID &&
+                 recordFieldsEnd(recno) <= rec + LEN_DS18B20_SENSOR_RECORD;
+
+        if( recno > 0 )
+        {
+            ordered = ordered &&
+                      rec == eeRecordOffset(recno - 1) + LEN_DS18B20_SENSOR_RECORD;
+        }
+    }
+
+    expectTrue("fields inside their record", inside);
+    expectTrue("records back to back", ordered);
+}
+
+//
+// store, restore and clear records with values of maximum length
+//
+static void testRecords()
+{
+    String sensorId, feederId, name;
+    String longId = repeat('a', LEN_DS18B20_ID_MAX);
+    String longFeeder = repeat('9', LEN_DS18B20_FEEDER_ID_MAX);
+    String longName = repeat('n', LEN_DS18B20_NAME_MAX);
+    String fmt;
+    bool restored = true;
+
+    memset(EEPROM.data, 0, sizeof(EEPROM.data));
+
+    // settings in front of the table must survive the table
+    fmt = repeat('f', LEN_SHC_FEED_FMT_MAX);
+    eeStoreString(fmt, DATA_POS_SHC_FEED_FMT);
+
+    expectInt("empty table", eeRestoreTableEntries(), 0);
+    expectTrue("restore of an empty record fails",
+               !eeRestoreSensorRecord(0, sensorId, feederId, name));
+
+    for( int recno = 0; recno < MAX_DS18B20_ENTRIES; recno++ )
+    {
+        expectTrue("store record", eeStoreSensorRecord(recno, longId, longFeeder, longName) &&
+                                   storeResolution(recno, 9 + recno % 4));
+    }
+
+    expectInt("entries", eeRestoreTableEntries(), MAX_DS18B20_ENTRIES);
+    expectInt("outside of the EEPROM", EEPROM.outside, 0);
+
+    for( int recno = 0; recno < MAX_DS18B20_ENTRIES; recno++ )
+    {
+        restored = restored &&
+                   eeRestoreSensorRecord(recno, sensorId, feederId, name) &&
+                   sensorId == longId && feederId == longFeeder && name == longName &&
+                   resolutionRestored(recno, 9 + recno % 4);
+    }
+
+    expectTrue("records restored", restored);
+
+    eeRestoreString(fmt, DATA_POS_SHC_FEED_FMT, LEN_SHC_FEED_FMT_MAX);
+    expectTrue("SHC feed format kept", fmt == repeat('f', LEN_SHC_FEED_FMT_MAX));
+
+    expectTrue("too long feeder id refused",
+               !eeStoreSensorRecord(0, longId, repeat('1', LEN_DS18B20_FEEDER_ID_MAX + 1), longName));
+    expectTrue("too long name refused",
+               !eeStoreSensorRecord(0, longId, longFeeder, repeat('n', LEN_DS18B20_NAME_MAX + 1)));
+    expectTrue("record past the table refused",
+               !eeStoreSensorRecord(MAX_DS18B20_ENTRIES, longId, longFeeder, longName));
+    expectTrue("record without feeder id", eeStoreSensorRecord(6, longId, "", "") &&
+                                           eeRestoreSensorRecord(6, sensorId, feederId, name) &&
+                                           feederId.length() == 0);
+
+    expectTrue("clear record", eeClearSensorRecord(3));
+    expectTrue("cleared record is gone", !eeRestoreSensorRecord(3, sensorId, feederId, name));
+#ifdef REC_POS_SENSOR_RESOLUTION
+    expectTrue("resolution of 13 bits refused", !eeStoreSensorResolution(0, 13));
+    expectInt("no resolution of a cleared record", eeRestoreSensorResolution(3), 0);
+    expectTrue("resolution of a cleared record refused", !eeStoreSensorResolution(3, 10));
+#endif
+    expectTrue("neighbour kept", eeRestoreSensorRecord(4, sensorId, feederId, name) &&
+                                 feederId == longFeeder);
+
+    // records of the old layouts have another validation flag
+    EEPROM.write(eeValidationFlagOffset(5), 0x01);
+    expectTrue("record of the old layout ignored",
+               !eeRestoreSensorRecord(5, sensorId, feederId, name));
+    EEPROM.write(eeValidationFlagOffset(7), 0xA5);
+    expectTrue("record without resolution ignored",
+               !eeRestoreSensorRecord(7, sensorId, feederId, name));
+}
+
+//
+// feeder ids of the web API
+//
+static void testFeederIds()
+{
+    char buf[16];
+
+    snprintf(buf, sizeof(buf), "%d", INT_MAX);
+
+    expectInt("feeder id 26", serParseFeederId("26"), 26);
+    expectInt("feeder id 100", serParseFeederId("100"), 100);
+    expectInt("feeder id INT_MAX", serParseFeederId(buf), INT_MAX);
+    expectInt("feeder id 4294967295", serParseFeederId("4294967295"), 0);
+    expectInt("feeder id 0", serParseFeederId("0"), 0);
+    expectInt("empty feeder id", serParseFeederId(""), 0);
+    expectInt("feeder id -1", serParseFeederId("-1"), 0);
+    expectInt("feeder id 12a", serParseFeederId("12a"), 0);
+    expectInt("feeder id of 11 digits", serParseFeederId("00000000001"), 0);
+    expectTrue("INT_MAX fits the field", strlen(buf) <= LEN_DS18B20_FEEDER_ID_MAX);
+}
+
+int main()
+{
+    testOffsets();
+    testRecords();
+    testFeederIds();
+
+    printf("%d of %d checks failed\n", fails, total);
+
+    return( fails != 0 );
+}
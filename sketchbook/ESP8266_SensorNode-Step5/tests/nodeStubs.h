@@ -0,0 +1,87 @@
+//
+// ************************************************************************
+// stand-ins for the Arduino core used by the host tests of the sketch
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Only what the extracted parts of the sketch use. The EEPROM is a
+//   plain array, a read or write outside of it is counted.
+//
+// ************************************************************************
+//
+
+#ifndef _NODE_STUBS_H_
+#define _NODE_STUBS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+#define LOGLEVEL_QUIET     0
+#define LOGLEVEL_CRITICAL  1
+#define LOGLEVEL_ERROR     2
+#define LOGLEVEL_WARNING   4
+#define LOGLEVEL_DEBUG     8
+#define LOGLEVEL_INFO     16
+
+struct SimpleLog {
+    void Log(int level, const char *format, ...) {}
+};
+
+static SimpleLog Logger;
+
+class String {
+public:
+    std::string s;
+    String(const char *str = "") : s(str) {}
+    const char *c_str() const { return( s.c_str() ); }
+    unsigned int length() const { return( s.size() ); }
+    long toInt() const { return( atol(s.c_str()) ); }
+    char operator[](unsigned int i) const { return( i < s.size() ? s[i] : '\0' ); }
+    String &operator+=(char c) { s += c; return( *this ); }
+    bool operator==(const String &other) const { return( s == other.s ); }
+};
+
+class EEPROMClass {
+public:
+    uint8_t data[4096];
+    int outside = 0;              // accesses beyond the end
+    int commits = 0;
+
+    uint8_t read(int pos)
+    {
+        if( pos < 0 || pos >= (int) sizeof(data) )
+        {
+            outside++;
+            return( 0 );
+        }
+        return( data[pos] );
+    }
+    void write(int pos, uint8_t value)
+    {
+        if( pos < 0 || pos >= (int) sizeof(data) )
+        {
+            outside++;
+            return;
+        }
+        data[pos] = value;
+    }
+    bool commit() { commits++; return( true ); }
+};
+
+static EEPROMClass EEPROM;
+
+// Step4 traces the EEPROM access on the console
+#define HEX               16
+
+struct HardwareSerial {
+    template<typename T> size_t print(T value, int base = 10) { return( 0 ); }
+    template<typename T> size_t println(T value, int base = 10) { return( 0 ); }
+};
+
+static HardwareSerial Serial;
+
+#endif // _NODE_STUBS_H_
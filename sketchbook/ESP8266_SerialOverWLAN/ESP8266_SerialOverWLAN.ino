@@ -64,6 +64,45 @@
 //                           replaced inline eeprom-access by dsEeprom-class
 //                           check for autoconnect in setup()
 //
+// update ....: 12/22/2016 - log to a RAM ring (/log page) and optional
+//                           UDP syslog, the UART only gets log output
+//                           while Serial over network is not running
+//
+// update ....: 12/27/2016 - UDP transport for Serial over network
+//                           COM-Server accepts a writer and several
+//                           read-only monitor clients
+//                           RFC 2217 line settings from Telnet clients
+//                           COM line settings are validated and kept
+//                           in parsed form
+//                           enlarged UART RX ring, XON/XOFF and RTS/CTS
+//                           backpressure
+//                           SON uses one UART stream, the software UART
+//                           is kept in static memory
+//                           pages are streamed in chunks instead of
+//                           being built in a String
+//                           pages are gzip compressed templates in
+//                           flash, sent with ETag (304 if unchanged)
+//                           JSON API: /api/status, /api/com, /api/stats
+//                           SON throughput, latency and write time statistics
+//                           admin login starts a session with a cookie,
+//                           pages redirect instead of calling each other
+//                           fast WLAN connect with cached access point,
+//                           channel and IP, static IP setting works
+//                           periodic jobs run by the SimpleTask scheduler
+//
+// update ....: 12/30/2016 - host test of the Telnet/RFC 2217 handling
+//                           in tests/ (make test)
+//
+// update ....: 12/31/2016 - RTS/CTS handshake as COM setting, commands
+//                           of the writer are handled while the device
+//                           has stopped us
+//                           /api/loopback: receive test of the software
+//                           UART
+//
+// update ....: 01/01/2017 - /api/loopback measures the edge timing of
+//                           GPIO pairs in scheduler steps, the software
+//                           UART check uses the measured latency
+//
 // ************************************************************************
 // program flow
 // ************************************************************************
@@ -94,17 +133,41 @@
 //
 #include <ESP8266WiFi.h>
 #include <ESP8266WebServer.h>
+#include <WiFiUdp.h>
 #include <SoftwareSerial.h>
+#include <new>                  // placement new for the software UART
 #include "ioStreams.h"
+#include "pageStream.h"          // pages are streamed while they are built
+#include "pageTemplate.h"        // gzip compressed page templates
+#include "webAssets.h"           // generated by makeWebAssets.py
 
 #include "dsEeprom.h"           // simplified access to onchip EEPROM
 #include "SimpleLog.h"          // fprintf()-like logging
+#include "SimpleLogSinks.h"     // ring buffer and syslog output
+#include "SimpleTask.h"         // scheduler for the periodic jobs of loop()
+
+#include <lwip/netif.h>          // length and age of the DHCP lease
+#include <lwip/dhcp.h>
 
 // ************************************************************************
 // Logging
 // ************************************************************************
 // 
+// The UART is shared with the serial device while SON is running, so
+// log output goes to a RAM ring (see /log page) and, if a server is
+// set, to a syslog server, too.
+//
+#define LOG_RING_SIZE                  2048
+#define LOG_SYSLOG_SERVER                ""   // e.g. "192.168.1.10", empty = off
+#define LOG_SYSLOG_PORT                 SIMPLE_LOG_SYSLOG_PORT
+#define LOG_SYSLOG_TAG                  "SerialOverWLAN"
+//
 static SimpleLog Logger;
+static char logRingBuffer[LOG_RING_SIZE];
+static SimpleLogRingSink logRing(logRingBuffer, sizeof(logRingBuffer));
+static WiFiUDP syslogUdp;
+static SimpleLogSyslogSink logSyslog;
+static char syslogHostname[33];
 //
 //
 // ************************************************************************
@@ -135,6 +198,7 @@ static SimpleLog Logger;
 #define FACTORY_USE_DATABITS             "8"
 #define FACTORY_USE_STOPBITS             "1"
 #define FACTORY_USE_FLOWCTRL             false
+#define FACTORY_USE_HW_FLOWCTRL          false
 #define FACTORY_USE_PARITY               "N"
 #define FACTORY_USE_BAUDRATE             "19200"
 //
@@ -197,6 +261,13 @@ static SimpleLog Logger;
 #define COM_LABEL_PROTOCOL_TCP           "TCP"
 #define COM_LABEL_PROTOCOL_UDP           "UDP"
 
+#define COM_OPTGRP_LABEL_UDP_SEQUENCE    "UDP sequence numbers:"
+#define COM_RADIONAME_UDP_SEQUENCE       "udpseq"
+#define COM_RADIO_UDP_SEQUENCE_ON        "ON"
+#define COM_RADIO_UDP_SEQUENCE_OFF       "OFF"
+#define COM_LABEL_UDP_SEQUENCE_ON        "on"
+#define COM_LABEL_UDP_SEQUENCE_OFF       "off"
+
 #define COM_TARGET_IP                    "targetIP"
 #define COM_LABEL_TARGET_IP              "Target IP:"
 
@@ -286,6 +357,7 @@ static SimpleLog Logger;
 #define COM_OPTGRP_LABEL_FLOWCTRL        "Handshake"
 #define COM_RADIONAME_FLOWCTRL           "flow"
 #define COM_RADIO_LBL_HANDSHAKE_SW       "Software"
+#define COM_RADIO_LBL_HANDSHAKE_HW       "Hardware"
 #define COM_RADIO_LBL_HANDSHAKE_NO       "disabled"
 
 // Parity
@@ -322,6 +394,20 @@ static SimpleLog Logger;
 #define COM_OPTION_LBL_B921600           "921600 Baud"
 #define COM_OPTION_VALUE_B921600         "921600"
 
+// RX ring of the hardware UART
+#define COM_OPTGRP_LABEL_RX_BUFSIZE      "UART RX ring:"
+#define COM_FIELDNAME_RX_BUFSIZE         "rxbuf"
+#define COM_LABEL_RX_BUFSIZE             "bytes"
+
+// Packets sent to the network
+#define COM_OPTGRP_LABEL_PACKET          "Packets:"
+#define COM_FIELDNAME_PACKET_MAXBYTES    "pktmax"
+#define COM_LABEL_PACKET_MAXBYTES        "max. bytes"
+#define COM_FIELDNAME_PACKET_TIMEOUT     "pkttimeout"
+#define COM_LABEL_PACKET_TIMEOUT         "timeout (ms)"
+#define COM_FIELDNAME_PACKET_DELIMITER   "pktdelim"
+#define COM_LABEL_PACKET_DELIMITER       "delimiter (-1 = none)"
+
 // Buttons on this page
 #define COM_BUTTONNAME_FORMRESET         "rst"
 #define COM_ACTION_RESET                 "reset form"
@@ -404,6 +490,12 @@ dsEeprom eeprom;
 #define EEPROM_MAXLEN_COM_USE_FLOWCTRL    EEPROM_MAXLEN_BOOLEAN
 #define EEPROM_MAXLEN_COM_USE_PARITY      1
 #define EEPROM_MAXLEN_COM_USE_BAUDRATE    7
+#define EEPROM_MAXLEN_COM_USE_HW_FLOWCTRL EEPROM_MAXLEN_BOOLEAN
+#define EEPROM_MAXLEN_COM_PACKET_MAXBYTES 3
+#define EEPROM_MAXLEN_COM_PACKET_TIMEOUT  5
+#define EEPROM_MAXLEN_COM_PACKET_DELIMITER 3
+#define EEPROM_MAXLEN_COM_UDP_SEQUENCE    EEPROM_MAXLEN_BOOLEAN
+#define EEPROM_MAXLEN_COM_RX_BUFSIZE      4
 // layout of the eeprom:
 //
 #define EEPROM_HEADER_BEGIN              0
@@ -455,7 +547,25 @@ dsEeprom eeprom;
 //
 #define EEPROM_POS_COM_USE_BAUDRATE      (EEPROM_POS_COM_USE_PARITY + EEPROM_MAXLEN_COM_USE_PARITY + EEPROM_LEADING_LENGTH)
 //
-#define EEPROM_DATA_END                  (EEPROM_POS_COM_USE_BAUDRATE + EEPROM_MAXLEN_COM_USE_BAUDRATE + EEPROM_LEADING_LENGTH)
+#define EEPROM_POS_WLAN_CACHE            (EEPROM_POS_COM_USE_BAUDRATE + EEPROM_MAXLEN_COM_USE_BAUDRATE + EEPROM_LEADING_LENGTH)
+
+//
+// added behind the WLAN cache, an EEPROM written before has no valid
+// field length here
+#define EEPROM_POS_COM_USE_HW_FLOWCTRL   (EEPROM_POS_WLAN_CACHE + sizeof(wlanCacheData))
+
+//
+#define EEPROM_POS_COM_PACKET_MAXBYTES   (EEPROM_POS_COM_USE_HW_FLOWCTRL + EEPROM_MAXLEN_COM_USE_HW_FLOWCTRL + EEPROM_LEADING_LENGTH)
+//
+#define EEPROM_POS_COM_PACKET_TIMEOUT    (EEPROM_POS_COM_PACKET_MAXBYTES + EEPROM_MAXLEN_COM_PACKET_MAXBYTES + EEPROM_LEADING_LENGTH)
+//
+#define EEPROM_POS_COM_PACKET_DELIMITER  (EEPROM_POS_COM_PACKET_TIMEOUT + EEPROM_MAXLEN_COM_PACKET_TIMEOUT + EEPROM_LEADING_LENGTH)
+//
+#define EEPROM_POS_COM_UDP_SEQUENCE      (EEPROM_POS_COM_PACKET_DELIMITER + EEPROM_MAXLEN_COM_PACKET_DELIMITER + EEPROM_LEADING_LENGTH)
+//
+#define EEPROM_POS_COM_RX_BUFSIZE        (EEPROM_POS_COM_UDP_SEQUENCE + EEPROM_MAXLEN_COM_UDP_SEQUENCE + EEPROM_LEADING_LENGTH)
+
+#define EEPROM_DATA_END                  (EEPROM_POS_COM_RX_BUFSIZE + EEPROM_MAXLEN_COM_RX_BUFSIZE + EEPROM_LEADING_LENGTH)
 //
 //
 // ... further stuff here like above scheme
@@ -470,6 +580,53 @@ String wlanSSID;
 String wlanPasswd;
 // change in /admin webpage
 bool useDhcp;
+//
+// the access point, channel and IP configuration of the last connection
+// are kept in the EEPROM. The next boot joins this access point without
+// a scan and uses the configuration without DHCP, as long as the lease
+// lasts. A full scan and DHCP only happen if that fails. The cache
+// belongs to the SSID it was made for.
+//
+#define WLAN_FAST_CONNECT_MSECS       3000
+#define MAX_MSECS_FOR_AUTOCONNECT    10000 // 10 sec, full scan and DHCP
+#define WLAN_CONNECT_POLL_MSECS         10
+
+struct wlanCacheData {
+    uint32_t ssidHash;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t reserved;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
+wlanCacheData wlanCache;
+//
+// length and age of the lease are kept in the RTC memory, which survives
+// a reset but not a power loss. The age counts up every
+// WLAN_LEASE_TICK_MSECS, the EEPROM can't be written that often. Without
+// a valid record the lease counts as expired and DHCP is used. If the
+// cached lease expires while the node runs, DHCP is started.
+//
+#define WLAN_LEASE_MAGIC         0x4c656173UL   // "Leas"
+#define WLAN_LEASE_RTC_OFFSET             0     // in 4 byte blocks
+#define WLAN_LEASE_TICK_MSECS         10000
+
+struct wlanLeaseData {
+    uint32_t magic;
+    uint32_t ip;                      // the lease is for
+    uint32_t leaseSecs;
+    uint32_t ageSecs;
+};
+
+wlanLeaseData wlanLease;
+bool wlanOnCachedLease;               // runs on the cached lease, no DHCP
+// boot timing, msecs after reset
+unsigned long bootWlanMillis;
+unsigned long bootReadyMillis;
+bool bootFastConnect;
 // change to IP you prefer in /admin webpage
 String wwwServerIP;
 // change to port you prefer in /admin webpage
@@ -478,10 +635,6 @@ String wwwServerPort;
 String nodeName;
 // change password in /admin webpage
 String adminPasswd;
-// remember previous successful login
-bool adminAccessSucceeded;
-// remember admin login password
-String loginPasswd = "";
 // enable serial over network
 bool SerialOverNetwork;
 // serial over network status
@@ -502,16 +655,141 @@ String useTxPin;
 String useDataBits;
 // amount of stopbits during transfer
 String useStopBits;
-// wich flow control ( only software or none )
+// wich flow control ( software, hardware or none )
 bool useFlowCtrl;
+bool useHwFlowCtrl;
 // what parity to use
 String useParity;
 // transfer speed
 String useBaudRate;
+//
+// the line settings above in parsed and validated form. They are what
+// the UART actually uses and may be changed at runtime by RFC 2217.
+//
+enum comDataBits : uint8_t { COM_DATABITS_6 = 6, COM_DATABITS_7 = 7, COM_DATABITS_8 = 8 };
+enum comParity : uint8_t { COM_PARITY_NONE = 0, COM_PARITY_EVEN = 1, COM_PARITY_ODD = 2 };
+enum comStopBits : uint8_t { COM_STOPBITS_1 = 1, COM_STOPBITS_2 = 2 };
+
+struct comLineSettings {
+    uint32_t baud;
+    comDataBits dataBits;
+    comParity parity;
+    comStopBits stopBits;
+};
+
+comLineSettings comLine = { 19200, COM_DATABITS_8, COM_PARITY_NONE, COM_STOPBITS_1 };
 // target IP if COM-Client
 String useTargetIP;
 // serial I/O
 SoftwareSerial *pSoftSerial;
+//
+// SON reads and writes the UART only through sonUart. It is either the
+// hardware UART or the software UART. The SoftwareSerial object lives in
+// static memory and is only rebuilt if its pins change. Its RX ring of
+// SON_SOFT_RX_BUFSIZE bytes is allocated on the heap by SoftwareSerial
+// with each rebuild and freed by the destructor.
+//
+// SON_SOFT_ISR_LATENCY_CYCLES is an estimate of the time from an edge
+// on the RX pin until the GPIO handler of SoftwareSerial has timed it.
+// /api/loopback measures it on the device, the measured value is used
+// instead until the next restart.
+//
+#define SON_SOFT_RX_BUFSIZE           1024
+#define SON_SOFT_ISR_LATENCY_CYCLES    300    // estimate, see above
+#define SON_SOFT_MAX_BIT_ERROR          25    // percent of a bit time
+#define SON_SOFT_MAX_BLOCK_MS            5    // max. time in a blocking write
+
+Stream *sonUart = &Serial;
+static uint32_t sonSoftSerialMem[(sizeof(SoftwareSerial) + 3) / 4];
+static int sonSoftRxPin = -1;
+static int sonSoftTxPin = -1;
+static uint32_t sonSoftLatencyCycles; // measured by /api/loopback, 0 = not yet
+// the software UART is set, but can't do the line settings. The hardware
+// UART is used until the next restart, useHardSerial is stored as set.
+static bool sonSoftFallback;
+// the software UART writes bit by bit with interrupts off. Per loop
+// only as many bytes are written as take SON_SOFT_MAX_BLOCK_MS.
+static size_t sonSoftBudget;
+//
+// ************************************************************************
+// SON transfer buffers
+// - data is moved in blocks instead of single bytes. The buffers are
+//   static so they are neither allocated on the stack nor on the heap.
+// - the UART -> network direction uses two buffers: one is filled from
+//   the UART while the other one is sent.
+// ************************************************************************
+//
+#define SON_NET_BUFSIZE                 512   // network -> UART
+#define SON_UART_BUFSIZE                256   // UART -> network, each buffer
+//
+// ************************************************************************
+// packetization of UART data (like ser2net/RFC 2217 servers do)
+// a packet is sent as soon as one of these conditions is met:
+// - it has reached sonPacketMaxBytes
+// - no char was received for sonPacketTimeout msecs (0 = send as soon
+//   as the UART has no more data)
+// - the delimiter sonPacketDelimiter was received (-1 = none)
+// ************************************************************************
+//
+#define FACTORY_SON_PACKET_MAXBYTES     SON_UART_BUFSIZE
+#define FACTORY_SON_PACKET_TIMEOUT        0
+#define FACTORY_SON_PACKET_DELIMITER     -1
+#define SON_PACKET_TIMEOUT_MAX        60000
+
+size_t sonPacketMaxBytes = FACTORY_SON_PACKET_MAXBYTES;
+unsigned long sonPacketTimeout = FACTORY_SON_PACKET_TIMEOUT;
+int sonPacketDelimiter = FACTORY_SON_PACKET_DELIMITER;
+
+struct sonPacket
+{
+    uint8_t data[SON_UART_BUFSIZE];
+    size_t len;
+    size_t sent;
+    unsigned long firstRx;            // micros() of the first byte
+};
+
+static uint8_t sonNetBuffer[SON_NET_BUFSIZE];
+static sonPacket sonUartPackets[2];
+static int sonFillPacket = 0;         // packet filled from the UART
+static int sonSendPacket = -1;        // packet being sent, -1 if none
+static unsigned long sonLastUartRx;   // millis() of the last UART data
+//
+// ************************************************************************
+// UART receive ring and flow control
+// - the RX ring of the hardware UART is enlarged to sonRxBufferSize, so
+//   it can bridge short WiFi stalls at high baud rates
+// - if the ring fills up beyond the high water mark because the network
+//   send queue is stuck, the device is stopped: XOFF is sent if software
+//   flow control is set, RTS is raised if hardware flow control is set.
+//   It is released again below the low water mark.
+// - XON/XOFF received from the device resp. a raised CTS line pause the
+//   network -> UART direction
+// - while the device has stopped us, the writer is still read, so its
+//   Telnet and RFC 2217 commands are handled. Its data is held back in
+//   sonHold, a Telnet writer is told to suspend by FLOWCONTROL-SUSPEND.
+//   Data that does not fit into sonHold any more is dropped.
+// ************************************************************************
+//
+#define FACTORY_SON_RX_BUFSIZE        2048
+#define SON_RX_BUFSIZE_MIN             256
+#define SON_RX_BUFSIZE_MAX            8192
+#define SON_RTS_PIN                     15    // U0RTS, output
+#define SON_CTS_PIN                     13    // U0CTS, input
+#define SON_HOLD_BUFSIZE               256
+
+#define ASCII_XON                     0x11
+#define ASCII_XOFF                    0x13
+
+size_t sonRxBufferSize = FACTORY_SON_RX_BUFSIZE;
+static bool sonFlowStopped = false;   // we told the device to stop
+static bool sonUartTxPaused = false;  // the device told us to stop
+static unsigned long sonOverruns;     // UART RX ring overflows
+static unsigned long sonFlowStops;    // times the device was stopped
+static unsigned long sonHeldBytes;    // bytes read while the device was stopped
+static uint8_t sonHold[SON_HOLD_BUFSIZE]; // writer data waiting for the device
+static size_t sonHoldLen;
+static unsigned long sonHoldDropped;  // writer data dropped while stopped
+static bool sonWriterSuspended;       // the writer was sent FLOWCONTROL-SUSPEND
 // suppress debug output over serial port
 bool beQuiet;
 //
@@ -520,15 +798,190 @@ bool beQuiet;
 // ************************************************************************
 //
 ESP8266WebServer server; // (WWW_LISTENPORT);
-String pageContent;
+pageStream pageContent;
+//
+// the pages are templates (*.html) that makeWebAssets.py compresses
+// into webAssets.h. The browser has to ask whether its copy is still
+// valid, it gets a 304 if the ETag matches.
+//
+#define WEB_CACHE_CONTROL       "private, no-cache"
+
+pageTemplate webPage;
+const char *webHeaders[] = { "If-None-Match", "Cookie" };
+//
+// a login starts a session. Its token is sent as cookie and checked on
+// each request to an admin page. The first char of the token is the
+// index of the session, so the check is a single compare. A session
+// expires after WEB_SESSION_TIMEOUT msecs without a request, if the
+// table is full the least recently used one is ended.
+//
+#define WEB_SESSIONS                 4
+#define WEB_SESSION_TOKEN_LEN       17    // index + 16 random hex digits
+#define WEB_SESSION_TIMEOUT    (15 * 60 * 1000UL)
+#define WEB_SESSION_COOKIE      "sonsession"
+
+struct webSession {
+    bool used;
+    unsigned long lastUse;
+    char token[WEB_SESSION_TOKEN_LEN + 1];
+};
+
+static webSession webSessions[WEB_SESSIONS];
+//
+// time to first byte and heap use of the templates sent, see /api/stats
+//
+#define WEB_PAGE_STATS               5    // one per template
+
+struct webPageTiming {
+    const pageTemplateAsset *asset;
+    unsigned long count;
+    unsigned long firstByteMillis;    // of the last time it was sent
+    unsigned long maxFirstByteMillis;
+    uint32_t heapUsed;
+    uint32_t maxHeapUsed;
+};
+
+static webPageTiming webPageStats[WEB_PAGE_STATS];
 int serverStatusCode;
 
 ioStreams localStreams;
+// periodic jobs of loop()
+SimpleTask Tasks;
 
 WiFiServer TelnetServer(SON_SERVER_PORT);
-WiFiClient incomingTelnetConnection;
 WiFiClient outgoingTelnetConnection;
 //
+// a COM-Server accepts up to SON_MAX_CLIENTS connections. The first
+// client gets the writer lease, its input goes to the UART. All others
+// are monitors, they get the UART output but their input is discarded.
+// If the writer leaves, the next client that sends data gets the lease.
+// Each client has its own output queue, a slow reader loses the oldest
+// data instead of stalling the others. The queue holds the plain UART
+// data, 0xff is doubled for Telnet clients only when it is sent. Telnet
+// answers are queued apart and sent as a whole before more data, so a
+// dropped byte never cuts a Telnet sequence.
+//
+#define SON_MAX_CLIENTS                  4
+#define SON_CLIENT_QUEUE_SIZE         1024
+#define SON_CLIENT_CTRL_SIZE            64    // Telnet answers
+#define SON_CLIENT_SEND_CHUNK          128    // escaped data per write()
+
+//
+// RFC 2217 (Telnet COM-Port-Control). A client whose first byte is a
+// Telnet IAC is handled as Telnet client: IAC sequences are removed
+// from its input, 0xff in the UART output is doubled and the writer
+// may change the line settings with COM-PORT-OPTION subnegotiations.
+// Monitor clients get the current settings as answer, but can't change
+// them. Changes are not stored in the EEPROM.
+//
+#define TELNET_SE                      240
+#define TELNET_SB                      250
+#define TELNET_WILL                    251
+#define TELNET_WONT                    252
+#define TELNET_DO                      253
+#define TELNET_DONT                    254
+#define TELNET_IAC                     255
+
+#define TELNET_OPT_BINARY                0
+#define TELNET_OPT_SGA                   3
+#define TELNET_OPT_COM_PORT             44
+
+#define RFC2217_SIGNATURE                0
+#define RFC2217_SET_BAUDRATE             1
+#define RFC2217_SET_DATASIZE             2
+#define RFC2217_SET_PARITY               3
+#define RFC2217_SET_STOPSIZE             4
+#define RFC2217_SET_CONTROL              5
+#define RFC2217_FLOWCONTROL_SUSPEND      8
+#define RFC2217_FLOWCONTROL_RESUME       9
+#define RFC2217_SET_LINESTATE_MASK      10
+#define RFC2217_SET_MODEMSTATE_MASK     11
+#define RFC2217_PURGE_DATA              12
+#define RFC2217_SERVER_OFFSET          100
+
+#define RFC2217_PARITY_NONE              1
+#define RFC2217_PARITY_ODD               2
+#define RFC2217_PARITY_EVEN              3
+
+#define RFC2217_CONTROL_FLOW_QUERY       0
+#define RFC2217_CONTROL_FLOW_NONE        1
+#define RFC2217_CONTROL_FLOW_XONXOFF     2
+#define RFC2217_CONTROL_FLOW_HARDWARE    3
+#define RFC2217_CONTROL_BREAK_QUERY      4
+#define RFC2217_CONTROL_BREAK_ON         5
+#define RFC2217_CONTROL_BREAK_OFF        6
+#define RFC2217_CONTROL_DTR_QUERY        7
+#define RFC2217_CONTROL_DTR_ON           8
+#define RFC2217_CONTROL_DTR_OFF          9
+#define RFC2217_CONTROL_RTS_QUERY       10
+#define RFC2217_CONTROL_RTS_ON          11
+#define RFC2217_CONTROL_RTS_OFF         12
+#define RFC2217_CONTROL_INFLOW_QUERY    13
+#define RFC2217_CONTROL_INFLOW_NONE     14
+#define RFC2217_CONTROL_INFLOW_XONXOFF  15
+#define RFC2217_CONTROL_INFLOW_HARDWARE 16
+
+#define RFC2217_PURGE_RX                 1
+#define RFC2217_PURGE_TX                 2
+#define RFC2217_PURGE_BOTH               3
+
+#define SON_MIN_BAUDRATE               300
+#define SON_MAX_BAUDRATE            921600
+
+#define SON_TELNET_UNKNOWN               0    // no input yet
+#define SON_TELNET_OFF                   1    // raw TCP client
+#define SON_TELNET_ON                    2    // Telnet/RFC 2217 client
+
+#define SON_TELNET_SB_SIZE              16
+
+// parser states
+#define TN_DATA                          0
+#define TN_IAC                           1
+#define TN_OPTION                        2
+#define TN_SB                            3
+#define TN_SB_IAC                        4
+
+struct sonClientSlot {
+    bool used;
+    WiFiClient client;
+    uint8_t queue[SON_CLIENT_QUEUE_SIZE];
+    size_t head;
+    size_t len;
+    unsigned long dropped;
+    uint8_t ctrl[SON_CLIENT_CTRL_SIZE];
+    size_t ctrlLen;
+    bool tnIacPending;                // 2nd byte of an IAC IAC not sent yet
+    uint8_t telnet;                   // SON_TELNET_*
+    uint8_t tnState;                  // TN_*
+    uint8_t tnVerb;                   // WILL/WONT/DO/DONT being parsed
+    uint8_t tnAgreed;                 // options agreed on, see sonTelnetBit()
+    bool tnSuspended;                 // client sent FLOWCONTROL-SUSPEND
+    uint8_t tnSb[SON_TELNET_SB_SIZE];
+    size_t tnSbLen;
+};
+
+static sonClientSlot sonClients[SON_MAX_CLIENTS];
+static int sonNumClients = 0;
+static int sonWriter = -1;            // slot holding the writer lease
+//
+// SON over UDP: each packet of UART data is sent as one datagram. A
+// COM-Server learns its peer from the first datagram it receives, a
+// COM-Client sends to the target IP. With sonUdpSequence both sides put
+// a 16 bit sequence number in front of each datagram to detect losses.
+//
+#define FACTORY_SON_UDP_SEQUENCE     false
+#define SON_UDP_SEQ_LEN                  2
+
+WiFiUDP sonUdp;
+IPAddress sonUdpPeerIP;
+uint16_t sonUdpPeerPort;
+bool sonUdpSequence = FACTORY_SON_UDP_SEQUENCE;
+uint16_t sonUdpTxSeq;
+uint16_t sonUdpRxSeq;
+bool sonUdpRxSynced;                  // sonUdpRxSeq is the one of the peer
+unsigned long sonUdpLost;
+int sonUdpPending;                    // unread bytes of current datagram
+//
 #define SERVER_METHOD_GET       1
 #define SERVER_METHOD_POST      2
 #define ARGS_ADMIN_PAGE         2
@@ -544,6 +997,10 @@ void handleAdminPage(void);
 void handleIndexPage(void);
 void sendAuthFailedPage(void);
 void handleComSettings(void);
+void handleLogPage(void);
+void handleApiStatus(void);
+void handleApiCom(void);
+void handleApiStats(void);
 //
 // store/restore settings done in /admin page
 //
@@ -575,7 +1032,7 @@ int nodeStoreAdminSettings()
     
     if( !beQuiet )
     {
-        Logger.Log(LOGLEVEL_DEBUG, "storing Passphrase: %s\n", wlanPasswd.c_str());
+        Logger.Log(LOGLEVEL_DEBUG, "storing Passphrase: %d chars\n", wlanPasswd.length());
     }
 
     eeprom.storeString(  wlanPasswd,    EEPROM_MAXLEN_WLAN_PASSPHRASE, EEPROM_POS_WLAN_PASSPHRASE );
@@ -603,7 +1060,7 @@ int nodeStoreAdminSettings()
     
     if( !beQuiet )
     {
-        Logger.Log(LOGLEVEL_DEBUG, "storing adminPasswd: %s\n", adminPasswd.c_str());
+        Logger.Log(LOGLEVEL_DEBUG, "storing adminPasswd: %d chars\n", adminPasswd.length());
     }
 
     eeprom.storeString(  adminPasswd,   EEPROM_MAXLEN_ADMIN_PASSWORD,  EEPROM_POS_ADMIN_PASSWORD );
@@ -665,7 +1122,7 @@ int nodeRestoreAdminSettings()
 
             if( !beQuiet )
             {
-                Logger.Log(LOGLEVEL_DEBUG, "restored Passphrase: %s\n", wlanPasswd.c_str());
+                Logger.Log(LOGLEVEL_DEBUG, "restored Passphrase: %d chars\n", wlanPasswd.length());
             }
 
             eeprom.restoreString(  wwwServerIP,              EEPROM_POS_SERVER_IP,       EEPROM_MAXLEN_SERVER_IP );
@@ -693,7 +1150,7 @@ int nodeRestoreAdminSettings()
 
             if( !beQuiet )
             {
-                Logger.Log(LOGLEVEL_DEBUG, "restored adminPasswd: %s\n", adminPasswd.c_str());
+                Logger.Log(LOGLEVEL_DEBUG, "restored adminPasswd: %d chars\n", adminPasswd.length());
             }
 
             eeprom.restoreBoolean( (char*) &useDhcp,         EEPROM_POS_USE_DHCP );
@@ -777,6 +1234,7 @@ int nodeStoreCOMSettings()
 {
     int retVal = 0;
     unsigned long crcCalc;
+    bool hardSerial;
 
     if( !beQuiet )
     {
@@ -808,10 +1266,11 @@ int nodeStoreCOMSettings()
 
     if( !beQuiet )
     {
-        Logger.Log(LOGLEVEL_DEBUG, "storing use serial hardware: %d\n", useHardSerial);
+        Logger.Log(LOGLEVEL_DEBUG, "storing use serial hardware: %d\n", useHardSerial && !sonSoftFallback);
     }
 
-    eeprom.storeBoolean( (char*) &useHardSerial, EEPROM_POS_COM_USE_HW_SERIAL );
+    hardSerial = useHardSerial && !sonSoftFallback;
+    eeprom.storeBoolean( (char*) &hardSerial, EEPROM_POS_COM_USE_HW_SERIAL );
 
     if( !beQuiet )
     {
@@ -848,6 +1307,37 @@ int nodeStoreCOMSettings()
 
     eeprom.storeBoolean( (char*) &useFlowCtrl, EEPROM_POS_COM_USE_FLOWCTRL );
 
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "storing use RTS/CTS: %d\n", useHwFlowCtrl);
+    }
+
+    eeprom.storeBoolean( (char*) &useHwFlowCtrl, EEPROM_POS_COM_USE_HW_FLOWCTRL );
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "storing packets: %u bytes, %lu ms, delimiter %d\n",
+                   sonPacketMaxBytes, sonPacketTimeout, sonPacketDelimiter);
+    }
+
+    eeprom.storeString( String(sonPacketMaxBytes), EEPROM_MAXLEN_COM_PACKET_MAXBYTES, EEPROM_POS_COM_PACKET_MAXBYTES );
+    eeprom.storeString( String(sonPacketTimeout), EEPROM_MAXLEN_COM_PACKET_TIMEOUT, EEPROM_POS_COM_PACKET_TIMEOUT );
+    eeprom.storeString( String(sonPacketDelimiter), EEPROM_MAXLEN_COM_PACKET_DELIMITER, EEPROM_POS_COM_PACKET_DELIMITER );
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "storing UDP sequence numbers: %d\n", sonUdpSequence);
+    }
+
+    eeprom.storeBoolean( (char*) &sonUdpSequence, EEPROM_POS_COM_UDP_SEQUENCE );
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "storing UART RX ring: %u\n", sonRxBufferSize);
+    }
+
+    eeprom.storeString( String(sonRxBufferSize), EEPROM_MAXLEN_COM_RX_BUFSIZE, EEPROM_POS_COM_RX_BUFSIZE );
+
     if( !beQuiet )
     {
         Logger.Log(LOGLEVEL_DEBUG, "storing parity: %s\n", useParity.c_str());
@@ -885,7 +1375,11 @@ int nodeRestoreCOMSettings()
     int retVal = 0;
     unsigned long crcCalc;
     unsigned long crcRead;
+    short fieldLen = 0;
     String data = "";
+    String packetMaxBytes = "";
+    String packetTimeout = "";
+    String packetDelimiter = "";
 
     if( eeprom.isValid() || IGNORE_IF_CONDITION )
     {
@@ -971,6 +1465,82 @@ int nodeRestoreCOMSettings()
                 Logger.Log(LOGLEVEL_DEBUG, "restored use flow control: %d\n", useFlowCtrl);
             }
 
+            eeprom.restoreFieldLength( (char*) &fieldLen, EEPROM_POS_COM_USE_HW_FLOWCTRL );
+
+            if( fieldLen == EEPROM_MAXLEN_COM_USE_HW_FLOWCTRL )
+            {
+                eeprom.restoreBoolean( (char*) &useHwFlowCtrl, EEPROM_POS_COM_USE_HW_FLOWCTRL );
+            }
+            else
+            {
+                useHwFlowCtrl = FACTORY_USE_HW_FLOWCTRL;
+            }
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "restored use RTS/CTS: %d\n", useHwFlowCtrl);
+            }
+
+            // added later, too
+            eeprom.restoreFieldLength( (char*) &fieldLen, EEPROM_POS_COM_PACKET_MAXBYTES );
+
+            if( fieldLen > 0 && fieldLen <= EEPROM_MAXLEN_COM_PACKET_MAXBYTES )
+            {
+                eeprom.restoreString( packetMaxBytes, EEPROM_POS_COM_PACKET_MAXBYTES, EEPROM_MAXLEN_COM_PACKET_MAXBYTES );
+                eeprom.restoreString( packetTimeout, EEPROM_POS_COM_PACKET_TIMEOUT, EEPROM_MAXLEN_COM_PACKET_TIMEOUT );
+                eeprom.restoreString( packetDelimiter, EEPROM_POS_COM_PACKET_DELIMITER, EEPROM_MAXLEN_COM_PACKET_DELIMITER );
+            }
+
+            if( !comTakePacketSettings(packetMaxBytes, packetTimeout, packetDelimiter) )
+            {
+                sonPacketMaxBytes = FACTORY_SON_PACKET_MAXBYTES;
+                sonPacketTimeout = FACTORY_SON_PACKET_TIMEOUT;
+                sonPacketDelimiter = FACTORY_SON_PACKET_DELIMITER;
+            }
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "restored packets: %u bytes, %lu ms, delimiter %d\n",
+                           sonPacketMaxBytes, sonPacketTimeout, sonPacketDelimiter);
+            }
+
+            eeprom.restoreFieldLength( (char*) &fieldLen, EEPROM_POS_COM_UDP_SEQUENCE );
+
+            if( fieldLen == EEPROM_MAXLEN_COM_UDP_SEQUENCE )
+            {
+                eeprom.restoreBoolean( (char*) &sonUdpSequence, EEPROM_POS_COM_UDP_SEQUENCE );
+            }
+            else
+            {
+                sonUdpSequence = FACTORY_SON_UDP_SEQUENCE;
+            }
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "restored UDP sequence numbers: %d\n", sonUdpSequence);
+            }
+
+            eeprom.restoreFieldLength( (char*) &fieldLen, EEPROM_POS_COM_RX_BUFSIZE );
+
+            if( fieldLen > 0 && fieldLen <= EEPROM_MAXLEN_COM_RX_BUFSIZE )
+            {
+                eeprom.restoreString( data, EEPROM_POS_COM_RX_BUFSIZE, EEPROM_MAXLEN_COM_RX_BUFSIZE );
+            }
+            else
+            {
+                data = "";
+            }
+
+            if( !comTakeRxBufferSize(data) )
+            {
+                sonRxBufferSize = FACTORY_SON_RX_BUFSIZE;
+            }
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "restored UART RX ring: %u\n", sonRxBufferSize);
+            }
+
             eeprom.restoreString( useParity,  EEPROM_POS_COM_USE_PARITY, EEPROM_MAXLEN_COM_USE_PARITY );
 
             if( !beQuiet )
@@ -1038,6 +1608,20 @@ void resetCOM2FactorySettings()
     // use software flow control
     useFlowCtrl = FACTORY_USE_FLOWCTRL;
 
+    // use RTS/CTS
+    useHwFlowCtrl = FACTORY_USE_HW_FLOWCTRL;
+
+    // packets sent to the network
+    sonPacketMaxBytes = FACTORY_SON_PACKET_MAXBYTES;
+    sonPacketTimeout = FACTORY_SON_PACKET_TIMEOUT;
+    sonPacketDelimiter = FACTORY_SON_PACKET_DELIMITER;
+
+    // no sequence numbers in UDP datagrams
+    sonUdpSequence = FACTORY_SON_UDP_SEQUENCE;
+
+    // RX ring of the hardware UART
+    sonRxBufferSize = FACTORY_SON_RX_BUFSIZE;
+
     // use parity
     useParity = FACTORY_USE_PARITY;
 
@@ -1055,96 +1639,128 @@ void dumpInfo()
 {
 
     pageContent += "This node (id=" + nodeName + ") is connected to WLAN-Network " + wlanSSID + ".<br>\n";
-    pageContent += "DHCP is ";
+    pageContent += F("DHCP is ");
     if( !useDhcp )
     {
-        pageContent += "not ";
+        pageContent += F("not ");
     }
     pageContent += "activated, a Web-Server is listening on " + wwwServerIP + ":" + wwwServerPort + "<br>\n";
-    pageContent += "Serial Over Network is ";
+    pageContent += F("Serial Over Network is ");
     if( !SerialOverNetwork )
     {
-        pageContent += "not ";
+        pageContent += F("not ");
     }
-    pageContent += "activated<br>\n";
+    pageContent += F("activated<br>\n");
     if( SerialOverNetwork )
     {
-        pageContent += "The node acts as ";
+        pageContent += F("The node acts as ");
     
         if( COMServerMode )
         {
             pageContent += "COM-Server and is listening on " + wwwServerIP + ":" + SON_SERVER_PORT + "<br>\n";
+            if( COMProtocolTCP )
+            {
+                pageContent += String(sonNumClients) + " of " + SON_MAX_CLIENTS + " clients connected";
+                if( sonWriter >= 0 )
+                {
+                    pageContent += ", client " + String(sonWriter) + " holds the writer lease";
+                }
+                pageContent += F("<br>\n");
+            }
         }
         else
         {
-            pageContent += "COM-Client for";
+            pageContent += F("COM-Client for");
             pageContent += "target address " + useTargetIP + ":" + SON_SERVER_PORT + " <br>\n";
         
         }
     
-        pageContent += "The node uses ";
+        pageContent += F("The node uses ");
         
         if( COMProtocolTCP )
         {
-            pageContent += "TCP";
+            pageContent += F("TCP");
         }
         else
         {
-            pageContent += "UDP";
+            pageContent += F("UDP");
         }
     
-        pageContent += " as protocol for COM services.<br>\n";
+        pageContent += F(" as protocol for COM services.<br>\n");
 
-        pageContent += "The serial transfer is done by ";
+        pageContent += F("The serial transfer is done by ");
     
-        if(useHardSerial)
+        if( sonSoftFallback )
+        {
+            pageContent += F("hardware, the software UART can't do the line settings.<br>\n");
+        }
+        else if(useHardSerial)
         {
-            pageContent += "hardware.<br>\n";
+            pageContent += F("hardware.<br>\n");
         }
         else
         {
-            pageContent += "software, ";
-            pageContent += "using Pins ";
+            pageContent += F("software, ");
+            pageContent += F("using Pins ");
             pageContent += useRxPin + "as Rx- and ";
             pageContent += useTxPin + "as Tx-pin.<br>\n";
         
         }
     
-        pageContent += "Transfer parameters are set to ";
-        pageContent += useDataBits + " databits, ";
-        pageContent += useStopBits + " stopbits ";
-        pageContent += "using ";
+        pageContent += F("Transfer parameters are set to ");
+        pageContent += String(comLine.dataBits) + " databits, ";
+        pageContent += String(comLine.stopBits) + " stopbits ";
+        pageContent += F("using ");
     
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_NO)) )
+        if( comLine.parity == COM_PARITY_NONE )
         {
-            pageContent += "no ";
+            pageContent += F("no ");
         }
         
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_EVEN)) )
+        if( comLine.parity == COM_PARITY_EVEN )
         {
-            pageContent += "even ";
+            pageContent += F("even ");
         }
         
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_ODD)) )
+        if( comLine.parity == COM_PARITY_ODD )
         {
-            pageContent += "odd ";
+            pageContent += F("odd ");
         }
     
-        pageContent += "parity ";
-        pageContent += "at a transfer rate of ";
-        pageContent += useBaudRate;
-        pageContent += " Baud with ";
+        pageContent += F("parity ");
+        pageContent += F("at a transfer rate of ");
+        pageContent += comLine.baud;
+        pageContent += F(" Baud with ");
         
         if( useFlowCtrl )
         {
-            pageContent += "software ";
+            pageContent += F("software ");
+        }
+        else if( useHwFlowCtrl )
+        {
+            pageContent += F("hardware ");
         }
         else
         {
-                pageContent += "no ";
+                pageContent += F("no ");
         }
 
-        pageContent += "flow control enabled.<br>\n";
+        pageContent += F("flow control enabled");
+        if( useHwFlowCtrl )
+        {
+            pageContent += ", RTS/CTS on GPIO " + String(SON_RTS_PIN) + "/" + String(SON_CTS_PIN);
+        }
+        pageContent += F(".<br>\n");
+        pageContent += "UART RX ring: " + String(sonRxBufferSize) + " bytes, ";
+        pageContent += String(sonOverruns) + " overruns, ";
+        pageContent += "device stopped " + String(sonFlowStops) + " times, ";
+        pageContent += String(sonHeldBytes) + " bytes held back, ";
+        pageContent += String(sonHoldDropped) + " bytes of the writer dropped";
+        if( sonUartTxPaused )
+        {
+            pageContent += F(", output paused by device");
+        }
+        pageContent += F("<br>\n");
     }
     
 //    if( !beQuiet )
@@ -1159,276 +1775,2280 @@ void dumpInfo()
 //
 void flushCOMPort()
 {
-    while(Serial.available() > 0)
+    while(sonUart->available() > 0)
     {
-        Serial.read();
+        sonUart->read();
     }
 }
 //
 // ************************************************************************
-// process SON (Serial Over Network) 
+// counters of the SON transfer and of the main loop, reported by
+// /api/stats and written to the log every sonStatsLogInterval msecs
+// (0 = never). They only count up, a monitor computes rates from two
+// readings.
+// - a burst is UART data without a pause of SON_BURST_GAP_MS
+// - the latency of a packet is the time from its first byte read from
+//   the UART until it is handed over completely to the network. The
+//   histogram counts packets per power of two msecs: < 1, < 2, < 4 ...
+//   the last bucket takes everything above.
+// - the write times are spent in write() of the network resp. the UART
 // ************************************************************************
 //
-void processSON()
-{
-    if( SONRunning && SONConnected )
-    {
-
-        if( COMServerMode )
-        {
-            if (incomingTelnetConnection && incomingTelnetConnection.connected())
-            {
-                if(incomingTelnetConnection.available())
-                {
-                  //get data from the telnet connection and write to serial port
-                  while(incomingTelnetConnection.available()) 
-                  {
-                      Serial.write(incomingTelnetConnection.read());
-                  }
-                }
-            }
+#define SON_BURST_GAP_MS                  2
+#define SON_LATENCY_BUCKETS              10   // last one is >= 256 ms
+#define FACTORY_SON_STATS_LOG_INTERVAL  60000
+
+unsigned long sonStatsLogInterval = FACTORY_SON_STATS_LOG_INTERVAL;
+
+struct sonCounters {
+    unsigned long toNetBytes;         // UART -> network
+    unsigned long toNetPackets;
+    unsigned long toUartBytes;        // network -> UART
+    unsigned long toUartPackets;      // reads from the network
+    unsigned long uartBursts;
+    unsigned long maxBurst;           // bytes
+    unsigned long latency[SON_LATENCY_BUCKETS];
+    unsigned long maxLatency;         // msecs
+    uint64_t netWriteMicros;
+    uint64_t uartWriteMicros;
+    unsigned long maxWriteMicros;     // longest single write()
+    unsigned long connects;           // clients accepted resp. connections made
+    unsigned long reconnects;         // connections made again by a COM-Client
+    unsigned long connectFails;       // failed connection attempts of a COM-Client
+    unsigned long disconnects;        // connections closed resp. lost
+};
 
-            //check UART for data
-            if(Serial.available())
-            {
-                size_t len = Serial.available();
-                uint8_t sbuf[len];
-                Serial.readBytes(sbuf, len);
-        
-                if(incomingTelnetConnection && incomingTelnetConnection.connected())
-                {
-                    incomingTelnetConnection.write(sbuf, len);
-                    delay(1);
-                }
-            }
-        }
-        else
-        {
-            if (outgoingTelnetConnection && outgoingTelnetConnection.connected())
-            {
-                if(outgoingTelnetConnection.available())
-                {
-                  //get data from the telnet connection and write to serial port
-                  while(outgoingTelnetConnection.available()) 
-                  {
-                      Serial.write(outgoingTelnetConnection.read());
-                  }
-                }
-            }
+struct loopTiming {
+    unsigned long count;
+    unsigned long maxMicros;
+    uint64_t totalMicros;
+};
 
-            //check UART for data
-            if(Serial.available())
-            {
-                size_t len = Serial.available();
-                uint8_t sbuf[len];
-                Serial.readBytes(sbuf, len);
-        
-                if(outgoingTelnetConnection && outgoingTelnetConnection.connected())
-                {
-                    outgoingTelnetConnection.write(sbuf, len);
-                    delay(1);
-                }
-            }
-        }
+static sonCounters sonStats;
+static loopTiming loopStats;
+static unsigned long sonBurstBytes;   // of the current burst
+//
+// ************************************************************************
+// add the duration of a write() to the statistics
+// ************************************************************************
+//
+void sonStatsWriteTime(uint64_t *total, unsigned long duration)
+{
+    *total += duration;
 
+    if( duration > sonStats.maxWriteMicros )
+    {
+        sonStats.maxWriteMicros = duration;
     }
 }
 //
 // ************************************************************************
-// setup SON (Serial Over Network) 
+// count a packet that has been handed over to the network completely,
+// firstRx is the micros() of its first byte
 // ************************************************************************
 //
-void SetupSON()
+void sonStatsPacketSent(unsigned long firstRx)
 {
-    uint8_t serialConfig;
-    unsigned long lBaudRate;
+    unsigned long latency = (micros() - firstRx) / 1000;
+    int bucket = 0;
 
-    if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_SIX) )
+    while( bucket < SON_LATENCY_BUCKETS - 1 && (latency >> bucket) != 0 )
     {
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_NO)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_6N1;
-            }
-            else
-            {
-                serialConfig = SERIAL_6N2;
-            }
-        }
+        bucket++;
+    }
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_EVEN)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_6E1;
-            }
-            else
-            {
-                serialConfig = SERIAL_6E2;
-            }
-        }
+    sonStats.latency[bucket]++;
+    sonStats.toNetPackets++;
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_ODD)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_6O1;
-            }
-            else
-            {
-                serialConfig = SERIAL_6O2;
-            }
-        }
+    if( latency > sonStats.maxLatency )
+    {
+        sonStats.maxLatency = latency;
     }
-
-    if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_SEVEN) )
+}
+//
+// ************************************************************************
+// count bytes read from the UART, a pause of SON_BURST_GAP_MS ends a
+// burst
+// ************************************************************************
+//
+void sonStatsUartRead(size_t len)
+{
+    if( sonBurstBytes == 0 || millis() - sonLastUartRx >= SON_BURST_GAP_MS )
     {
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_NO)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_7N1;
-            }
-            else
-            {
-                serialConfig = SERIAL_7N2;
-            }
-        }
+        sonStats.uartBursts++;
+        sonBurstBytes = 0;
+    }
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_EVEN)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_7E1;
-            }
-            else
-            {
-                serialConfig = SERIAL_7E2;
-            }
-        }
+    sonBurstBytes += len;
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_ODD)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_7O1;
-            }
-            else
-            {
-                serialConfig = SERIAL_7O2;
-            }
-        }
+    if( sonBurstBytes > sonStats.maxBurst )
+    {
+        sonStats.maxBurst = sonBurstBytes;
     }
-
-    if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_EIGHT) )
+}
+//
+// ************************************************************************
+// write the statistics to the log
+// ************************************************************************
+//
+void sonLogStats()
+{
+    if( !beQuiet )
     {
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_NO)) )
-        {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_8N1;
-            }
-            else
-            {
-                serialConfig = SERIAL_8N2;
-            }
-        }
-
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_EVEN)) )
+        Logger.Log(LOGLEVEL_DEBUG, "SON: to net %lu bytes/%lu packets, to UART %lu bytes/%lu packets\n",
+                   sonStats.toNetBytes, sonStats.toNetPackets,
+                   sonStats.toUartBytes, sonStats.toUartPackets);
+        Logger.Log(LOGLEVEL_DEBUG, "SON: %lu bursts (max %lu bytes), latency max %lu ms, write %lu/%lu ms (max %lu us)\n",
+                   sonStats.uartBursts, sonStats.maxBurst, sonStats.maxLatency,
+                   (unsigned long) (sonStats.netWriteMicros / 1000),
+                   (unsigned long) (sonStats.uartWriteMicros / 1000),
+                   sonStats.maxWriteMicros);
+        Logger.Log(LOGLEVEL_DEBUG, "SON: %lu connects, %lu reconnects, %lu failed, %lu disconnects, %lu overruns\n",
+                   sonStats.connects, sonStats.reconnects, sonStats.connectFails,
+                   sonStats.disconnects, sonOverruns);
+    }
+}
+//
+// ************************************************************************
+// true while the device has stopped us by XOFF resp. CTS
+// ************************************************************************
+//
+bool sonUartStopped()
+{
+    return( sonUartTxPaused || (useHwFlowCtrl && digitalRead(SON_CTS_PIN) == HIGH) );
+}
+//
+// ************************************************************************
+// bytes that can be written to the UART now, 0 while the device has
+// stopped us
+// ************************************************************************
+//
+size_t sonUartRoom()
+{
+    if( sonUartStopped() )
+    {
+        return( 0 );
+    }
+
+    if( !useHardSerial )
+    {
+        return( sonSoftBudget );
+    }
+
+    return( Serial.availableForWrite() );
+}
+//
+// ************************************************************************
+// write to the UART, the caller has checked sonUartRoom()
+// ************************************************************************
+//
+size_t sonUartWrite(const uint8_t *data, size_t len)
+{
+    unsigned long start;
+
+    if( !useHardSerial )
+    {
+        sonSoftBudget -= len < sonSoftBudget ? len : sonSoftBudget;
+    }
+
+    start = micros();
+    len = sonUart->write(data, len);
+    sonStatsWriteTime(&sonStats.uartWriteMicros, micros() - start);
+    sonStats.toUartBytes += len;
+    sonStats.toUartPackets++;
+
+    return( len );
+}
+//
+// ************************************************************************
+// true if the UART has lost received data since the last call
+// ************************************************************************
+//
+bool sonUartOverrun()
+{
+    if( !useHardSerial )
+    {
+        return( pSoftSerial != NULL && pSoftSerial->overflow() );
+    }
+
+    return( Serial.hasOverrun() );
+}
+//
+// ************************************************************************
+// tell the device to stop resp. to continue sending
+// ************************************************************************
+//
+void sonSetFlowStopped(bool stop)
+{
+    if( stop == sonFlowStopped )
+    {
+        return;
+    }
+
+    sonFlowStopped = stop;
+
+    if( stop )
+    {
+        sonFlowStops++;
+    }
+
+    if( useFlowCtrl )
+    {
+        sonUart->write(stop ? ASCII_XOFF : ASCII_XON);
+    }
+
+    if( useHwFlowCtrl )
+    {
+        digitalWrite(SON_RTS_PIN, stop ? HIGH : LOW);
+    }
+}
+//
+// ************************************************************************
+// set up resp. release the RTS/CTS pins for the current flow control.
+// Pins used by the software UART are left alone.
+// ************************************************************************
+//
+void sonApplyHandshake()
+{
+    if( useHwFlowCtrl )
+    {
+        pinMode(SON_RTS_PIN, OUTPUT);
+        digitalWrite(SON_RTS_PIN, sonFlowStopped ? HIGH : LOW);
+        pinMode(SON_CTS_PIN, INPUT_PULLUP);
+    }
+    else if( useHardSerial || comHandshakePinsFree(useRxPin.toInt(), useTxPin.toInt()) )
+    {
+        pinMode(SON_RTS_PIN, INPUT);
+        pinMode(SON_CTS_PIN, INPUT);
+    }
+
+    if( !useFlowCtrl )
+    {
+        // a XOFF received before would pause us for ever
+        sonUartTxPaused = false;
+    }
+}
+//
+// ************************************************************************
+// check the fill level of the RX ring against the water marks and the
+// state of the network send queue
+// ************************************************************************
+//
+void sonFlowControl()
+{
+    size_t pending = sonUart->available();
+    size_t ringSize = useHardSerial ? sonRxBufferSize : SON_SOFT_RX_BUFSIZE;
+    bool queueFull = sonSendPacket >= 0 &&
+                     sonUartPackets[sonFillPacket].len >= sizeof(sonUartPackets[0].data);
+
+    if( sonUartOverrun() )
+    {
+        sonOverruns++;
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_WARNING, "UART RX overrun\n");
+        }
+    }
+
+    if( !sonFlowStopped && (pending >= ringSize * 3 / 4 ||
+                            (queueFull && pending >= ringSize / 2)) )
+    {
+        sonSetFlowStopped(true);
+    }
+    else if( sonFlowStopped && !queueFull && pending <= ringSize / 4 )
+    {
+        sonSetFlowStopped(false);
+    }
+}
+//
+// ************************************************************************
+// remove XON/XOFF from data received by the UART and pause resp. resume
+// writing to the UART. Returns the length of the remaining data.
+// ************************************************************************
+//
+size_t sonFilterFlowChars(uint8_t *data, size_t len)
+{
+    size_t out = 0;
+
+    for( size_t i = 0; i < len; i++ )
+    {
+        if( data[i] == ASCII_XOFF )
+        {
+            sonUartTxPaused = true;
+        }
+        else if( data[i] == ASCII_XON )
+        {
+            sonUartTxPaused = false;
+        }
+        else
+        {
+            data[out++] = data[i];
+        }
+    }
+
+    return( out );
+}
+//
+// ************************************************************************
+// copy data received from the network to the UART
+// - never write more than the UART can take without blocking, the
+//   rest stays in the TCP receive buffer until the next loop
+// ************************************************************************
+//
+void sonNetToUart(WiFiClient &sonClient)
+{
+    size_t len, room;
+
+    while( (len = sonClient.available()) > 0 &&
+           (room = sonUartRoom()) > 0 )
+    {
+        if( len > room )
+        {
+            len = room;
+        }
+
+        if( len > sizeof(sonNetBuffer) )
+        {
+            len = sizeof(sonNetBuffer);
+        }
+
+        if( (len = sonClient.read(sonNetBuffer, len)) == 0 )
+        {
+            break;
+        }
+
+        sonUartWrite(sonNetBuffer, len);
+    }
+}
+//
+// ************************************************************************
+// append UART data to the output queue of a client, the oldest data is
+// overwritten if the queue is full
+// ************************************************************************
+//
+void sonQueueData(sonClientSlot *slot, const uint8_t *data, size_t len)
+{
+    size_t tail, chunk, drop;
+
+    if( len > sizeof(slot->queue) )
+    {
+        slot->dropped += len - sizeof(slot->queue);
+        data += len - sizeof(slot->queue);
+        len = sizeof(slot->queue);
+    }
+
+    if( slot->len + len > sizeof(slot->queue) )
+    {
+        drop = slot->len + len - sizeof(slot->queue);
+        slot->dropped += drop;
+        slot->head = (slot->head + drop) % sizeof(slot->queue);
+        slot->len -= drop;
+    }
+
+    tail = (slot->head + slot->len) % sizeof(slot->queue);
+    chunk = sizeof(slot->queue) - tail;
+
+    if( chunk > len )
+    {
+        chunk = len;
+    }
+
+    memcpy(slot->queue + tail, data, chunk);
+    memcpy(slot->queue, data + chunk, len - chunk);
+    slot->len += len;
+}
+//
+// ************************************************************************
+// queue a complete Telnet answer. If it does not fit, it is dropped
+// as a whole.
+// ************************************************************************
+//
+void sonQueueControl(sonClientSlot *slot, const uint8_t *data, size_t len)
+{
+    if( slot->ctrlLen + len > sizeof(slot->ctrl) )
+    {
+        slot->dropped += len;
+    }
+    else
+    {
+        memcpy(slot->ctrl + slot->ctrlLen, data, len);
+        slot->ctrlLen += len;
+    }
+}
+//
+// ************************************************************************
+// write the first len bytes of the queue to a Telnet client with 0xff
+// doubled, returns the bytes of the queue that were sent. If only the
+// first IAC of a pair went out, the second one is left in tnIacPending.
+// ************************************************************************
+//
+size_t sonSendTelnetData(sonClientSlot *slot, size_t len, size_t room)
+{
+    uint8_t buf[SON_CLIENT_SEND_CHUNK];
+    const uint8_t *data = slot->queue + slot->head;
+    size_t used = 0, n = 0, sent, pos = 0;
+    size_t retVal = 0;
+
+    while( used < len && n + 2 <= sizeof(buf) && n < room )
+    {
+        buf[n++] = data[used];
+
+        if( data[used++] == TELNET_IAC )
+        {
+            buf[n++] = TELNET_IAC;
+        }
+    }
+
+    sent = slot->client.write(buf, n);
+
+    while( pos < sent )
+    {
+        pos += data[retVal++] == TELNET_IAC ? 2 : 1;
+    }
+
+    if( pos > sent )
+    {
+        slot->tnIacPending = true;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// send as much of the queued data as the client takes without blocking.
+// The rest of a split IAC IAC goes first, then the Telnet answers.
+// ************************************************************************
+//
+void sonFlushQueue(sonClientSlot *slot)
+{
+    static const uint8_t iac = TELNET_IAC;
+    size_t len, room;
+
+    if( slot->tnIacPending && slot->client.availableForWrite() > 0 &&
+        slot->client.write(&iac, 1) == 1 )
+    {
+        slot->tnIacPending = false;
+    }
+
+    if( !slot->tnIacPending && slot->ctrlLen > 0 &&
+        (room = slot->client.availableForWrite()) > 0 )
+    {
+        len = slot->client.write(slot->ctrl, slot->ctrlLen < room ? slot->ctrlLen : room);
+        memmove(slot->ctrl, slot->ctrl + len, slot->ctrlLen - len);
+        slot->ctrlLen -= len;
+    }
+
+    while( slot->len > 0 && !slot->tnIacPending && slot->ctrlLen == 0 &&
+           !slot->tnSuspended && (room = slot->client.availableForWrite()) > 0 )
+    {
+        // contiguous part up to the end of the queue
+        len = sizeof(slot->queue) - slot->head;
+
+        if( len > slot->len )
+        {
+            len = slot->len;
+        }
+
+        if( slot->telnet == SON_TELNET_ON )
+        {
+            len = sonSendTelnetData(slot, len, room);
+        }
+        else
+        {
+            if( len > room )
+            {
+                len = room;
+            }
+
+            len = slot->client.write(slot->queue + slot->head, len);
+        }
+
+        if( len == 0 )
+        {
+            break;
+        }
+
+        slot->head = (slot->head + len) % sizeof(slot->queue);
+        slot->len -= len;
+    }
+}
+//
+// ************************************************************************
+// send a COM-PORT-OPTION answer: IAC SB 44 <cmd + 100> <value> IAC SE,
+// 0xff in the value is doubled
+// ************************************************************************
+//
+void sonRfc2217Reply(sonClientSlot *slot, uint8_t cmd, const uint8_t *value, size_t len)
+{
+    uint8_t reply[4 + 2 * SON_TELNET_SB_SIZE + 2] =
+        { TELNET_IAC, TELNET_SB, TELNET_OPT_COM_PORT, (uint8_t) (cmd + RFC2217_SERVER_OFFSET) };
+    size_t n = 4;
+
+    for( size_t i = 0; i < len && i < SON_TELNET_SB_SIZE; i++ )
+    {
+        reply[n++] = value[i];
+
+        if( value[i] == TELNET_IAC )
+        {
+            reply[n++] = TELNET_IAC;
+        }
+    }
+
+    reply[n++] = TELNET_IAC;
+    reply[n++] = TELNET_SE;
+    sonQueueControl(slot, reply, n);
+}
+//
+// ************************************************************************
+// map a supported option and direction to a bit in tnAgreed,
+// returns 0 for options we refuse
+// ************************************************************************
+//
+uint8_t sonTelnetBit(uint8_t option, bool local)
+{
+    uint8_t retVal = 0;
+
+    switch( option )
+    {
+        case TELNET_OPT_BINARY:
+            retVal = 0x01;
+            break;
+        case TELNET_OPT_SGA:
+            retVal = 0x02;
+            break;
+        case TELNET_OPT_COM_PORT:
+            retVal = 0x04;
+            break;
+    }
+
+    return( local ? retVal : retVal << 4 );
+}
+//
+// ************************************************************************
+// answer WILL/WONT/DO/DONT. Each change of an option is confirmed only
+// once, so there is no negotiation loop.
+// ************************************************************************
+//
+void sonTelnetOption(sonClientSlot *slot, uint8_t verb, uint8_t option)
+{
+    uint8_t reply[3] = { TELNET_IAC, 0, option };
+    // DO/DONT refer to our side of the option, WILL/WONT to the client's
+    bool local = verb == TELNET_DO || verb == TELNET_DONT;
+    bool enable = verb == TELNET_DO || verb == TELNET_WILL;
+    uint8_t bit = sonTelnetBit(option, local);
+
+    if( enable && bit != 0 && !(slot->tnAgreed & bit) )
+    {
+        slot->tnAgreed |= bit;
+        reply[1] = local ? TELNET_WILL : TELNET_DO;
+    }
+    else if( enable && bit == 0 )
+    {
+        reply[1] = local ? TELNET_WONT : TELNET_DONT;
+    }
+    else if( !enable && (slot->tnAgreed & bit) )
+    {
+        slot->tnAgreed &= ~bit;
+        reply[1] = local ? TELNET_WONT : TELNET_DONT;
+    }
+
+    if( reply[1] != 0 )
+    {
+        sonQueueControl(slot, reply, sizeof(reply));
+    }
+}
+//
+// ************************************************************************
+// current line settings as RFC 2217 values
+// ************************************************************************
+//
+uint8_t sonRfc2217Parity()
+{
+    uint8_t retVal = RFC2217_PARITY_NONE;
+
+    if( comLine.parity == COM_PARITY_ODD )
+    {
+        retVal = RFC2217_PARITY_ODD;
+    }
+    else if( comLine.parity == COM_PARITY_EVEN )
+    {
+        retVal = RFC2217_PARITY_EVEN;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// the flow control as RFC 2217 value, none is the value for no flow
+// control of the direction asked for. The values for XON/XOFF and
+// hardware follow it.
+// ************************************************************************
+//
+uint8_t sonRfc2217Flow(uint8_t none)
+{
+    uint8_t retVal = none;
+
+    if( useFlowCtrl )
+    {
+        retVal = none + 1;
+    }
+    else if( useHwFlowCtrl )
+    {
+        retVal = none + 2;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// handle a complete COM-PORT-OPTION subnegotiation of a client. Only
+// the writer may change settings, everybody gets the current value.
+// ************************************************************************
+//
+void sonRfc2217Command(int idx)
+{
+    sonClientSlot *slot = &sonClients[idx];
+    bool writer = sonWriter == idx;
+    uint8_t cmd = slot->tnSb[1];
+    uint8_t *arg = slot->tnSb + 2;
+    size_t argLen = slot->tnSbLen - 2;
+    uint8_t value[4];
+    unsigned long baud;
+    bool changed = false;
+    comLineSettings oldLine = comLine;
+
+    switch( cmd )
+    {
+        case RFC2217_SIGNATURE:
+            if( argLen == 0 )
+            {
+                sonRfc2217Reply(slot, cmd, (const uint8_t *) nodeName.c_str(),
+                                nodeName.length());
+            }
+            break;
+
+        case RFC2217_SET_BAUDRATE:
+            if( argLen == 4 )
+            {
+                baud = ((unsigned long) arg[0] << 24) | ((unsigned long) arg[1] << 16) |
+                       ((unsigned long) arg[2] << 8) | arg[3];
+
+                if( writer && baud >= SON_MIN_BAUDRATE && baud <= SON_MAX_BAUDRATE )
+                {
+                    comLine.baud = baud;
+                    changed = true;
+                }
+            }
+            baud = comLine.baud;
+            value[0] = (uint8_t) (baud >> 24);
+            value[1] = (uint8_t) (baud >> 16);
+            value[2] = (uint8_t) (baud >> 8);
+            value[3] = (uint8_t) baud;
+            sonRfc2217Reply(slot, cmd, value, 4);
+            break;
+
+        case RFC2217_SET_DATASIZE:
+            if( writer && argLen == 1 && arg[0] >= COM_DATABITS_6 && arg[0] <= COM_DATABITS_8 )
+            {
+                comLine.dataBits = (comDataBits) arg[0];
+                changed = true;
+            }
+            value[0] = comLine.dataBits;
+            sonRfc2217Reply(slot, cmd, value, 1);
+            break;
+
+        case RFC2217_SET_PARITY:
+            if( writer && argLen == 1 )
+            {
+                changed = true;
+                switch( arg[0] )
+                {
+                    case RFC2217_PARITY_NONE:
+                        comLine.parity = COM_PARITY_NONE;
+                        break;
+                    case RFC2217_PARITY_ODD:
+                        comLine.parity = COM_PARITY_ODD;
+                        break;
+                    case RFC2217_PARITY_EVEN:
+                        comLine.parity = COM_PARITY_EVEN;
+                        break;
+                    default:
+                        // query, mark and space
+                        changed = false;
+                        break;
+                }
+            }
+            value[0] = sonRfc2217Parity();
+            sonRfc2217Reply(slot, cmd, value, 1);
+            break;
+
+        case RFC2217_SET_STOPSIZE:
+            if( writer && argLen == 1 && (arg[0] == 1 || arg[0] == 2) )
+            {
+                comLine.stopBits = (comStopBits) arg[0];
+                changed = true;
+            }
+            value[0] = comLine.stopBits;
+            sonRfc2217Reply(slot, cmd, value, 1);
+            break;
+
+        case RFC2217_SET_CONTROL:
+            value[0] = argLen == 1 ? arg[0] : RFC2217_CONTROL_FLOW_QUERY;
+
+            if( value[0] <= RFC2217_CONTROL_FLOW_HARDWARE )
+            {
+                if( writer && value[0] == RFC2217_CONTROL_FLOW_NONE )
+                {
+                    useFlowCtrl = false;
+                    useHwFlowCtrl = false;
+                    sonApplyHandshake();
+                }
+                else if( writer && value[0] == RFC2217_CONTROL_FLOW_XONXOFF )
+                {
+                    useFlowCtrl = true;
+                    useHwFlowCtrl = false;
+                    sonApplyHandshake();
+                }
+                else if( writer && value[0] == RFC2217_CONTROL_FLOW_HARDWARE &&
+                         (useHardSerial || comHandshakePinsFree(sonSoftRxPin, sonSoftTxPin)) )
+                {
+                    useFlowCtrl = false;
+                    useHwFlowCtrl = true;
+                    sonApplyHandshake();
+                }
+                value[0] = sonRfc2217Flow(RFC2217_CONTROL_FLOW_NONE);
+            }
+            else if( value[0] <= RFC2217_CONTROL_BREAK_OFF )
+            {
+                // there is no break support
+                value[0] = RFC2217_CONTROL_BREAK_OFF;
+            }
+            else if( value[0] <= RFC2217_CONTROL_DTR_OFF )
+            {
+                // no modem lines, report them as active
+                value[0] = RFC2217_CONTROL_DTR_ON;
+            }
+            else if( value[0] <= RFC2217_CONTROL_RTS_OFF )
+            {
+                value[0] = RFC2217_CONTROL_RTS_ON;
+            }
+            else if( value[0] <= RFC2217_CONTROL_INFLOW_HARDWARE )
+            {
+                value[0] = sonRfc2217Flow(RFC2217_CONTROL_INFLOW_NONE);
+            }
+            sonRfc2217Reply(slot, cmd, value, 1);
+            break;
+
+        case RFC2217_FLOWCONTROL_SUSPEND:
+            slot->tnSuspended = true;
+            break;
+
+        case RFC2217_FLOWCONTROL_RESUME:
+            slot->tnSuspended = false;
+            break;
+
+        case RFC2217_SET_LINESTATE_MASK:
+        case RFC2217_SET_MODEMSTATE_MASK:
+            // nothing is notified, the mask is just confirmed
+            sonRfc2217Reply(slot, cmd, arg, argLen);
+            break;
+
+        case RFC2217_PURGE_DATA:
+            if( writer && argLen == 1 &&
+                (arg[0] == RFC2217_PURGE_RX || arg[0] == RFC2217_PURGE_BOTH) )
+            {
+                // UART data not yet sent to the network
+                while( sonUart->available() > 0 )
+                {
+                    sonUart->read();
+                }
+                sonUartPackets[0].len = sonUartPackets[1].len = 0;
+                sonSendPacket = -1;
+
+                // and what is queued for the clients, they all get it
+                for( int i = 0; i < SON_MAX_CLIENTS; i++ )
+                {
+                    sonClients[i].len = 0;
+                }
+            }
+            if( writer && argLen == 1 &&
+                (arg[0] == RFC2217_PURGE_TX || arg[0] == RFC2217_PURGE_BOTH) )
+            {
+                // data held back while the device has stopped us
+                sonHoldLen = 0;
+            }
+            sonRfc2217Reply(slot, cmd, arg, argLen);
+            break;
+    }
+
+    if( changed && !useHardSerial && !comSoftSerialCapable(&comLine) )
+    {
+        // keep what the software UART runs with
+        comLine = oldLine;
+        changed = false;
+    }
+
+    if( changed )
+    {
+        sonApplyLineSettings();
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "RFC 2217: line settings now %lu %u%c%u\n",
+                       (unsigned long) comLine.baud, comLine.dataBits,
+                       "NEO"[comLine.parity], comLine.stopBits);
+        }
+    }
+}
+//
+// ************************************************************************
+// run the Telnet parser over data received from a client. IAC
+// sequences are handled and removed, the remaining data is moved to
+// the start of the buffer. Returns its length.
+// ************************************************************************
+//
+size_t sonTelnetFilter(int idx, uint8_t *buf, size_t len)
+{
+    sonClientSlot *slot = &sonClients[idx];
+    size_t out = 0;
+    uint8_t c;
+
+    for( size_t i = 0; i < len; i++ )
+    {
+        c = buf[i];
+
+        switch( slot->tnState )
+        {
+            case TN_DATA:
+                if( c == TELNET_IAC )
+                {
+                    slot->tnState = TN_IAC;
+                }
+                else
+                {
+                    buf[out++] = c;
+                }
+                break;
+
+            case TN_IAC:
+                slot->tnState = TN_DATA;
+                if( c == TELNET_IAC )
+                {
+                    buf[out++] = c;
+                }
+                else if( c >= TELNET_WILL )
+                {
+                    slot->tnVerb = c;
+                    slot->tnState = TN_OPTION;
+                }
+                else if( c == TELNET_SB )
+                {
+                    slot->tnSbLen = 0;
+                    slot->tnState = TN_SB;
+                }
+                // other commands (NOP, AYT, ...) are ignored
+                break;
+
+            case TN_OPTION:
+                sonTelnetOption(slot, slot->tnVerb, c);
+                slot->tnState = TN_DATA;
+                break;
+
+            case TN_SB:
+                if( c == TELNET_IAC )
+                {
+                    slot->tnState = TN_SB_IAC;
+                }
+                else if( slot->tnSbLen < sizeof(slot->tnSb) )
+                {
+                    slot->tnSb[slot->tnSbLen++] = c;
+                }
+                break;
+
+            case TN_SB_IAC:
+                if( c == TELNET_IAC )
+                {
+                    if( slot->tnSbLen < sizeof(slot->tnSb) )
+                    {
+                        slot->tnSb[slot->tnSbLen++] = c;
+                    }
+                    slot->tnState = TN_SB;
+                }
+                else
+                {
+                    // IAC SE, anything else aborts the subnegotiation
+                    if( c == TELNET_SE && slot->tnSbLen >= 2 &&
+                        slot->tnSb[0] == TELNET_OPT_COM_PORT )
+                    {
+                        sonRfc2217Command(idx);
+                    }
+                    slot->tnState = TN_DATA;
+                }
+                break;
+        }
+    }
+
+    return( out );
+}
+//
+// ************************************************************************
+// write the data held back for the writer to the UART, as far as it
+// takes it
+// ************************************************************************
+//
+void sonFlushHold()
+{
+    size_t len = sonUartRoom();
+
+    if( len > sonHoldLen )
+    {
+        len = sonHoldLen;
+    }
+
+    if( len > 0 )
+    {
+        len = sonUartWrite(sonHold, len);
+        memmove(sonHold, sonHold + len, sonHoldLen - len);
+        sonHoldLen -= len;
+    }
+}
+//
+// ************************************************************************
+// hold back data of the writer until the UART takes it again. What does
+// not fit is dropped.
+// ************************************************************************
+//
+void sonHoldData(const uint8_t *data, size_t len)
+{
+    size_t room = sizeof(sonHold) - sonHoldLen;
+
+    if( len > room )
+    {
+        sonHoldDropped += len - room;
+        len = room;
+    }
+
+    memcpy(sonHold + sonHoldLen, data, len);
+    sonHoldLen += len;
+}
+//
+// ************************************************************************
+// send FLOWCONTROL-SUSPEND to a Telnet writer while the device has
+// stopped us resp. data is held back, FLOWCONTROL-RESUME afterwards.
+// Only a client that has agreed to COM-PORT-OPTION gets them.
+// ************************************************************************
+//
+void sonWriterFlow(int idx)
+{
+    sonClientSlot *slot = &sonClients[idx];
+    bool suspend = sonHoldLen > 0 || sonUartStopped();
+
+    // IAC SB 44 <cmd> IAC SE, the state is kept if it does not fit
+    if( suspend != sonWriterSuspended &&
+        (slot->tnAgreed & sonTelnetBit(TELNET_OPT_COM_PORT, false)) &&
+        slot->ctrlLen + 6 <= sizeof(slot->ctrl) )
+    {
+        sonWriterSuspended = suspend;
+        sonRfc2217Reply(slot, suspend ? RFC2217_FLOWCONTROL_SUSPEND : RFC2217_FLOWCONTROL_RESUME,
+                        NULL, 0);
+    }
+}
+//
+// ************************************************************************
+// read the input of a client. The writer's data goes to the UART,
+// bounded by the room there, the data of monitors is discarded. The
+// first client that sends data while nobody holds the lease gets it.
+// While the device has stopped us, a Telnet writer is still read, so
+// its commands are handled. Its data is held back meanwhile.
+// ************************************************************************
+//
+void sonClientInput(int idx)
+{
+    sonClientSlot *slot = &sonClients[idx];
+    size_t len, room;
+    bool hold;
+    int got;
+
+    if( slot->telnet == SON_TELNET_UNKNOWN && slot->client.available() > 0 )
+    {
+        slot->telnet = slot->client.peek() == TELNET_IAC ? SON_TELNET_ON : SON_TELNET_OFF;
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "client %d is a %s client\n", idx,
+                       slot->telnet == SON_TELNET_ON ? "Telnet" : "raw");
+        }
+    }
+
+    if( sonWriter == idx )
+    {
+        sonFlushHold();
+    }
+
+    while( (len = slot->client.available()) > 0 )
+    {
+        room = sonWriter == idx ? sonUartRoom() : sizeof(sonNetBuffer);
+        hold = false;
+
+        if( sonWriter == idx && (room == 0 || sonHoldLen > 0) )
+        {
+            // a raw client has no commands, it just waits
+            if( slot->telnet != SON_TELNET_ON || !sonUartStopped() )
+            {
+                break;
+            }
+
+            hold = true;
+            room = sizeof(sonNetBuffer);
+        }
+
+        if( len > room )
+        {
+            len = room;
+        }
+
+        if( len > sizeof(sonNetBuffer) )
+        {
+            len = sizeof(sonNetBuffer);
+        }
+
+        if( (got = slot->client.read(sonNetBuffer, len)) <= 0 )
+        {
+            break;
+        }
+
+        if( slot->telnet == SON_TELNET_ON )
+        {
+            got = sonTelnetFilter(idx, sonNetBuffer, got);
+        }
+
+        if( got > 0 && sonWriter < 0 )
+        {
+            sonWriter = idx;
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "client %d took the writer lease\n", idx);
+            }
+        }
+
+        if( got > 0 && sonWriter == idx )
+        {
+            // the lease may have been taken just now without asking for room
+            if( hold || sonUartRoom() < (size_t) got )
+            {
+                sonHoldData(sonNetBuffer, got);
+            }
+            else
+            {
+                sonUartWrite(sonNetBuffer, got);
+            }
+        }
+    }
+
+    if( sonWriter == idx && slot->telnet == SON_TELNET_ON )
+    {
+        sonWriterFlow(idx);
+    }
+}
+//
+// ************************************************************************
+// close the connection of a client and free its slot
+// ************************************************************************
+//
+void sonDropClient(int idx)
+{
+    sonClients[idx].client.stop();
+    sonClients[idx].used = false;
+    sonStats.disconnects++;
+    sonClients[idx].len = 0;
+    sonClients[idx].ctrlLen = 0;
+    sonNumClients--;
+
+    if( sonWriter == idx )
+    {
+        sonWriter = -1;
+        sonHoldLen = 0;
+        sonWriterSuspended = false;
+    }
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "client %d dropped, %lu bytes lost\n",
+                   idx, sonClients[idx].dropped);
+    }
+
+    SONConnected = sonNumClients > 0;
+}
+//
+// ************************************************************************
+// close all client connections
+// ************************************************************************
+//
+void sonDropAllClients()
+{
+    for( int i = 0; i < SON_MAX_CLIENTS; i++ )
+    {
+        if( sonClients[i].used )
+        {
+            sonDropClient(i);
+        }
+    }
+}
+//
+// ************************************************************************
+// drop clients that have gone and accept new ones. A connection request
+// that finds all slots busy is refused, the existing sessions are kept.
+// ************************************************************************
+//
+void sonAcceptClients()
+{
+    int i;
+
+    for( i = 0; i < SON_MAX_CLIENTS; i++ )
+    {
+        if( sonClients[i].used && !sonClients[i].client.connected() )
+        {
+            sonDropClient(i);
+        }
+    }
+
+    while( TelnetServer.hasClient() )
+    {
+        for( i = 0; i < SON_MAX_CLIENTS && sonClients[i].used; i++ )
+            ;
+
+        if( i >= SON_MAX_CLIENTS )
+        {
+            WiFiClient refused = TelnetServer.available();
+            refused.stop();
+
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG, "Connection request refused, no free slot\n");
+            }
+            continue;
+        }
+
+        sonClients[i].client = TelnetServer.available();
+        sonClients[i].client.setNoDelay(true);
+        sonClients[i].used = true;
+        sonClients[i].head = 0;
+        sonClients[i].len = 0;
+        sonClients[i].dropped = 0;
+        sonClients[i].ctrlLen = 0;
+        sonClients[i].tnIacPending = false;
+        sonClients[i].telnet = SON_TELNET_UNKNOWN;
+        sonClients[i].tnState = TN_DATA;
+        sonClients[i].tnAgreed = 0;
+        sonClients[i].tnSuspended = false;
+        sonClients[i].tnSbLen = 0;
+        sonNumClients++;
+        sonStats.connects++;
+        SONConnected = true;
+
+        if( sonWriter < 0 )
+        {
+            sonWriter = i;
+        }
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "client %d connected as %s\n",
+                       i, sonWriter == i ? "writer" : "monitor");
+        }
+    }
+}
+//
+// ************************************************************************
+// exchange data with the clients of a COM-Server
+// - input of the writer goes to the UART, input of monitors is discarded
+// - Telnet commands are answered
+// - the output queues are flushed
+// ************************************************************************
+//
+void sonServeClients()
+{
+    for( int i = 0; i < SON_MAX_CLIENTS; i++ )
+    {
+        if( sonClients[i].used )
+        {
+            sonClientInput(i);
+            sonFlushQueue(&sonClients[i]);
+        }
+    }
+}
+//
+// ************************************************************************
+// true if data can be sent to the peer
+// ************************************************************************
+//
+bool sonLinkUp()
+{
+    if( COMProtocolTCP && COMServerMode )
+    {
+        return( sonNumClients > 0 );
+    }
+
+    if( COMProtocolTCP )
+    {
+        return( outgoingTelnetConnection && outgoingTelnetConnection.connected() );
+    }
+
+    return( SONConnected );
+}
+//
+// ************************************************************************
+// send data to the peer without blocking, returns the bytes taken
+// - a COM-Server copies the block to the queue of each client
+// - TCP takes what fits into its send buffer
+// - UDP sends the whole block as one datagram or nothing
+// ************************************************************************
+//
+size_t sonLinkWrite(const uint8_t *data, size_t len)
+{
+    uint8_t seq[SON_UDP_SEQ_LEN];
+
+    if( COMProtocolTCP && COMServerMode )
+    {
+        for( int i = 0; i < SON_MAX_CLIENTS; i++ )
+        {
+            if( sonClients[i].used )
+            {
+                sonQueueData(&sonClients[i], data, len);
+                sonFlushQueue(&sonClients[i]);
+            }
+        }
+
+        return( len );
+    }
+
+    if( COMProtocolTCP )
+    {
+        if( len > (size_t) outgoingTelnetConnection.availableForWrite() )
+        {
+            len = outgoingTelnetConnection.availableForWrite();
+        }
+
+        return( len > 0 ? outgoingTelnetConnection.write(data, len) : 0 );
+    }
+
+    if( !sonUdp.beginPacket(sonUdpPeerIP, sonUdpPeerPort) )
+    {
+        return( 0 );
+    }
+
+    if( sonUdpSequence )
+    {
+        seq[0] = (uint8_t) (sonUdpTxSeq >> 8);
+        seq[1] = (uint8_t) sonUdpTxSeq;
+        sonUdp.write(seq, sizeof(seq));
+    }
+
+    sonUdp.write(data, len);
+
+    if( !sonUdp.endPacket() )
+    {
+        return( 0 );
+    }
+
+    sonUdpTxSeq++;
+
+    return( len );
+}
+//
+// ************************************************************************
+// copy received datagrams to the UART
+// - a datagram that does not fit into the UART is kept and continued
+//   in the next loop
+// - a COM-Server takes the sender of the first datagram as its peer
+// ************************************************************************
+//
+void sonUdpToUart()
+{
+    size_t len, room;
+    int got;
+    uint8_t seq[SON_UDP_SEQ_LEN];
+    uint16_t rxSeq;
+
+    while( (room = sonUartRoom()) > 0 )
+    {
+        if( sonUdpPending <= 0 )
+        {
+            if( (sonUdpPending = sonUdp.parsePacket()) <= 0 )
+            {
+                break;
+            }
+
+            if( !SONConnected )
+            {
+                if( !COMServerMode )
+                {
+                    sonUdp.flush();
+                    sonUdpPending = 0;
+                    continue;
+                }
+
+                sonUdpPeerIP = sonUdp.remoteIP();
+                sonUdpPeerPort = sonUdp.remotePort();
+                sonUdpRxSynced = false;
+                sonStats.connects++;
+                SONConnected = true;
+
+                if( !beQuiet )
+                {
+                    Logger.Log(LOGLEVEL_DEBUG, "UDP peer is %s:%u\n",
+                               sonUdpPeerIP.toString().c_str(), sonUdpPeerPort);
+                }
+            }
+            else if( sonUdp.remoteIP() != sonUdpPeerIP ||
+                     (COMServerMode && sonUdp.remotePort() != sonUdpPeerPort) )
+            {
+                // not from our peer
+                sonUdp.flush();
+                sonUdpPending = 0;
+                continue;
+            }
+
+            if( sonUdpSequence && sonUdpPending >= SON_UDP_SEQ_LEN )
+            {
+                sonUdp.read(seq, sizeof(seq));
+                sonUdpPending -= SON_UDP_SEQ_LEN;
+                rxSeq = ((uint16_t) seq[0] << 8) | seq[1];
+
+                // the first datagram of a peer sets where it counts from
+                if( sonUdpRxSynced && rxSeq != sonUdpRxSeq )
+                {
+                    sonUdpLost += (uint16_t) (rxSeq - sonUdpRxSeq);
+
+                    if( !beQuiet )
+                    {
+                        Logger.Log(LOGLEVEL_WARNING, "UDP: %u datagram(s) lost\n",
+                                   (uint16_t) (rxSeq - sonUdpRxSeq));
+                    }
+                }
+
+                sonUdpRxSeq = rxSeq + 1;
+                sonUdpRxSynced = true;
+            }
+        }
+
+        len = sonUdpPending;
+
+        if( len > room )
+        {
+            len = room;
+        }
+
+        if( len > sizeof(sonNetBuffer) )
+        {
+            len = sizeof(sonNetBuffer);
+        }
+
+        if( len > 0 && (got = sonUdp.read(sonNetBuffer, len)) > 0 )
+        {
+            sonUartWrite(sonNetBuffer, got);
+            sonUdpPending -= got;
+        }
+        else
+        {
+            sonUdpPending = 0;
+        }
+    }
+}
+//
+// ************************************************************************
+// send as much of the pending packet as the connection takes without
+// blocking
+// ************************************************************************
+//
+void sonSendPending()
+{
+    sonPacket *pkt;
+    size_t len;
+    unsigned long start;
+
+    if( sonSendPacket >= 0 )
+    {
+        pkt = &sonUartPackets[sonSendPacket];
+        len = pkt->len - pkt->sent;
+
+        if( len > 0 )
+        {
+            start = micros();
+            len = sonLinkWrite(pkt->data + pkt->sent, len);
+            sonStatsWriteTime(&sonStats.netWriteMicros, micros() - start);
+            pkt->sent += len;
+            sonStats.toNetBytes += len;
+        }
+
+        if( pkt->sent >= pkt->len )
+        {
+            sonStatsPacketSent(pkt->firstRx);
+            sonSendPacket = -1;
+        }
+    }
+}
+//
+// ************************************************************************
+// hand the first len bytes of the fill packet over for sending, the
+// rest becomes the beginning of the next packet
+// ************************************************************************
+//
+void sonSealPacket(size_t len)
+{
+    sonPacket *full = &sonUartPackets[sonFillPacket];
+    sonPacket *next = &sonUartPackets[sonFillPacket ^ 1];
+
+    next->len = full->len - len;
+    next->sent = 0;
+    next->firstRx = micros();
+    memcpy(next->data, full->data + len, next->len);
+
+    full->len = len;
+    full->sent = 0;
+
+    sonSendPacket = sonFillPacket;
+    sonFillPacket ^= 1;
+}
+//
+// ************************************************************************
+// copy data received by the UART to the network
+// - if there is no connection the data is discarded
+// ************************************************************************
+//
+void sonUartToNet()
+{
+    sonPacket *pkt = &sonUartPackets[sonFillPacket];
+    size_t len, room, maxBytes;
+    uint8_t *delim;
+    bool seal;
+
+    if( !sonLinkUp() )
+    {
+        while( (len = sonUart->available()) > 0 )
+        {
+            if( len > sizeof(pkt->data) )
+            {
+                len = sizeof(pkt->data);
+            }
+
+            sonUart->readBytes(sonUartPackets[0].data, len);
+        }
+
+        sonUartPackets[0].len = sonUartPackets[1].len = 0;
+        sonSendPacket = -1;
+        return;
+    }
+
+    sonSendPending();
+
+    maxBytes = sonPacketMaxBytes;
+    if( maxBytes == 0 || maxBytes > sizeof(pkt->data) )
+    {
+        maxBytes = sizeof(pkt->data);
+    }
+
+    room = maxBytes > pkt->len ? maxBytes - pkt->len : 0;
+
+    if( room > 0 && (len = sonUart->available()) > 0 )
+    {
+        if( len > room )
+        {
+            len = room;
+        }
+
+        len = sonUart->readBytes(pkt->data + pkt->len, len);
+
+        if( sonFlowStopped )
+        {
+            sonHeldBytes += len;
+        }
+
+        if( useFlowCtrl )
+        {
+            len = sonFilterFlowChars(pkt->data + pkt->len, len);
+        }
+
+        if( pkt->len == 0 )
+        {
+            pkt->firstRx = micros();
+        }
+
+        sonStatsUartRead(len);
+        pkt->len += len;
+        sonLastUartRx = millis();
+    }
+
+    // a packet can only be sealed while the other buffer is free
+    if( pkt->len > 0 && sonSendPacket < 0 )
+    {
+        len = pkt->len;
+        seal = pkt->len >= maxBytes;
+
+        if( sonPacketDelimiter >= 0 &&
+            (delim = (uint8_t *) memchr(pkt->data, sonPacketDelimiter, pkt->len)) != NULL )
+        {
+            len = delim - pkt->data + 1;
+            seal = true;
+        }
+
+        if( !seal && sonUart->available() == 0 &&
+            millis() - sonLastUartRx >= sonPacketTimeout )
+        {
+            seal = true;
+        }
+
+        if( seal )
+        {
+            sonSealPacket(len);
+            sonSendPending();
+        }
+    }
+}
+//
+// ************************************************************************
+// process SON (Serial Over Network) 
+// ************************************************************************
+//
+void processSON()
+{
+    if( SONRunning )
+    {
+        sonSoftBudget = comLine.baud / 10 * SON_SOFT_MAX_BLOCK_MS / 1000 + 1;
+        sonFlowControl();
+    }
+
+    if( SONRunning && !COMProtocolTCP )
+    {
+        // runs while not connected, too, to learn the peer
+        sonUdpToUart();
+        sonUartToNet();
+    }
+    else if( SONRunning && SONConnected && COMServerMode )
+    {
+        sonServeClients();
+        sonUartToNet();
+    }
+    else if( SONRunning && SONConnected )
+    {
+        if( outgoingTelnetConnection && outgoingTelnetConnection.connected() )
+        {
+            sonNetToUart(outgoingTelnetConnection);
+        }
+
+        sonUartToNet();
+    }
+}
+//
+// ************************************************************************
+// parse and check the line settings as they come from the COM settings
+// form resp. the EEPROM. Returns false for an invalid combination, line
+// is left unchanged then.
+// ************************************************************************
+//
+bool comParseLineSettings(const String &baudRate, const String &dataBits,
+                          const String &parity, const String &stopBits,
+                          comLineSettings *line)
+{
+    bool retVal = false;
+    comLineSettings parsed;
+    long baud = baudRate.toInt();
+    char c;
+
+    if( baud >= SON_MIN_BAUDRATE && baud <= SON_MAX_BAUDRATE &&
+        dataBits.length() == 1 && parity.length() == 1 && stopBits.length() == 1 )
+    {
+        parsed.baud = (uint32_t) baud;
+        retVal = true;
+
+        switch( dataBits[0] )
+        {
+            case '6':
+                parsed.dataBits = COM_DATABITS_6;
+                break;
+            case '7':
+                parsed.dataBits = COM_DATABITS_7;
+                break;
+            case '8':
+                parsed.dataBits = COM_DATABITS_8;
+                break;
+            default:
+                retVal = false;
+                break;
+        }
+
+        c = parity[0];
+        if( c == COM_RADIO_PARITY_NO[0] || c == tolower(COM_RADIO_PARITY_NO[0]) )
+        {
+            parsed.parity = COM_PARITY_NONE;
+        }
+        else if( c == COM_RADIO_PARITY_EVEN[0] || c == tolower(COM_RADIO_PARITY_EVEN[0]) )
+        {
+            parsed.parity = COM_PARITY_EVEN;
+        }
+        else if( c == COM_RADIO_PARITY_ODD[0] || c == tolower(COM_RADIO_PARITY_ODD[0]) )
+        {
+            parsed.parity = COM_PARITY_ODD;
+        }
+        else
+        {
+            retVal = false;
+        }
+
+        if( stopBits[0] == COM_RADIO_STOPBIT_ONE[0] )
+        {
+            parsed.stopBits = COM_STOPBITS_1;
+        }
+        else if( stopBits[0] == COM_RADIO_STOPBIT_TWO[0] )
+        {
+            parsed.stopBits = COM_STOPBITS_2;
+        }
+        else
+        {
+            retVal = false;
+        }
+    }
+
+    if( retVal )
+    {
+        *line = parsed;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// check whether the software UART can handle the line settings. It
+// samples each bit after a delay counted in CPU cycles, the interrupt
+// latency shifts the sample point. Latency and rounding of the bit time
+// must stay below SON_SOFT_MAX_BIT_ERROR percent of a bit. The latency
+// is the one measured by /api/loopback, the estimate
+// SON_SOFT_ISR_LATENCY_CYCLES as long as none was measured. The software
+// UART knows 8N1 only.
+// ************************************************************************
+//
+bool comSoftSerialCapable(const comLineSettings *line)
+{
+    uint32_t cpuHz = ESP.getCpuFreqMHz() * 1000000UL;
+    uint32_t bitCycles = cpuHz / line->baud;
+    uint32_t roundCycles = (cpuHz % line->baud) * 10 / line->baud;   // over 10 bits
+    uint32_t latency = sonSoftLatencyCycles > 0 ? sonSoftLatencyCycles :
+                                                  SON_SOFT_ISR_LATENCY_CYCLES;
+
+    return( line->dataBits == COM_DATABITS_8 && line->parity == COM_PARITY_NONE &&
+            line->stopBits == COM_STOPBITS_1 &&
+            (latency + roundCycles) * 100 <= bitCycles * SON_SOFT_MAX_BIT_ERROR );
+}
+//
+// ************************************************************************
+// RTS/CTS can only be used if the software UART is not on their pins
+// ************************************************************************
+//
+bool comHandshakePinsFree(int rxPin, int txPin)
+{
+    return( rxPin != SON_RTS_PIN && rxPin != SON_CTS_PIN &&
+            txPin != SON_RTS_PIN && txPin != SON_CTS_PIN );
+}
+//
+// ************************************************************************
+// take the handshake of the COM settings form. RTS/CTS is refused, if
+// the software UART is on its pins, nothing is changed then.
+// ************************************************************************
+//
+bool comTakeHandshake(const String &value)
+{
+    bool retVal = true;
+
+    if( value.equalsIgnoreCase(COM_RADIO_LBL_HANDSHAKE_HW) && !useHardSerial &&
+        !comHandshakePinsFree(useRxPin.toInt(), useTxPin.toInt()) )
+    {
+        retVal = false;
+    }
+    else
+    {
+        useFlowCtrl = value.equalsIgnoreCase(COM_RADIO_LBL_HANDSHAKE_SW);
+        useHwFlowCtrl = value.equalsIgnoreCase(COM_RADIO_LBL_HANDSHAKE_HW);
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// take the size of the RX ring of the hardware UART of the COM settings
+// form, the API resp. the EEPROM. It is allocated by the next
+// sonApplyLineSettings(), at the latest by SetupSON() after a restart.
+// ************************************************************************
+//
+bool comTakeRxBufferSize(const String &value)
+{
+    bool retVal;
+    long size;
+
+    if( (retVal = comParseNumber(value, SON_RX_BUFSIZE_MIN, SON_RX_BUFSIZE_MAX, &size)) )
+    {
+        sonRxBufferSize = size;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// take the UDP sequence number setting of the COM settings form resp. the
+// API. Both sides have to use the same, the receiver starts counting
+// again with the next datagram if it changes.
+// ************************************************************************
+//
+bool comTakeUdpSequence(const String &value)
+{
+    bool retVal = true;
+
+    if( value.equalsIgnoreCase(COM_RADIO_UDP_SEQUENCE_ON) ||
+        value.equalsIgnoreCase(COM_RADIO_UDP_SEQUENCE_OFF) )
+    {
+        if( sonUdpSequence != value.equalsIgnoreCase(COM_RADIO_UDP_SEQUENCE_ON) )
+        {
+            sonUdpSequence = !sonUdpSequence;
+            sonUdpRxSynced = false;
+        }
+    }
+    else
+    {
+        retVal = false;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// parse a decimal number of a form field resp. the EEPROM. Returns false
+// if it is no number or not within minValue ... maxValue.
+// ************************************************************************
+//
+bool comParseNumber(const String &text, long minValue, long maxValue, long *value)
+{
+    bool retVal = text.length() > 0 && text.length() <= 6;
+    unsigned int i = text.length() > 1 && text[0] == '-' ? 1 : 0;
+    long parsed;
+
+    for( ; retVal && i < text.length(); i++ )
+    {
+        retVal = isdigit(text[i]);
+    }
+
+    if( retVal )
+    {
+        parsed = text.toInt();
+        retVal = parsed >= minValue && parsed <= maxValue;
+    }
+
+    if( retVal )
+    {
+        *value = parsed;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// take the packet settings of the COM settings form, the API resp. the
+// EEPROM. If one of them is invalid, nothing is changed.
+// ************************************************************************
+//
+bool comTakePacketSettings(const String &maxBytes, const String &timeout,
+                           const String &delimiter)
+{
+    bool retVal;
+    long newMaxBytes, newTimeout, newDelimiter;
+
+    retVal = comParseNumber(maxBytes, 1, SON_UART_BUFSIZE, &newMaxBytes) &&
+             comParseNumber(timeout, 0, SON_PACKET_TIMEOUT_MAX, &newTimeout) &&
+             comParseNumber(delimiter, -1, 255, &newDelimiter);
+
+    if( retVal )
+    {
+        sonPacketMaxBytes = newMaxBytes;
+        sonPacketTimeout = newTimeout;
+        sonPacketDelimiter = newDelimiter;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// a packet setting of the request, the current value if it has none
+// ************************************************************************
+//
+String comPacketArg(const char *name, long value)
+{
+    String retVal = String(value);
+
+    if( server.hasArg(name) )
+    {
+        retVal = server.arg(name);
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// UART frame formats indexed by [data bits - 6][parity][stop bits - 1]
+// ************************************************************************
+//
+static constexpr SerialConfig comSerialConfigTable[3][3][2] = {
+    { { SERIAL_6N1, SERIAL_6N2 }, { SERIAL_6E1, SERIAL_6E2 }, { SERIAL_6O1, SERIAL_6O2 } },
+    { { SERIAL_7N1, SERIAL_7N2 }, { SERIAL_7E1, SERIAL_7E2 }, { SERIAL_7O1, SERIAL_7O2 } },
+    { { SERIAL_8N1, SERIAL_8N2 }, { SERIAL_8E1, SERIAL_8E2 }, { SERIAL_8O1, SERIAL_8O2 } },
+};
+//
+// ************************************************************************
+// the UART frame format of the current line settings
+// ************************************************************************
+//
+SerialConfig sonSerialConfig()
+{
+    return( comSerialConfigTable[comLine.dataBits - COM_DATABITS_6]
+                                [comLine.parity]
+                                [comLine.stopBits - COM_STOPBITS_1] );
+}
+//
+// ************************************************************************
+// build the software UART on the pins, unless it is there already.
+// -1 as txPin makes it receive only.
+// ************************************************************************
+//
+void sonSoftSerialOn(int rxPin, int txPin)
+{
+    if( pSoftSerial == NULL || sonSoftRxPin != rxPin || sonSoftTxPin != txPin )
+    {
+        if( pSoftSerial != NULL )
         {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_8E1;
-            }
-            else
-            {
-                serialConfig = SERIAL_8E2;
-            }
+            pSoftSerial->~SoftwareSerial();
         }
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_ODD)) )
+        sonSoftRxPin = rxPin;
+        sonSoftTxPin = txPin;
+        pSoftSerial = new (sonSoftSerialMem) SoftwareSerial(sonSoftRxPin, sonSoftTxPin,
+                                                             false, SON_SOFT_RX_BUFSIZE);
+
+        if( !beQuiet )
         {
-            if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-            {
-                serialConfig = SERIAL_8O1;
-            }
-            else
-            {
-                serialConfig = SERIAL_8O2;
-            }
+            Logger.Log(LOGLEVEL_DEBUG, "software UART on GPIO %d/%d, free heap %u\n",
+                       rxPin, txPin, ESP.getFreeHeap());
         }
     }
+}
+//
+// ************************************************************************
+// (re)configure the UART with the current COM settings. The stream to
+// the network is kept, so this may be called while SON is running.
+// ************************************************************************
+//
+void sonApplyLineSettings()
+{
+    unsigned long lBaudRate = comLine.baud;
 
     if( !useHardSerial )
     {
-        lBaudRate = (unsigned long) useBaudRate.toInt();
-      
-        pSoftSerial = new SoftwareSerial( useRxPin.toInt(), useTxPin.toInt() );
+        sonSoftSerialOn(useRxPin.toInt(), useTxPin.toInt());
         pSoftSerial->begin(lBaudRate);
+        sonUart = pSoftSerial;
+    }
+    else
+    {
+        sonUart = &Serial;
+
+        // the ring is allocated by begin()
+        Serial.setRxBufferSize(sonRxBufferSize);
+        Serial.begin(lBaudRate, sonSerialConfig());
+    }
+
+    sonApplyHandshake();
+}
+//
+// ************************************************************************
+// setup SON (Serial Over Network)
+// ************************************************************************
+//
+void SetupSON()
+{
+    if( !comParseLineSettings(useBaudRate, useDataBits, useParity, useStopBits, &comLine) )
+    {
+        Logger.Log(LOGLEVEL_ERROR, "invalid COM settings %s %s%s%s, using factory defaults\n",
+                   useBaudRate.c_str(), useDataBits.c_str(),
+                   useParity.c_str(), useStopBits.c_str());
+
+        comParseLineSettings(FACTORY_USE_BAUDRATE, FACTORY_USE_DATABITS,
+                             FACTORY_USE_PARITY, FACTORY_USE_STOPBITS, &comLine);
+    }
+
+    if( !useHardSerial && !comSoftSerialCapable(&comLine) )
+    {
+        Logger.Log(LOGLEVEL_ERROR, "software UART can't do %lu %u%c%u, using hardware UART until restart\n",
+                   (unsigned long) comLine.baud, comLine.dataBits,
+                   "NEO"[comLine.parity], comLine.stopBits);
+        useHardSerial = true;
+        sonSoftFallback = true;
+    }
+
+    if( !beQuiet && useHardSerial )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "SetupSON -> UART RX ring %u bytes\n", sonRxBufferSize);
+    }
+
+    // allocates the RX ring, too
+    sonApplyLineSettings();
+
+    if( !COMProtocolTCP )
+    {
+        // the socket is opened by StartSON(), StopSON() closes it
+        sonUdpLost = 0;
+    }
+    else if( COMServerMode )
+    {
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG,"SetupSON -> start server");
+        }      
+//        pTelnetServer = new WiFiServer(SON_SERVER_PORT);
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "SetupSON -> server started\n");
+        }      
+        TelnetServer.setNoDelay(true);
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG,"SetupSON -> nodelay set\n");
+        }              
+        TelnetServer.begin();
+    }
+    else
+    {
+//        IPAddress targetServer = IPAddress.fromString(useTargetIP);
+          if( !beQuiet )
+          {
+              Logger.Log(LOGLEVEL_DEBUG,"try to connect to server\n");
+          }
+
+        IPAddress targetServer;
+        targetServer.fromString(useTargetIP);
+        if (outgoingTelnetConnection.connect(targetServer, SON_SERVER_PORT)) 
+        {
+            if( !beQuiet )
+            {
+                Logger.Log(LOGLEVEL_DEBUG,"connected\n");
+            }
+            // packets are built by processSON(), no need for Nagle
+            outgoingTelnetConnection.setNoDelay(true);
+            sonStats.connects++;
+            SONConnected = true;
+        }
+        else
+        {
+            sonStats.connectFails++;
+        }
+    }
+}
+//
+// ************************************************************************
+// start SON (Serial Over Network) 
+// ************************************************************************
+//
+void StartSON()
+{
+SONRunning = true;
+
+    if( !COMProtocolTCP )
+    {
+        sonUdp.begin(SON_SERVER_PORT);
+        sonUdpPending = 0;
+        sonUdpTxSeq = 0;
+        sonUdpRxSynced = false;
+
+        if( COMServerMode )
+        {
+            // peer is learned from the first datagram
+            SONConnected = false;
+        }
+        else
+        {
+            sonUdpPeerIP.fromString(useTargetIP);
+            sonUdpPeerPort = SON_SERVER_PORT;
+            SONConnected = true;
+        }
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "StartSON -> UDP on port %d\n", SON_SERVER_PORT);
+        }
+    }
+
+    // the UART belongs to the serial device from now on
+    if( useHardSerial )
+    {
+        Logger.StreamSink()->SetLevel(LOGLEVEL_QUIET);
+    }
+}
+//
+// ************************************************************************
+// stop SON (Serial Over Network) 
+// ************************************************************************
+//
+void StopSON()
+{
+SONRunning = false;
+SONConnected = false;
+
+    if( !COMProtocolTCP )
+    {
+        sonUdp.stop();
+        sonUdpPending = 0;
+    }
+    else if( COMServerMode )
+    {
+        sonDropAllClients();
+    }
+
+    sonSetFlowStopped(false);
+    sonUartTxPaused = false;
+
+    Logger.StreamSink()->SetLevel(LOGLEVEL_ALL_BITS);
+    sonLogStats();
+}
+//
+// ************************************************************************
+// hash of the SSID the WLAN cache was made for
+// ************************************************************************
+//
+uint32_t wlanSSIDHash()
+{
+    uint32_t retVal = 2166136261UL;    // FNV-1a
+
+    for( unsigned int i = 0; i < wlanSSID.length(); i++ )
+    {
+        retVal = (retVal ^ (uint8_t) wlanSSID[i]) * 16777619UL;
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// read the WLAN cache, returns true if it can be used for the SSID
+// ************************************************************************
+//
+bool nodeRestoreWlanCache()
+{
+    eeprom.restoreRaw( (char*) &wlanCache, EEPROM_POS_WLAN_CACHE, sizeof(wlanCache), sizeof(wlanCache) );
+
+    return( wlanCache.ssidHash == wlanSSIDHash() &&
+            wlanCache.channel >= 1 && wlanCache.channel <= 14 &&
+            wlanCache.ip != 0 );
+}
+//
+// ************************************************************************
+// store the current connection as WLAN cache. The EEPROM is only
+// written if something has changed.
+// ************************************************************************
+//
+void nodeStoreWlanCache()
+{
+    wlanCacheData current;
+    unsigned long crcCalc;
+
+    memset(&current, 0, sizeof(current));
+    current.ssidHash = wlanSSIDHash();
+    memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+    current.channel = WiFi.channel();
+    current.ip = (uint32_t) WiFi.localIP();
+    current.gateway = (uint32_t) WiFi.gatewayIP();
+    current.subnet = (uint32_t) WiFi.subnetMask();
+    current.dns = (uint32_t) WiFi.dnsIP();
+
+    if( memcmp(&current, &wlanCache, sizeof(current)) != 0 )
+    {
+        wlanCache = current;
+        eeprom.storeRaw( (char*) &wlanCache, sizeof(wlanCache), EEPROM_POS_WLAN_CACHE );
+        crcCalc = eeprom.crc( EEPROM_DATA_BEGIN, EEPROM_BLOCK_SIZE );
+        eeprom.storeRaw( (char*) &crcCalc, EEPROM_MAXLEN_CRC32, EEPROM_POS_CRC32 );
+        eeprom.validate();
+
+        if( !beQuiet )
+        {
+            Logger.Log(LOGLEVEL_DEBUG, "WLAN cache stored: channel %d\n", wlanCache.channel);
+        }
+    }
+}
+//
+// ************************************************************************
+// read the lease record, returns true if the cached IP configuration is
+// a lease that has not expired yet
+// ************************************************************************
+//
+bool wlanRestoreLease()
+{
+    ESP.rtcUserMemoryRead(WLAN_LEASE_RTC_OFFSET, (uint32_t*) &wlanLease, sizeof(wlanLease));
+
+    return( wlanLease.magic == WLAN_LEASE_MAGIC && wlanLease.ip == wlanCache.ip &&
+            wlanLease.ageSecs < wlanLease.leaseSecs );
+}
+//
+// ************************************************************************
+// take length and age of the lease of the DHCP client. A static IP has
+// no lease, the record is invalidated then.
+// ************************************************************************
+//
+void wlanStoreLease()
+{
+    struct dhcp *dhcp = netif_default != NULL ? netif_dhcp_data(netif_default) : NULL;
+
+    if( dhcp != NULL && dhcp->offered_t0_lease > 0 && (uint32_t) WiFi.localIP() != 0 )
+    {
+        wlanLease.magic = WLAN_LEASE_MAGIC;
+        wlanLease.ip = (uint32_t) WiFi.localIP();
+        wlanLease.leaseSecs = dhcp->offered_t0_lease;
+        wlanLease.ageSecs = (uint32_t) dhcp->lease_used * DHCP_COARSE_TIMER_SECS;
     }
     else
     {
-        lBaudRate = (unsigned long) useBaudRate.toInt();
-//        Serial.begin(lBaudRate, serialConfig);
+        wlanLease.magic = 0;
+    }
+
+    ESP.rtcUserMemoryWrite(WLAN_LEASE_RTC_OFFSET, (uint32_t*) &wlanLease, sizeof(wlanLease));
+}
+//
+// ************************************************************************
+// wait up to msecs for the connection
+// ************************************************************************
+//
+bool wlanWaitConnected(unsigned long msecs)
+{
+    unsigned long start = millis();
+
+    while( WiFi.status() != WL_CONNECTED && millis() - start < msecs )
+    {
+        delay(WLAN_CONNECT_POLL_MSECS);
+    }
+
+    return( WiFi.status() == WL_CONNECTED );
+}
+//
+// ************************************************************************
+// the static IP configuration: the address from the admin page, the
+// rest from the cache resp. derived from the address
+// ************************************************************************
+//
+bool wlanStaticConfig(bool cacheValid)
+{
+    IPAddress ip, gateway, subnet(255, 255, 255, 0), dns;
+    bool retVal = false;
+
+    if( ip.fromString(wwwServerIP) && (uint32_t) ip != 0 )
+    {
+        if( cacheValid && wlanCache.gateway != 0 )
+        {
+            gateway = wlanCache.gateway;
+            subnet = wlanCache.subnet;
+            dns = wlanCache.dns;
+        }
+        else
+        {
+            gateway = IPAddress(ip[0], ip[1], ip[2], 1);
+            dns = gateway;
+        }
+
+        retVal = WiFi.config(ip, gateway, subnet, dns);
+    }
+
+    return( retVal );
+}
+//
+// ************************************************************************
+// connect to the WLAN
+// - fast path: the cached access point and channel, no scan. The IP
+//   configuration is the static one resp. the cached lease, DHCP if it
+//   has expired.
+// - if that fails: a full scan and DHCP (unless a static IP is set),
+//   repeated until the connection is established
+// ************************************************************************
+//
+void wlanConnect()
+{
+    bool cacheValid = nodeRestoreWlanCache();
+    bool leaseValid = cacheValid && wlanRestoreLease();
+    bool staticIP = false;
+
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+
+    if( !useDhcp )
+    {
+        staticIP = wlanStaticConfig(cacheValid);
     }
 
-    if( COMServerMode )
+    bootFastConnect = false;
+
+    if( cacheValid )
     {
-        if( !beQuiet )
+        if( !staticIP && leaseValid )
         {
-            Logger.Log(LOGLEVEL_DEBUG,"SetupSON -> start server");
-        }      
-//        pTelnetServer = new WiFiServer(SON_SERVER_PORT);
+            WiFi.config(IPAddress(wlanCache.ip), IPAddress(wlanCache.gateway),
+                        IPAddress(wlanCache.subnet), IPAddress(wlanCache.dns));
+        }
+
+        WiFi.begin(wlanSSID.c_str(), wlanPasswd.c_str(), wlanCache.channel, wlanCache.bssid);
+        bootFastConnect = wlanWaitConnected(WLAN_FAST_CONNECT_MSECS);
+
         if( !beQuiet )
         {
-            Logger.Log(LOGLEVEL_DEBUG, "SetupSON -> server started\n");
-        }      
-        TelnetServer.setNoDelay(true);
-        if( !beQuiet )
+            Logger.Log(LOGLEVEL_DEBUG, "fast connect on channel %d %s\n", wlanCache.channel,
+                       bootFastConnect ? "succeeded" : "FAILED");
+        }
+
+        if( !bootFastConnect )
         {
-            Logger.Log(LOGLEVEL_DEBUG,"SetupSON -> nodelay set\n");
-        }              
-        TelnetServer.begin();
+            WiFi.disconnect();
+
+            if( !staticIP && leaseValid )
+            {
+                // back to DHCP
+                WiFi.config(0U, 0U, 0U);
+            }
+        }
     }
-    else
+
+    if( !bootFastConnect )
     {
-//        IPAddress targetServer = IPAddress.fromString(useTargetIP);
-          if( !beQuiet )
-          {
-              Logger.Log(LOGLEVEL_DEBUG,"try to connect to server\n");
-          }
+        WiFi.begin(wlanSSID.c_str(), wlanPasswd.c_str());
 
-        IPAddress targetServer;
-        targetServer.fromString(useTargetIP);
-        if (outgoingTelnetConnection.connect(targetServer, SON_SERVER_PORT)) 
+        while( !wlanWaitConnected(MAX_MSECS_FOR_AUTOCONNECT) )
         {
             if( !beQuiet )
             {
-                Logger.Log(LOGLEVEL_DEBUG,"connected\n");
+                Logger.Log(LOGLEVEL_DEBUG, "connect FAILED, try again\n");
             }
-            SONConnected = true;
+
+            WiFi.disconnect();
+            WiFi.begin(wlanSSID.c_str(), wlanPasswd.c_str());
         }
     }
-}
-//
-// ************************************************************************
-// start SON (Serial Over Network) 
-// ************************************************************************
-//
-void StartSON()
-{
-SONRunning = true;
-}
-//
-// ************************************************************************
-// stop SON (Serial Over Network) 
-// ************************************************************************
-//
-void StopSON()
-{
-SONRunning = false;
-SONConnected = false;
+
+    bootWlanMillis = millis();
+    wlanOnCachedLease = bootFastConnect && !staticIP && leaseValid;
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "WiFi connected after %lu ms, %s\n", bootWlanMillis,
+                   wlanOnCachedLease ? "cached lease" : staticIP ? "static IP" : "DHCP");
+    }
+
+    if( !wlanOnCachedLease )
+    {
+        wlanStoreLease();
+    }
+
+    nodeStoreWlanCache();
 }
 //
 // ************************************************************************
@@ -1437,21 +4057,17 @@ SONConnected = false;
 //
 void LEDOff(void);
 
-#define MAX_MSECS_FOR_AUTOCONNECT   10000 // 10 sec
-
 void setup() 
 {
-    static long mSecsTriedConnect;
-
     LEDOff();
 
-    adminAccessSucceeded = false;
     beQuiet = BE_QUIET;
     IPAddress localIP;
 
     // startup serial console ...
     Serial.begin(SERIAL_BAUD);
     Logger.Init(LOGLEVEL_DEBUG, &Serial);
+    Logger.AddSink(&logRing);
 
 //  if( eeprom.init( 1024, 0x00, LOGLEVEL_QUIET ) < EE_STATUS_INVALID_CRC )  
     if( eeprom.init( 1024, eeprom.version2Magic(), LOGLEVEL_QUIET ) < EE_STATUS_INVALID_CRC )  
@@ -1508,82 +4124,52 @@ void setup()
     {
         if( !beQuiet )
         {
-            Logger.Log(LOGLEVEL_DEBUG, "Connecting to >%s< password from eeprom is >%s<\n", 
-                wlanSSID.c_str(), wlanPasswd.c_str());
-        }
-
-        mSecsTriedConnect = millis();
-        // loop until connection is established
-        if( !beQuiet )
-        {
-            Logger.Log(LOGLEVEL_DEBUG,"First try auto connect\n");
-        }
-
-        while (WiFi.status() != WL_CONNECTED && (millis() - mSecsTriedConnect) < MAX_MSECS_FOR_AUTOCONNECT) 
-        {
-            if( !beQuiet )
-            {
-                Logger.Log(LOGLEVEL_DEBUG, ".");
-            }
-            delay(500);
-        }
-
-        if( WiFi.status() != WL_CONNECTED) 
-        {
-
-            if( !beQuiet )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"auto connect FAILED\n");
-
-            }
-            // Connect to WiFi network
-            WiFi.begin( wlanSSID.c_str(), wlanPasswd.c_str());
-   
-            // loop until connection is established
-            while (WiFi.status() != WL_CONNECTED) 
-            {
-                delay(500);
-                if( !beQuiet )
-                {
-                    Logger.Log(LOGLEVEL_DEBUG, ".");
-                }
-            }
-            if( !beQuiet )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"WiFi connected\n");
-            }
-
-        }
-        else
-        {
-            if( !beQuiet )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"AUTO CONNECTED\n");
-            }
+            Logger.Log(LOGLEVEL_DEBUG, "Connecting to >%s<\n", wlanSSID.c_str());
         }
 
+        wlanConnect();
     }
 
     server = ESP8266WebServer( wwwServerPort.toInt() );
 
+    pageContent.begin(&server);
+    webPage.begin(&server, &pageContent, webPageValue);
+    server.collectHeaders(webHeaders, sizeof(webHeaders) / sizeof(webHeaders[0]));
     server.on("/", handleIndexPage);
     server.on("/admin", handleAdminPage);
     server.on("/login", handleLoginPage);
     server.on("/comsettings", handleComSettings);
+    server.on("/log", handleLogPage);
+    server.on("/api/status", handleApiStatus);
+    server.on("/api/com", handleApiCom);
+    server.on("/api/stats", handleApiStats);
+    server.on("/api/loopback", handleApiLoopback);
 
     server.begin();
 
     localIP = WiFi.localIP();
     wwwServerIP = localIP.toString();
 
+    if( strlen(LOG_SYSLOG_SERVER) > 0 )
+    {
+        IPAddress syslogServer;
+
+        if( syslogServer.fromString(LOG_SYSLOG_SERVER) )
+        {
+            strncpy(syslogHostname, nodeName.c_str(), sizeof(syslogHostname) - 1);
+            logSyslog.Begin(&syslogUdp, syslogServer, LOG_SYSLOG_PORT, syslogHostname, LOG_SYSLOG_TAG);
+            Logger.AddSink(&logSyslog);
+        }
+    }
+
     if( !beQuiet )
     {
         Logger.Log(LOGLEVEL_DEBUG, "Webserver started. URL is: http://%s:%s\n", wwwServerIP.c_str(), wwwServerPort.c_str());
     }
  
-    pageContent = "";
+    pageContent = F("");
     dumpInfo();   
-    pageContent = "";
+    pageContent = F("");
 
     SONRunning = false;
     SONConnected = false;
@@ -1593,9 +4179,8 @@ void setup()
         if( !beQuiet )
         {
             Logger.Log(LOGLEVEL_DEBUG, "setup -> SON active -> setup and start SON\n");
-            Logger.Log(LOGLEVEL_DEBUG, "setup -> switch off logging!\n");
+            Logger.Log(LOGLEVEL_DEBUG, "setup -> switch off logging to UART!\n");
         }
-        Logger.SetLevel (LOGLEVEL_QUIET );
 
         SetupSON();
         StartSON();
@@ -1605,25 +4190,371 @@ void setup()
 //        Logger.Log(LOGLEVEL_DEBUG, "setup -> SON is off but switch off logging!\n");
 //        Logger.SetLevel (LOGLEVEL_QUIET );
     }
+
+    startTasks();
+
+    bootReadyMillis = millis();
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "ready after %lu ms (WLAN %lu ms, %s connect)\n",
+                   bootReadyMillis, bootWlanMillis, bootFastConnect ? "fast" : "full");
+    }
 }
 //
 // ************************************************************************
 // page preparation and handling 
 // ************************************************************************
 //
+// ---- finish the page in pageContent ----
+//
+void sendPage(int code, const char *contentType)
+{
+    pageContent.send(code, contentType);
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "%s: %u bytes, first byte after %lu ms, %u bytes heap used\n",
+                   server.uri().c_str(), pageContent.length(),
+                   pageContent.firstByteMillis(), pageContent.heapUsed());
+    }
+}
+//
+// ---- send a page template ----
+//
+void sendTemplate(const pageTemplateAsset *asset)
+{
+    int code = webPage.send(asset, WEB_CACHE_CONTROL);
+    webPageTiming *stats = NULL;
+
+    for( int i = 0; i < WEB_PAGE_STATS && stats == NULL; i++ )
+    {
+        if( webPageStats[i].asset == asset || webPageStats[i].asset == NULL )
+        {
+            stats = &webPageStats[i];
+            stats->asset = asset;
+        }
+    }
+
+    if( stats != NULL )
+    {
+        stats->count++;
+        stats->firstByteMillis = webPage.firstByteMillis();
+        stats->heapUsed = webPage.heapUsed();
+
+        if( stats->firstByteMillis > stats->maxFirstByteMillis )
+        {
+            stats->maxFirstByteMillis = stats->firstByteMillis;
+        }
+
+        if( stats->heapUsed > stats->maxHeapUsed )
+        {
+            stats->maxHeapUsed = stats->heapUsed;
+        }
+    }
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "%s: %s %d, %u bytes gzip for %lu bytes, "
+                   "first byte after %lu ms, %u bytes heap used\n",
+                   server.uri().c_str(), asset->name, code,
+                   webPage.length(), (unsigned long) webPage.rawLength(),
+                   webPage.firstByteMillis(), webPage.heapUsed());
+    }
+}
+//
+// ---- answer with a redirect, the browser fetches the page itself ----
+//
+void sendRedirect(const char *location)
+{
+    server.sendHeader("Location", location);
+    server.send(303, "text/plain", "");
+}
+//
+// ---- start a session for a successful login, the cookie is sent with
+//      the next response ----
+//
+void webSessionStart()
+{
+    char cookie[sizeof(WEB_SESSION_COOKIE) + WEB_SESSION_TOKEN_LEN + 48];
+    unsigned long now = millis();
+    int slot = 0;
+
+    for( int i = 0; i < WEB_SESSIONS; i++ )
+    {
+        if( !webSessions[i].used || now - webSessions[i].lastUse >= WEB_SESSION_TIMEOUT )
+        {
+            slot = i;
+            break;
+        }
+
+        if( now - webSessions[i].lastUse > now - webSessions[slot].lastUse )
+        {
+            slot = i;
+        }
+    }
+
+    // hardware random number generator
+    snprintf(webSessions[slot].token, sizeof(webSessions[slot].token), "%x%08lx%08lx",
+             slot, (unsigned long) RANDOM_REG32, (unsigned long) RANDOM_REG32);
+    webSessions[slot].used = true;
+    webSessions[slot].lastUse = now;
+
+    snprintf(cookie, sizeof(cookie), "%s=%s; Path=/; HttpOnly; SameSite=Strict",
+             WEB_SESSION_COOKIE, webSessions[slot].token);
+    server.sendHeader("Set-Cookie", cookie);
+
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG, "session %d started\n", slot);
+    }
+}
+//
+// ---- index of the session of the request, -1 if there is none. A
+//      valid session is kept alive. ----
+//
+int webSessionFind()
+{
+    String cookies = server.header("Cookie");
+    const char *token;
+    int pos, slot;
+    int retVal = -1;
+
+    if( (pos = cookies.indexOf(WEB_SESSION_COOKIE "=")) >= 0 )
+    {
+        token = cookies.c_str() + pos + sizeof(WEB_SESSION_COOKIE);
+        slot = token[0] >= '0' && token[0] <= '9' ? token[0] - '0' : -1;
+
+        if( slot >= 0 && slot < WEB_SESSIONS && webSessions[slot].used &&
+            strncmp(token, webSessions[slot].token, WEB_SESSION_TOKEN_LEN) == 0 &&
+            (token[WEB_SESSION_TOKEN_LEN] == '\0' || token[WEB_SESSION_TOKEN_LEN] == ';') )
+        {
+            if( millis() - webSessions[slot].lastUse < WEB_SESSION_TIMEOUT )
+            {
+                webSessions[slot].lastUse = millis();
+                retVal = slot;
+            }
+            else
+            {
+                webSessions[slot].used = false;
+            }
+        }
+    }
+
+    return( retVal );
+}
+//
+// ---- true if the request belongs to a logged in admin ----
+//
+bool adminAccess()
+{
+    return( webSessionFind() >= 0 );
+}
+//
+// ---- end the session of the request ----
+//
+void webSessionEnd()
+{
+    int slot;
+
+    if( (slot = webSessionFind()) >= 0 )
+    {
+        webSessions[slot].used = false;
+        server.sendHeader("Set-Cookie", WEB_SESSION_COOKIE "=; Path=/; Max-Age=0");
+    }
+}
+//
+// ---- end all sessions, e.g. if the admin password has changed ----
+//
+void webSessionsClear()
+{
+    for( int i = 0; i < WEB_SESSIONS; i++ )
+    {
+        webSessions[i].used = false;
+    }
+}
+//
+// ---- log the arguments of a request, passwords are not shown ----
+//
+void logServerArgs()
+{
+    for(int i = 0; i < server.args(); i++ )
+    {
+        if( server.argName(i).equals(ADMIN_FIELDNAME_PASSPHRASE) ||
+            server.argName(i).equals(ADMIN_FIELDNAME_ADMINPW) ||
+            server.argName(i).equals(LOGIN_FIELDNAME_PASSWORD) )
+        {
+            Logger.Log(LOGLEVEL_DEBUG,"%s = ***\n", server.argName(i).c_str() );
+        }
+        else
+        {
+            Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
+        }
+    }
+}
+//
+// ---- write text to a page, quoted for HTML ----
+//
+void webPageText(const String &text)
+{
+    for( unsigned int i = 0; i < text.length(); i++ )
+    {
+        switch( text[i] )
+        {
+            case '&':
+                pageContent += F("&amp;");
+                break;
+            case '<':
+                pageContent += F("&lt;");
+                break;
+            case '>':
+                pageContent += F("&gt;");
+                break;
+            case '"':
+                pageContent += F("&quot;");
+                break;
+            default:
+                pageContent += text[i];
+                break;
+        }
+    }
+}
+//
+// ---- state of a radio button ----
+//
+void webPageChecked(bool checked)
+{
+    if( checked )
+    {
+        pageContent += F("checked");
+    }
+    else
+    {
+        pageContent += F("unchecked");
+    }
+}
+//
+// ---- write the values of the page templates ----
+// arg is the value of the radio button resp. option the state is
+// asked for. The values have to be the same each time they are asked
+// for while a page is sent.
+//
+void webPageValue(uint8_t value, const char *arg)
+{
+    if( arg == NULL )
+    {
+        arg = "";
+    }
+
+    switch( value )
+    {
+        case WEB_VALUE_NODE_INFO:
+            dumpInfo();
+            break;
+        case WEB_VALUE_WLAN_SSID:
+            webPageText(wlanSSID);
+            break;
+        case WEB_VALUE_WLAN_PASSPHRASE:
+            webPageText(wlanPasswd);
+            break;
+        case WEB_VALUE_CHECKED_DHCP:
+            webPageChecked(useDhcp);
+            break;
+        case WEB_VALUE_SERVER_IP:
+            webPageText(wwwServerIP);
+            break;
+        case WEB_VALUE_SERVER_PORT:
+            webPageText(wwwServerPort);
+            break;
+        case WEB_VALUE_NODENAME:
+            webPageText(nodeName);
+            break;
+        case WEB_VALUE_ADMIN_PASSWD:
+            webPageText(adminPasswd);
+            break;
+        case WEB_VALUE_TARGET_IP:
+            webPageText(useTargetIP);
+            break;
+        case WEB_VALUE_RX_BUFSIZE:
+            webPageText(String(sonRxBufferSize));
+            break;
+        case WEB_VALUE_PACKET_MAXBYTES:
+            webPageText(String(sonPacketMaxBytes));
+            break;
+        case WEB_VALUE_PACKET_TIMEOUT:
+            webPageText(String(sonPacketTimeout));
+            break;
+        case WEB_VALUE_PACKET_DELIMITER:
+            webPageText(String(sonPacketDelimiter));
+            break;
+        case WEB_VALUE_CHECKED_SON:
+            webPageChecked(strcasecmp(arg, SerialOverNetwork ? COM_RADIO_SON_ENABLED :
+                                                               COM_RADIO_SON_DISABLED) == 0);
+            break;
+        case WEB_VALUE_CHECKED_PROTOCOL:
+            webPageChecked(arg[0] == (COMProtocolTCP ? COM_RADIO_PROTOCOL_TCP :
+                                                       COM_RADIO_PROTOCOL_UDP));
+            break;
+        case WEB_VALUE_CHECKED_UDP_SEQUENCE:
+            webPageChecked(strcasecmp(arg, sonUdpSequence ? COM_RADIO_UDP_SEQUENCE_ON :
+                                                            COM_RADIO_UDP_SEQUENCE_OFF) == 0);
+            break;
+        case WEB_VALUE_CHECKED_COM_TYPE:
+            webPageChecked(strcasecmp(arg, useHardSerial && !sonSoftFallback ?
+                                           COM_RADIO_COM_TYPE_HW : COM_RADIO_COM_TYPE_SW) == 0);
+            break;
+        case WEB_VALUE_CHECKED_OPERATIONMODE:
+            webPageChecked(strcasecmp(arg, COMServerMode ? COM_RADIO_OPERATIONMODE_SERVER :
+                                                           COM_RADIO_OPERATIONMODE_CLIENT) == 0);
+            break;
+        case WEB_VALUE_CHECKED_GPIO_RX:
+            webPageChecked(useRxPin.equalsIgnoreCase(arg));
+            break;
+        case WEB_VALUE_CHECKED_GPIO_TX:
+            webPageChecked(useTxPin.equalsIgnoreCase(arg));
+            break;
+        case WEB_VALUE_CHECKED_DATALEN:
+            webPageChecked(useDataBits.equalsIgnoreCase(arg));
+            break;
+        case WEB_VALUE_CHECKED_STOPBIT:
+            webPageChecked(useStopBits.equalsIgnoreCase(arg));
+            break;
+        case WEB_VALUE_CHECKED_PARITY:
+            webPageChecked(useParity.equalsIgnoreCase(arg));
+            break;
+        case WEB_VALUE_CHECKED_FLOWCTRL:
+            webPageChecked(strcasecmp(arg, useFlowCtrl ? COM_RADIO_LBL_HANDSHAKE_SW :
+                                           useHwFlowCtrl ? COM_RADIO_LBL_HANDSHAKE_HW :
+                                                           COM_RADIO_LBL_HANDSHAKE_NO) == 0);
+            break;
+        case WEB_VALUE_SELECTED_BAUD:
+            if( useBaudRate.equalsIgnoreCase(arg) )
+            {
+                pageContent += F("selected");
+            }
+            break;
+        default:
+            break;
+    }
+}
+//
 // ---- load and handle /login page ----
 //
 
 void handleLoginPage()
 {
 
-    if( adminAccessSucceeded )
+    if( adminAccess() )
     {
         if( !beQuiet )
         {
-            Logger.Log(LOGLEVEL_DEBUG,"handleLoginPage -> handleAdminPage\n");
+            Logger.Log(LOGLEVEL_DEBUG,"handleLoginPage -> /admin\n");
         }
-        handleAdminPage();
+        sendRedirect("/admin");
+    }
+    else if( server.method() == SERVER_METHOD_POST && server.hasArg(AUTHFAIL_BUTTONNAME_CANCEL) )
+    {
+        sendRedirect("/");
     }
     else
     {
@@ -1631,10 +4562,7 @@ void handleLoginPage()
         if( !beQuiet )
         {
             Logger.Log(LOGLEVEL_DEBUG,"handleLoginPage\n");
-            for(int i = 0; i < server.args(); i++ )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-            }
+            logServerArgs();
         }
 
         if( server.method() == SERVER_METHOD_POST && server.hasArg(LOGIN_FIELDNAME_PASSWORD) )
@@ -1646,16 +4574,13 @@ void handleLoginPage()
             // form contains user input and has been postet
             // to server
 
-            loginPasswd = server.arg(LOGIN_FIELDNAME_PASSWORD);
-
-            if( adminPasswd.equals(loginPasswd) )
+            if( adminPasswd.equals(server.arg(LOGIN_FIELDNAME_PASSWORD)) )
             {
-                adminAccessSucceeded = true;
-                handleAdminPage();
+                webSessionStart();
+                sendRedirect("/admin");
             }
             else
             {
-                adminAccessSucceeded = false;
                 sendAuthFailedPage();
             }
         }
@@ -1666,36 +4591,7 @@ void handleLoginPage()
                 Logger.Log(LOGLEVEL_DEBUG,"GET REQUEST\n");
             }
 
-            pageContent  = "<!DOCTYPE html>\r";
-            pageContent += "<html>\r";
-            pageContent += "<head>\r";
-            pageContent += "<meta charset=\"utf-8\" />\r";
-            pageContent += "<title>Administrator</title>\r";
-            pageContent += "</head>\r";
-            pageContent += "<body bgcolor=\"#D4C9C9\" text=\"#000000\" link=\"#1E90FF\" vlink=\"#0000FF\" alink=\"#20FF00\">\r";
-            pageContent += "<div align=\"center\"><strong><h1>Administrator account</h1></strong></div>\r";
-            pageContent += "<form action=\"/login\" method=\"post\">\r";
-            pageContent += "<table align=\"center\">\r";
-            pageContent += "<tr>\r";
-            pageContent += "  <td><div align=\"center\">Password:</div></td>\r";
-            pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"" +
-                                String(LOGIN_FIELDNAME_PASSWORD) + "\" value=\"" + loginPasswd + "\"> ";
-
-            pageContent += "</tr>\r";
-            pageContent += "</table>\r";
-            pageContent += "<hr align=\"center\"><br>\r";
-            pageContent += "<div align=\"center\">\r";
-            pageContent += "<input type=\"submit\" name=\"" +
-                           String(LOGIN_BUTTONNAME_COMMIT) + "\" value=\"" + String(LOGIN_ACTION_COMMIT) + "\"> ";
-
-            pageContent += "</div><br>\r";
-            pageContent += "<hr align=\"center\"><br>\r";
-            pageContent += "</form>\r";
-            pageContent += "</body>\r";
-            pageContent += "</html>\r";
-
-            server.send(200, "text/html", pageContent);  
-
+            sendTemplate(&webAssetLogin);
         }
     }
 }
@@ -1709,10 +4605,7 @@ void getAdminInputValues()
     {
         Logger.Log(LOGLEVEL_DEBUG,"getAdminInputValues\n");
 
-            for(int i = 0; i < server.args(); i++ )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-            }
+        logServerArgs();
     }
     // Store user values an do other funny things ...
 
@@ -1726,10 +4619,8 @@ void getAdminInputValues()
         wlanPasswd = server.arg(ADMIN_FIELDNAME_PASSPHRASE);
     }
 
-    if( server.hasArg(ADMIN_CHKNAME_USEDHCPD) )
-    {
-        useDhcp = server.arg(ADMIN_CHKNAME_USEDHCPD);
-    }
+    // an unchecked checkbox is not sent at all
+    useDhcp = server.hasArg(ADMIN_CHKNAME_USEDHCPD);
 
     if( server.hasArg(ADMIN_FIELDNAME_SERVER_IP) )
     {
@@ -1749,15 +4640,15 @@ void getAdminInputValues()
     if( server.hasArg(ADMIN_FIELDNAME_ADMINPW) )
     {
 
-        adminPasswd = server.arg(ADMIN_FIELDNAME_ADMINPW);
-        if( !adminPasswd.equals(loginPasswd) )
+        if( !adminPasswd.equals(server.arg(ADMIN_FIELDNAME_ADMINPW)) )
         {
             if( !beQuiet )
             {
-                Logger.Log(LOGLEVEL_DEBUG,"Admin password changed ... reset autologin flag\n");
+                Logger.Log(LOGLEVEL_DEBUG,"Admin password changed ... end all sessions\n");
             }
-            adminAccessSucceeded = false;
+            webSessionsClear();
         }
+        adminPasswd = server.arg(ADMIN_FIELDNAME_ADMINPW);
     }
 
     // All user values retrieved ...
@@ -1777,15 +4668,13 @@ void handleAdminPage()
    if( !beQuiet )
    {
        Logger.Log(LOGLEVEL_DEBUG,"handleAdminPage\n");
-       for(int i = 0; i < server.args(); i++ )
-       {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-       }
+       logServerArgs();
    }
 
-   if( !adminAccessSucceeded )
+   if( !adminAccess() )
    {
-       handleLoginPage();
+       sendRedirect("/login");
+       return;
    }
 
    if( server.method() == SERVER_METHOD_POST &&
@@ -1829,10 +4718,16 @@ void handleAdminPage()
              btnValue = server.arg(ADMIN_BUTTONNAME_COMSETTINGS);
              if( btnValue.equals(ADMIN_ACTION_COMSETTINGS) )
              {
-                 handleComSettings();
+                 sendRedirect("/comsettings");
+                 return;
              }
          }
 
+         if( server.hasArg(ADMIN_BUTTONNAME_CLOSE) )
+         {
+             webSessionEnd();
+         }
+
          if( server.hasArg(ADMIN_BUTTONNAME_RESTART) )
          {
              btnValue = server.arg(ADMIN_BUTTONNAME_RESTART);
@@ -1844,179 +4739,11 @@ void handleAdminPage()
              }
          }
 
-        handleIndexPage();
+        sendRedirect("/");
     }
     else
     {
-        pageContent  = "<!DOCTYPE html>\n";
-        pageContent += "<html>\n";
-        pageContent += "<head>\n";
-        pageContent += "<meta charset=\"utf-8\" />\n";
-        pageContent += "<title>ESP8266 Settings</title>\n";
-        pageContent += "</head>\n";
-        pageContent += "<body bgcolor=\"#D4C9C9\" text=\"#000000\" link=\"#1E90FF\" vlink=\"#0000FF\" alink=\"#20FF00\">\n";
-        pageContent += "<div align=\"center\"><strong><h1>Change settings for this node</h1></strong></div>\n";
-        pageContent += "<form action=\"/admin\" method=\"post\">\n";
-        pageContent += "<table align=\"center\">\n";
-        pageContent += "<tr>\n";
-        pageContent += "<td> <div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_SSID) + "\"\n";
-        pageContent += "</td>\n";
-
-        pageContent += "<td><div align=\"center\"><input type=\"text\" name=\"" +
-                       String(ADMIN_FIELDNAME_SSID) + "\" value=\"" +
-                       wlanSSID + "\" maxlength="+ String(EEPROM_MAXLEN_WLAN_SSID) + " ></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-
-        pageContent += "<td><div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_PASSPHRASE) + "\"\n";
-        pageContent += "</td>\n";
-
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"" +
-                       String(ADMIN_FIELDNAME_PASSPHRASE) + "\" value=\"" + 
-                       wlanPasswd + "\" maxlength="+ String(EEPROM_MAXLEN_WLAN_PASSPHRASE) + " ></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-
-        pageContent += "<td><div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_USE_DHCP) + "\"\n";
-        pageContent += "</td>\n";
-
-        pageContent += "  <td><div align=\"center\"><input type=\"checkbox\" name=\"" +
-                       String(ADMIN_CHKNAME_USEDHCPD) + "\" value=\"" + 
-                       useDhcp + "\"></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "</tr>\n";
-
-        pageContent += "<tr>\r";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_SERVER_IP) + "\" </td>\n";
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"";
-        pageContent += String(ADMIN_FIELDNAME_SERVER_IP) + "\" value=\"" + wwwServerIP + "\" maxlength=\"";
-        pageContent += String(EEPROM_MAXLEN_SERVER_IP) + "\"> ";
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\"></div></td>\n";
-        pageContent += "  </optgroup>\n";
-        pageContent += "</tr>\n";
-
-
-        pageContent += "<tr>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-
-        pageContent += "<td> <div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_SERVER_PORT) + "\"\n";
-        pageContent += "</td>\n";
-	
-
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"" +
-                       String(ADMIN_FIELDNAME_SRVPORT) + "\" value=\"" + 
-                       wwwServerPort + "\" size=\"4\" maxlength="+ String(EEPROM_MAXLEN_SERVER_PORT) + " ></div></td>\n";
-//                       wwwServerPort + "\" size=\"4\" maxlength=\"4\"></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "  <td><hr align=\"center\"></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-
-        pageContent += "<td> <div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_NODENAME) + "\"\n";
-        pageContent += "</td>\n";
-
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"" +
-                       String(ADMIN_FIELDNAME_NODENAME) + "\" value=\"" + 
-                       nodeName + "\" maxlength="+ String(EEPROM_MAXLEN_NODENAME) + " ></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-
-        pageContent += "<td> <div align=\"center\">\n";
-        pageContent += "<optgroup label=\"" + String(ADMIN_OPTGRP_LABEL_ADMIN_PASSWD) + "\"\n";
-        pageContent += "</td>\n";
-
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"" +
-                       String(ADMIN_FIELDNAME_ADMINPW) + "\" value=\"" + 
-                       adminPasswd +"\" maxlength="+ String(EEPROM_MAXLEN_ADMIN_PASSWORD) + " ></div></td>\n";
-
-        pageContent += "<td><div align=\"center\"></div></td>\n";
-        pageContent += "</optgroup>\n";
-
-        pageContent += "</tr>\n";
-
-        pageContent += "<tr>\n";
-        pageContent += "<td> <hr align=\"center\"></td>\n";
-        pageContent += "<td><hr align=\"center\"></td>\n";
-        pageContent += "<td><hr align=\"center\"></td>\n";
-        pageContent += "</tr>\n";
-
-        pageContent += "</table>\n";
-        pageContent += "<div align=\"center\">\n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_FORMRESET) + "\" value=\"" + 
-                       String(ADMIN_ACTION_RESET) + "\"> \n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_COMMIT) + "\" value=\"" + 
-                       String(ADMIN_ACTION_COMMIT) + "\"> \n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_FACTORY) + "\" value=\"" + 
-                       String(ADMIN_ACTION_FACTORY) + "\"> \n";
-
-        pageContent += "<br><br>\n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_CLOSE) + "\" value=\"" + 
-                       String(ADMIN_ACTION_CLOSE) + "\"> \n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_COMSETTINGS) + "\" value=\"" + 
-                       String(ADMIN_ACTION_COMSETTINGS) + "\"> \n";
-
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(ADMIN_BUTTONNAME_RESTART) + "\" value=\"" + 
-                       String(ADMIN_ACTION_RESTART) + "\"> \n";
-
-        pageContent += "</div><br>\n";
-        pageContent += "</form>\n";
-        pageContent += "</body>\n";
-        pageContent += "</html>\n";
-        server.send(200, "text/html", pageContent);  
+        sendTemplate(&webAssetAdmin);
     }
 
     return;
@@ -2043,10 +4770,7 @@ void handleIndexPage(void)
     if( !beQuiet )
     {
         Logger.Log(LOGLEVEL_DEBUG,"handleIndexPage");
-        for(int i = 0; i < server.args(); i++ )
-        {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-        }
+        logServerArgs();
     }
 
 
@@ -2059,32 +4783,22 @@ void handleIndexPage(void)
             // form contains user input and has been postet
             // to server
 
-            for(int i = 0; i < server.args(); i++ )
-            {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-            }
+            logServerArgs();
         }
 
         if( server.hasArg(INDEX_BUTTONNAME_ADMIN) )
         {
             indexAction = server.arg(INDEX_BUTTONNAME_ADMIN);
-            if( adminAccessSucceeded )
-            {
-                handleAdminPage();
-            }
-            else
-            {
-                handleLoginPage();
-            }
+            sendRedirect(adminAccess() ? "/admin" : "/login");
         }
         else
         {
             // unknown action
-            pageContent = "<!DOCTYPE HTML>\r\n";
-            pageContent += "<html></p>";
-            pageContent += "<br>empty strings not allowed!<br>";
-            pageContent += "</html>";
-            server.send(200, "text/html", pageContent);  
+            pageContent = F("<!DOCTYPE HTML>\r\n");
+            pageContent += F("<html></p>");
+            pageContent += F("<br>empty strings not allowed!<br>");
+            pageContent += F("</html>");
+            sendPage(200, "text/html");  
         }
     }
     else
@@ -2093,34 +4807,7 @@ void handleIndexPage(void)
         {
             Logger.Log(LOGLEVEL_DEBUG,"GET REQUEST\n");
         }
-        pageContent = "<!DOCTYPE html>";
-        pageContent += "<html>";
-        pageContent += "<head>";
-        pageContent += "<meta charset=\"utf-8\" />";
-        pageContent += "<title>Home</title>";
-        pageContent += "</head>";
-        pageContent += "<body bgcolor=\"#D4C9C9\" text=\"#000000\" link=\"#1E90FF\" vlink=\"#0000FF\" alink=\"#20FF00\">";
-        pageContent += "<div align=\"center\"><strong><h1>node home</h1></strong></div>";
-
-        pageContent += "<hr align=\"center\"><br>";
-        pageContent += "<div align=\"center\">";
-    dumpInfo();
-        pageContent += "</div><br>";
-
-        // display all information of current node that don't require admin access
-        pageContent += "<form action=\"/\" method=\"post\">";
-        pageContent += "<hr align=\"center\"><br>";
-        pageContent += "<div align=\"center\">";
-
-        pageContent += "<input type=\"submit\" name=\"" + String(INDEX_BUTTONNAME_ADMIN) + 
-                       "\" value=\"" + String(INDEX_ACTION_ADMIN_COMMIT) + "\"> ";
-
-        pageContent += "</div><br>";
-        pageContent += "<hr align=\"center\"><br>";
-        pageContent += "</form>";
-        pageContent += "</body>";
-        pageContent += "</html>";
-        server.send(200, "text/html", pageContent);  
+        sendTemplate(&webAssetIndex);
     }
 
     return;
@@ -2134,1247 +4821,970 @@ void sendAuthFailedPage()
     if( !beQuiet )
     {
         Logger.Log(LOGLEVEL_DEBUG,"sendAuthFailedPage\n");
-           for(int i = 0; i < server.args(); i++ )
-           {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-           }
+           logServerArgs();
     }
 
 
-    if( server.method() == SERVER_METHOD_POST &&
-        (server.hasArg(AUTHFAIL_BUTTONNAME_AGAIN) ||
-         server.hasArg(AUTHFAIL_BUTTONNAME_CANCEL) ) )
-    {
-        if( server.hasArg(AUTHFAIL_BUTTONNAME_AGAIN) )
-        {
-            handleLoginPage();
-        }
-
-        if( server.hasArg(AUTHFAIL_BUTTONNAME_CANCEL) )
-        {
-            handleIndexPage();
-        }
-    }
-    else
-    {
-        if( !beQuiet )
-        {
-            Logger.Log(LOGLEVEL_DEBUG,"POST REQUEST\n");
-        }
-        pageContent  = "<!DOCTYPE html>";
-        pageContent += "<html>";
-        pageContent += "<head>";
-        pageContent += "<meta charset=\"utf-8\" />";
-        pageContent += "<title>Administrator</title>";
-        pageContent += "</head>";
-        pageContent += "<body bgcolor=\"#D4C9C9\" text=\"#000000\" link=\"#1E90FF\" vlink=\"#0000FF\" alink=\"#20FF00\">";
-        pageContent += "<div align=\"center\"><strong><h1 style=\"color: #FF0000; \">Authorization failed!</h1></strong></div>";
-        pageContent += "<form action=\"/login\" method=\"post\">";
-        pageContent += "<table align=\"center\">";
-        pageContent += "</table>";
-        pageContent += "<hr align=\"center\"><br>";
-        pageContent += "<div align=\"center\">";
-        pageContent += "    <input type=\"submit\" name=\"" +
-                            String(AUTHFAIL_BUTTONNAME_AGAIN) + 
-                            "\" value=\"" + String(AUTHFAIL_ACTION_AGAIN) + "\"> ";
-// name = "again" value="try again"> ";
-        pageContent += "    <input type=\"submit\" name=\"" +
-                            String(AUTHFAIL_BUTTONNAME_CANCEL) + 
-                            "\" value=\"" + String(AUTHFAIL_ACTION_CANCEL) + "\"> ";
-// name = "cancel" value="cancel">";
-        pageContent += "</div><br>";
-        pageContent += "<hr align=\"center\"><br>";
-        pageContent += "</form>";
-        pageContent += "</body>";
-        pageContent += "</html>";
-        server.send(200, "text/html", pageContent);  
-    }
+    // its buttons post to /login
+    sendTemplate(&webAssetLoginFail);
 
     return;
 }
 
-// ******************************************** COMSETTINGS *********************************
 //
-// ---- get user input data from comsettings page ----
+// ---- send the content of the log ring as plain text ----
 //
-void getComInputValues()
-{
-    String btnValue = "";
-    String opMode = "";
-    bool nodeRestart = false;
-
-    if( !beQuiet )
-    {
-        Logger.Log(LOGLEVEL_DEBUG,"getComInputValues ...\n");
-    }
-
-    btnValue = server.arg(COM_RADIONAME_SON);
-
-    if( btnValue.equals(COM_RADIO_SON_ENABLED) )
-    {
-        SerialOverNetwork = true;
-    }
-    else
-    {
-        SerialOverNetwork = false;
-    }
-
-    if( server.hasArg(COM_RADIONAME_OPERATIONMODE) )
-    {
-        nodeRestart = false;
-    	opMode = server.arg(COM_RADIONAME_OPERATIONMODE);
-        if( opMode.equalsIgnoreCase( COM_RADIO_OPERATIONMODE_SERVER ) )
-        {
-            if( ! COMServerMode )
-            {
-                nodeRestart = true;
-            }
-        }
-        else
-        {
-            if( COMServerMode )
-            {
-                nodeRestart = true;
-            }
-        }
-
-        COMServerMode = opMode.equalsIgnoreCase( COM_RADIO_OPERATIONMODE_SERVER );
-
-        if( !beQuiet )
-        {
-            Logger.Log(LOGLEVEL_DEBUG, "COMServerMode is now set to %d\n", COMServerMode);
-        }
-
-    }
-
-    if( server.hasArg(COM_RADIONAME_PROTOCOL) )
-    {
-        COMProtocolTCP = server.arg(COM_RADIONAME_PROTOCOL);
-    }
-
-    if( server.hasArg(COM_RADIONAME_COM_TYPE) )
-    {
-        btnValue = server.arg(COM_RADIONAME_COM_TYPE);
-        if( btnValue.equalsIgnoreCase(COM_RADIO_COM_TYPE_HW) )
-        {
-            useHardSerial = true;
-        }
-        else
-        {
-            useHardSerial = false;
-        }
-    }
+#define LOG_PAGE_CHUNK    256
 
-    if( server.hasArg(COM_TARGET_IP) )
-    {
-        useTargetIP = server.arg(COM_TARGET_IP);
-    }
+void handleLogPage()
+{
+    char chunk[LOG_PAGE_CHUNK];
+    size_t offset, len;
 
-    if( server.hasArg(COM_RADIONAME_GPIO_RX) )
+    // the log may contain passwords
+    if( !adminAccess() )
     {
-        useRxPin = server.arg(COM_RADIONAME_GPIO_RX);
+        sendRedirect("/login");
+        return;
     }
 
-    if( server.hasArg(COM_RADIONAME_GPIO_TX) )
-    {
-        useTxPin = server.arg(COM_RADIONAME_GPIO_TX);
-    }
+    server.setContentLength(logRing.Length());
+    server.send(200, "text/plain", "");
 
-    if( server.hasArg(COM_RADIONAME_DATALEN) )
+    for( offset = 0; (len = logRing.Read(offset, chunk, sizeof(chunk))) > 0; offset += len )
     {
-        useDataBits = server.arg(COM_RADIONAME_DATALEN);
-
+        server.client().write((const uint8_t *) chunk, len);
     }
+}
 
-    if( server.hasArg(COM_RADIONAME_STOPBIT) )
-    {
-        useStopBits = server.arg(COM_RADIONAME_STOPBIT);
-    }
+// ******************************************** JSON API ************************************
+//
+// /api/status, /api/com, /api/stats and /api/loopback answer with JSON
+// for monitoring tools. The objects are written straight into
+// pageContent, so nothing is built in a String and the memory used is
+// the fixed page buffer. Keys are kept in flash.
+//
+static bool jsonNeedComma;
 
-    if( server.hasArg(COM_RADIONAME_FLOWCTRL) )
+void jsonKey(const __FlashStringHelper *key)
+{
+    if( jsonNeedComma )
     {
-        btnValue = server.arg(COM_RADIONAME_FLOWCTRL);
-        if( btnValue.equalsIgnoreCase(COM_RADIO_LBL_HANDSHAKE_SW) )
-        {
-            useFlowCtrl = true;
-        }
-        else
-        {
-            useFlowCtrl = false;
-        }
+        pageContent += ',';
     }
 
-    if( server.hasArg(COM_RADIONAME_PARITY) )
-    {
-        useParity = server.arg(COM_RADIONAME_PARITY);
-
-    }
+    pageContent += '"';
+    pageContent += key;
+    pageContent += F("\":");
+    jsonNeedComma = true;
+}
 
-    if( server.hasArg(COM_SELECTION_NAME_BAUD) )
+void jsonKey(const char *key)
+{
+    if( jsonNeedComma )
     {
-        useBaudRate = server.arg(COM_SELECTION_NAME_BAUD);
-
+        pageContent += ',';
     }
 
-    nodeStoreCOMSettings();
-
-    if( nodeRestart )
-    {
-        server.close();
-        ESP.restart();
-    }
+    pageContent += '"';
+    pageContent += key;
+    pageContent += F("\":");
+    jsonNeedComma = true;
+}
 
-    if( SerialOverNetwork )
-    {
-        if( !SONRunning )
-        {
-            StartSON();
-        }
-    }
-    else
-    {
-        if( SONRunning )
-        {
-            StopSON();
-        }
-    }
+void jsonBegin()
+{
+    pageContent = F("{");
+    jsonNeedComma = false;
+}
 
+void jsonObject(const __FlashStringHelper *key)
+{
+    jsonKey(key);
+    pageContent += '{';
+    jsonNeedComma = false;
 }
-//
-// ---- load and handle /comsettings page ----
-//
-void handleComSettings()
+
+void jsonObject(const char *key)
 {
-    String btnValue = "";
+    jsonKey(key);
+    pageContent += '{';
+    jsonNeedComma = false;
+}
 
+void jsonEnd()
+{
+    pageContent += '}';
+    jsonNeedComma = true;
+}
 
-    if( !beQuiet )
-    {
-        Logger.Log(LOGLEVEL_DEBUG,"handleComSettings\n");
-           for(int i = 0; i < server.args(); i++ )
-           {
-                Logger.Log(LOGLEVEL_DEBUG,"%s = %s\n", server.argName(i).c_str(), server.arg(i).c_str() );
-           }
-    }
+void jsonNumber(const __FlashStringHelper *key, unsigned long value)
+{
+    jsonKey(key);
+    pageContent += value;
+}
 
-   if( !adminAccessSucceeded )
-   {
-       handleLoginPage();
-   }
+void jsonInt(const __FlashStringHelper *key, long value)
+{
+    jsonKey(key);
+    pageContent += value;
+}
 
-   if( server.method() == SERVER_METHOD_POST &&
-        ( server.hasArg(COM_BUTTONNAME_FORMRESET) ||
-         server.hasArg(COM_BUTTONNAME_COMMIT) ||
-         server.hasArg(COM_BUTTONNAME_FACTORY) ||
-         server.hasArg(COM_BUTTONNAME_CLOSE) ))
-    {
-        if( server.hasArg(COM_BUTTONNAME_FORMRESET) )
-        {
-            btnValue = server.arg(COM_BUTTONNAME_FORMRESET);
-            if( btnValue.equals(COM_ACTION_RESET) )
-            {
-                nodeRestoreCOMSettings();
-            }
-        }
+void jsonBool(const __FlashStringHelper *key, bool value)
+{
+    jsonKey(key);
+    pageContent += value ? F("true") : F("false");
+}
 
-        if( server.hasArg(COM_BUTTONNAME_COMMIT) )
-        {
-            btnValue = server.arg(COM_BUTTONNAME_COMMIT);
-            if( btnValue.equals(COM_ACTION_COMMIT) )
-            {
-                getComInputValues();
-            }
-        }
+void jsonString(const __FlashStringHelper *key, const char *value)
+{
+    char hex[8];
 
-        if( server.hasArg(COM_BUTTONNAME_FACTORY) )
-        {
-            btnValue = server.arg(COM_BUTTONNAME_FACTORY);
-            if( btnValue.equals(COM_ACTION_FACTORY) )
-            {
-                resetCOM2FactorySettings();
-            }
-        }
+    jsonKey(key);
+    pageContent += '"';
 
-        handleIndexPage();
-    }
-    else
+    for( ; *value != '\0'; value++ )
     {
-
-        pageContent  = "<!DOCTYPE html>\n";
-        pageContent += "<html>\n";
-        pageContent += "<head>\n";
-        pageContent += "<meta charset=\"utf-8\" />\n";
-        pageContent += "<title>COM Setup</title>\n";
-        pageContent += "</head>\n";
-        pageContent += "<body bgcolor=\"#D4C9C9\" text=\"#000000\"";
-        pageContent += "link=\"#1E90FF\" vlink=\"#0000FF\" alink=\"#20FF00\">\n";
-        pageContent += "<div align=\"center\"><strong>";
-        pageContent += "<h1>Change local COM port settings</h1></strong></div>\n";
-//        pageContent += "<form action=\"/comsettings\" method=\"get\">\n";
-        pageContent += "<form action=\"/comsettings\" method=\"post\">\n";
-        pageContent += "<table align=\"center\">\n";
-
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
-//
-// ************************ ENABLE SERIAL OVER NETWORK ************************
-//
-        pageContent += "<tr>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-	pageContent += "    <optgroup label=\"" + String(COM_OPTGRP_LABEL_SON) + "\"\n";
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_ENABLE_SON) + "</label>\n";
-        pageContent += "    <input type=\"radio\" name=\"";
-        pageContent +=      String(COM_RADIONAME_SON) + "\" value=\"";
-        pageContent +=      String(COM_RADIO_SON_ENABLED) + "\"";
-
-        if( SerialOverNetwork )
-        {
-            pageContent += String(" checked>\n");
-        }
-        else
-        {
-            pageContent += String(" unchecked>\n");
-        }
-
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_DISABLE_SON) + "</label>\n";
-        pageContent += "    <input type=\"radio\" name=\"";
-        pageContent +=      String(COM_RADIONAME_SON) + "\" value=\"";
-        pageContent +=      String(COM_RADIO_SON_DISABLED) + "\"";
-
-        if( SerialOverNetwork )
-        {
-            pageContent += String(" unchecked>\n");
-        }
-        else
-        {
-            pageContent += String(" checked>\n");
-        }
-
-        pageContent += "  </td>\n";
-        pageContent += "<div align=\"center\">\n";
-        pageContent += "  </optgroup>\n";
-        pageContent += "</tr>\n";
-//
-// ********************************* PROTOCOL *********************************
-//
-        pageContent += "<tr>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-	pageContent += "    <optgroup label=\"" + String(COM_OPTGRP_LABEL_PROTOCOL) + "\"\n";
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label> " + String(COM_LABEL_PROTOCOL_TCP) + " \n";
-        pageContent += "    <input type=\"radio\" name=\"" + String(COM_RADIONAME_PROTOCOL) + "\" value=\"" + 
-                            String(COM_RADIO_PROTOCOL_TCP) + "\"";
-
-        if( COMProtocolTCP )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
-
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label> " + String(COM_LABEL_PROTOCOL_UDP) + " \n";
-        pageContent += "    <input type=\"radio\" name=\"" + String(COM_RADIONAME_PROTOCOL) + "\" value=\"" + 
-                            String(COM_RADIO_PROTOCOL_UDP) + "\"";
-
-        if( COMProtocolTCP )
-        {
-            pageContent += " unchecked>\n";
-        }
-        else
+        if( *value == '"' || *value == '\\' )
         {
-            pageContent += " checked>\n";
+            pageContent += '\\';
+            pageContent += *value;
         }
-
-        pageContent += "  </td>\n";
-        pageContent += "  </optgroup>\n";
-        pageContent += "</tr>\n";
-
-//
-// ******************************** SERIAL TYPE *******************************
-//
-        pageContent += "<!-- Serial type (sw/hw) -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String( COM_OPTGRP_LABEL_SERIAL_TYPE ) + "\">\n";
-
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_COM_TYPE_HW) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_COM_TYPE);
-        if( useHardSerial )
+        else if( (uint8_t) *value < 0x20 )
         {
-            pageContent += "\" value=\"" + String(COM_RADIO_COM_TYPE_HW) + "\" checked>\n";
+            snprintf(hex, sizeof(hex), "\\u%04x", (uint8_t) *value);
+            pageContent += hex;
         }
         else
         {
-            pageContent += "\" value=\"" + String(COM_RADIO_COM_TYPE_HW) + "\" unchecked>\n";
-        }
-
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_COM_TYPE_SW) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_COM_TYPE);
-        if( useHardSerial )
-        {
-            pageContent += "\" value=\"" + String(COM_RADIO_COM_TYPE_SW) + "\" unchecked>\n";
+            pageContent += *value;
         }
-        else
-        {
-            pageContent += "\" value=\"" + String(COM_RADIO_COM_TYPE_SW) + "\" checked>\n";
-        }
-
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
-
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
-//
-// ****************************** OPERATION MODE ******************************
-//
-
-        pageContent += "<tr>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-	pageContent += "    <optgroup label=\"" + String(COM_OPTGRP_LABEL_OPERATIONMODE) + "\"\n";
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_OPERATIONMODE_SERVER) + "</label>\n";
-        pageContent += "    <input type=\"radio\" name=\"";
-        pageContent +=      String(COM_RADIONAME_OPERATIONMODE) + "\" value=\"";
-        pageContent +=      String(COM_RADIO_OPERATIONMODE_SERVER) + "\"";
+    }
 
-        if( COMServerMode )
-        {
-            pageContent += String(" checked>\n");
-        }
-        else
-        {
-            pageContent += String(" unchecked>\n");
-        }
+    pageContent += '"';
+}
 
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_OPERATIONMODE_CLIENT) + "</label>\n";
-        pageContent += "    <input type=\"radio\" name=\"";
-        pageContent +=      String(COM_RADIONAME_OPERATIONMODE) + "\" value=\"";
-        pageContent +=      String(COM_RADIO_OPERATIONMODE_CLIENT) + "\"";
+void jsonNumbers(const __FlashStringHelper *key, const unsigned long *values, int count)
+{
+    jsonKey(key);
+    pageContent += '[';
 
-        if( COMServerMode )
-        {
-            pageContent += " unchecked>\n";
-        }
-        else
+    for( int i = 0; i < count; i++ )
+    {
+        if( i > 0 )
         {
-            pageContent += " checked>\n";
+            pageContent += ',';
         }
 
-        pageContent += "  </td>\n";
-        pageContent += "<div align=\"center\">\n";
-        pageContent += "  </optgroup>\n";
-        pageContent += "</tr>\n";
-
-//
-// ******************************** TARGET IP *********************************
-//
+        pageContent += values[i];
+    }
 
+    pageContent += ']';
+}
 
-        pageContent += "<tr>\r";
-        pageContent += "  <td> <div align=\"center\">\n";
-	pageContent += "    <optgroup label=\"" + String(COM_LABEL_TARGET_IP) + "\" </td>\n";
-        pageContent += "  <td> <div align=\"center\"></div></td>\n";
-        pageContent += "  <td><div align=\"center\"><input type=\"text\" name=\"";
-        pageContent += String(COM_TARGET_IP) + "\" value=\"" + useTargetIP + "\" maxlength=\"";
-        pageContent += String(EEPROM_MAXLEN_TARGET_IP) + "\"> ";
-        pageContent += "  </td>\n";
-        pageContent += "  <td> <div align=\"center\"></div></td>\n";
-        pageContent += "  </optgroup>\n";
-        pageContent += "</tr>\n";
+void sendJson(int code)
+{
+    pageContent += F("}\n");
+    server.sendHeader("Cache-Control", "no-store");
+    sendPage(code, "application/json");
+}
 
+void sendJsonError(int code, const __FlashStringHelper *message)
+{
+    jsonBegin();
+    jsonKey(F("error"));
+    pageContent += '"';
+    pageContent += message;
+    pageContent += '"';
+    sendJson(code);
+}
 //
-// ****************************************************************************
+// ---- /api/status: node and connection state ----
 //
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
+void handleApiStatus()
+{
+    jsonBegin();
+
+    jsonObject(F("node"));
+    jsonString(F("name"), nodeName.c_str());
+    jsonString(F("ssid"), wlanSSID.c_str());
+    jsonString(F("ip"), wwwServerIP.c_str());
+    jsonBool(F("wlan_connected"), WiFi.status() == WL_CONNECTED);
+    jsonInt(F("rssi"), WiFi.RSSI());
+    jsonNumber(F("uptime_ms"), millis());
+    jsonNumber(F("free_heap"), ESP.getFreeHeap());
+    jsonBool(F("dhcp"), useDhcp);
+    jsonEnd();
+
+    jsonObject(F("boot"));
+    jsonNumber(F("wlan_ms"), bootWlanMillis);
+    jsonNumber(F("ready_ms"), bootReadyMillis);
+    jsonBool(F("fast_connect"), bootFastConnect);
+    jsonBool(F("cached_lease"), wlanOnCachedLease);
+    jsonEnd();
+
+    jsonObject(F("son"));
+    jsonBool(F("enabled"), SerialOverNetwork);
+    jsonBool(F("running"), SONRunning);
+    jsonBool(F("connected"), SONConnected);
+    jsonString(F("mode"), COMServerMode ? "server" : "client");
+    jsonString(F("protocol"), COMProtocolTCP ? "tcp" : "udp");
+    jsonNumber(F("port"), SON_SERVER_PORT);
+
+    if( !COMServerMode )
+    {
+        jsonString(F("target"), useTargetIP.c_str());
+    }
+    else if( COMProtocolTCP )
+    {
+        jsonNumber(F("clients"), sonNumClients);
+        jsonNumber(F("max_clients"), SON_MAX_CLIENTS);
+        jsonInt(F("writer"), sonWriter);
+    }
+    else if( SONConnected )
+    {
+        jsonString(F("peer"), sonUdpPeerIP.toString().c_str());
+    }
 
+    jsonEnd();
+
+    sendJson(200);
+}
 //
-// ********************************** RX PIN **********************************
+// ---- write the line settings as JSON ----
 //
-        pageContent += "<!-- Rx pin -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_GPIO_RX) + "\">\n";
+void jsonComSettings()
+{
+    char parity[2] = { "NEO"[comLine.parity], '\0' };
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_00) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_00) + "\"";
+    jsonNumber(F("baud"), comLine.baud);
+    jsonNumber(F("data_bits"), comLine.dataBits);
+    jsonString(F("parity"), parity);
+    jsonNumber(F("stop_bits"), comLine.stopBits);
+    jsonString(F("flow_control"), useFlowCtrl ? "xonxoff" : useHwFlowCtrl ? "rtscts" : "none");
+    jsonString(F("uart"), useHardSerial ? "hardware" : "software");
+    jsonBool(F("uart_fallback"), sonSoftFallback);
 
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_00) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+    if( !useHardSerial )
+    {
+        jsonNumber(F("rx_pin"), useRxPin.toInt());
+        jsonNumber(F("tx_pin"), useTxPin.toInt());
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_RX_02) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_02) + "\"";
+    jsonNumber(F("rx_buffer"), useHardSerial ? sonRxBufferSize : SON_SOFT_RX_BUFSIZE);
+    jsonNumber(F("packet_max_bytes"), sonPacketMaxBytes);
+    jsonNumber(F("packet_timeout_ms"), sonPacketTimeout);
+    jsonInt(F("packet_delimiter"), sonPacketDelimiter);
+    jsonBool(F("udp_sequence"), sonUdpSequence);
+}
+//
+// ---- /api/com: line settings, changed by a POST with the field names
+//      of the COM settings form ----
+//
+void handleApiCom()
+{
+    String newBaudRate = useBaudRate;
+    String newDataBits = useDataBits;
+    String newParity = useParity;
+    String newStopBits = useStopBits;
+    comLineSettings newLine;
 
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_02) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+    if( server.method() == SERVER_METHOD_POST )
+    {
+        if( !adminAccess() )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(403, F("login required"));
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_04) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_04) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_04) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( server.hasArg(COM_SELECTION_NAME_BAUD) )
         {
-            pageContent += " unchecked>\n";
+            newBaudRate = server.arg(COM_SELECTION_NAME_BAUD);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_RX_05) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_05) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_05) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( server.hasArg(COM_RADIONAME_DATALEN) )
         {
-            pageContent += " unchecked>\n";
+            newDataBits = server.arg(COM_RADIONAME_DATALEN);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_09) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_09) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_09) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( server.hasArg(COM_RADIONAME_PARITY) )
         {
-            pageContent += " unchecked>\n";
+            newParity = server.arg(COM_RADIONAME_PARITY);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_RX_10) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_10) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_10) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( server.hasArg(COM_RADIONAME_STOPBIT) )
         {
-            pageContent += " unchecked>\n";
+            newStopBits = server.arg(COM_RADIONAME_STOPBIT);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_12) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_12) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_12) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( !comParseLineSettings(newBaudRate, newDataBits, newParity, newStopBits, &newLine) ||
+            (!useHardSerial && !comSoftSerialCapable(&newLine)) )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(400, F("invalid line settings"));
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_RX_13) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_13) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_13) )
+        if( server.hasArg(COM_RADIONAME_FLOWCTRL) &&
+            !comTakeHandshake(server.arg(COM_RADIONAME_FLOWCTRL)) )
         {
-            pageContent += " checked>\n";
+            sendJsonError(400, F("RTS/CTS pins used by the software UART"));
+            return;
         }
-        else
+
+        if( !comTakePacketSettings(comPacketArg(COM_FIELDNAME_PACKET_MAXBYTES, sonPacketMaxBytes),
+                                   comPacketArg(COM_FIELDNAME_PACKET_TIMEOUT, sonPacketTimeout),
+                                   comPacketArg(COM_FIELDNAME_PACKET_DELIMITER, sonPacketDelimiter)) )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(400, F("invalid packet settings"));
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_14) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_14) + "\"";
-
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_14) )
+        if( server.hasArg(COM_RADIONAME_UDP_SEQUENCE) &&
+            !comTakeUdpSequence(server.arg(COM_RADIONAME_UDP_SEQUENCE)) )
         {
-            pageContent += " checked>\n";
+            sendJsonError(400, F("invalid UDP sequence setting"));
+            return;
         }
-        else
+
+        if( server.hasArg(COM_FIELDNAME_RX_BUFSIZE) &&
+            !comTakeRxBufferSize(server.arg(COM_FIELDNAME_RX_BUFSIZE)) )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(400, F("invalid RX buffer size"));
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_RX_15) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_15) + "\"";
+        comLine = newLine;
+        useBaudRate = newBaudRate;
+        useDataBits = newDataBits;
+        useParity = newParity;
+        useStopBits = newStopBits;
+        nodeStoreCOMSettings();
 
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_15) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( SONRunning )
         {
-            pageContent += " unchecked>\n";
+            sonApplyLineSettings();
         }
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_RX_16) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_RX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_RX_16) + "\"";
+    jsonBegin();
+    jsonComSettings();
+    sendJson(200);
+}
+//
+// ---- /api/loopback: edge timing of the software UART. Each pair of the
+//      fields rxGPIO and txGPIO of the COM settings form (repeated for
+//      more pairs, default the pins of the COM settings) has to be wired
+//      together. A POST starts the test, the scheduler measures one pair
+//      per step, a GET returns what has been measured so far. Per pair
+//      TX is toggled LOOPBACK_EDGES times and the cycles until the GPIO
+//      interrupt of RX has run are counted, which includes digitalWrite().
+//      The longest time of a test without lost edges is used by
+//      comSoftSerialCapable() until the next restart. SON must not run
+//      on the software UART meanwhile. ----
+//
+#define LOOPBACK_MAX_PAIRS               4
+#define LOOPBACK_EDGES                  64
+#define LOOPBACK_EDGE_TIMEOUT_US       100
+#define LOOPBACK_STEP_INTERVAL          10    // msecs from pair to pair
+
+struct loopbackPair {
+    int rxPin;
+    int txPin;
+    unsigned long edges;              // seen by the interrupt
+    unsigned long lost;
+    uint32_t maxCycles;
+    uint32_t sumCycles;
+};
 
-        if( useRxPin.equalsIgnoreCase(COM_RADIO_GPIO_RX_16) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+static const uint32_t loopbackBauds[] = { 9600, 19200, 38400, 57600, 115200, 230400 };
+
+static loopbackPair loopbackPairs[LOOPBACK_MAX_PAIRS];
+static int loopbackNumPairs;
+static int loopbackDone;              // pairs measured
+static int loopbackTask = -1;         // id of the running test, -1 if none
+static volatile uint32_t loopbackEdgeCycles;
+static volatile bool loopbackEdgeSeen;
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
+void ICACHE_RAM_ATTR loopbackEdge()
+{
+    loopbackEdgeCycles = ESP.getCycleCount();
+    loopbackEdgeSeen = true;
+}
 //
-// ********************************** TX PIN **********************************
+// ---- measure the next pair, the last step takes the result ----
 //
-        pageContent += "<!-- Tx pin -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_GPIO_TX) + "\">\n";
-
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_00) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_00) + "\"";
+void loopbackStep( void *arg )
+{
+    loopbackPair *pair;
+    uint32_t start, cycles;
+    uint32_t timeout = ESP.getCpuFreqMHz() * LOOPBACK_EDGE_TIMEOUT_US;
+    uint32_t latency = 0;
+    int level = LOW;
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_00) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+    if( loopbackDone < loopbackNumPairs && !(SONRunning && !useHardSerial) )
+    {
+        pair = &loopbackPairs[loopbackDone++];
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_TX_02) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_02) + "\"";
+        pinMode(pair->rxPin, INPUT);
+        pinMode(pair->txPin, OUTPUT);
+        digitalWrite(pair->txPin, level);
+        attachInterrupt(digitalPinToInterrupt(pair->rxPin), loopbackEdge, CHANGE);
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_02) )
+        for( int i = 0; i < LOOPBACK_EDGES; i++ )
         {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+            loopbackEdgeSeen = false;
+            level = level == LOW ? HIGH : LOW;
+            start = ESP.getCycleCount();
+            digitalWrite(pair->txPin, level);
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_04) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_04) + "\"";
+            while( !loopbackEdgeSeen && ESP.getCycleCount() - start < timeout )
+            {
+            }
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_04) )
-        {
-            pageContent += " checked>\n";
+            if( loopbackEdgeSeen )
+            {
+                cycles = loopbackEdgeCycles - start;
+                pair->sumCycles += cycles;
+                pair->edges++;
+
+                if( cycles > pair->maxCycles )
+                {
+                    pair->maxCycles = cycles;
+                }
+            }
+            else
+            {
+                pair->lost++;
+            }
         }
-        else
+
+        detachInterrupt(digitalPinToInterrupt(pair->rxPin));
+        pinMode(pair->txPin, INPUT);
+    }
+    else
+    {
+        for( int i = 0; i < loopbackDone; i++ )
         {
-            pageContent += " unchecked>\n";
+            if( loopbackPairs[i].lost == 0 && loopbackPairs[i].maxCycles > latency )
+            {
+                latency = loopbackPairs[i].maxCycles;
+            }
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_TX_05) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_05) + "\"";
-
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_05) )
+        if( latency > 0 )
         {
-            pageContent += " checked>\n";
+            sonSoftLatencyCycles = latency;
         }
-        else
+
+        if( !beQuiet )
         {
-            pageContent += " unchecked>\n";
+            Logger.Log(LOGLEVEL_DEBUG, "loopback: %d of %d pairs, latency %u cycles\n",
+                       loopbackDone, loopbackNumPairs, sonSoftLatencyCycles);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_09) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_09) + "\"";
+        Tasks.Cancel(loopbackTask);
+        loopbackTask = -1;
+    }
+}
+//
+// ---- take the pairs of the request, returns an error text or NULL ----
+//
+const __FlashStringHelper *loopbackTakePairs()
+{
+    const __FlashStringHelper *retVal = NULL;
+    int rx = 0, tx = 0;
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_09) )
+    for( int i = 0; i < server.args(); i++ )
+    {
+        if( server.argName(i) == COM_RADIONAME_GPIO_RX && rx < LOOPBACK_MAX_PAIRS )
         {
-            pageContent += " checked>\n";
+            loopbackPairs[rx++].rxPin = server.arg(i).toInt();
         }
-        else
+        else if( server.argName(i) == COM_RADIONAME_GPIO_TX && tx < LOOPBACK_MAX_PAIRS )
         {
-            pageContent += " unchecked>\n";
+            loopbackPairs[tx++].txPin = server.arg(i).toInt();
         }
+    }
+
+    if( rx == 0 && tx == 0 )
+    {
+        loopbackPairs[0].rxPin = useRxPin.toInt();
+        loopbackPairs[0].txPin = useTxPin.toInt();
+        rx = tx = 1;
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_TX_10) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_10) + "\"";
+    if( rx != tx )
+    {
+        retVal = F("RX and TX pins have to come in pairs");
+    }
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_10) )
+    for( int i = 0; retVal == NULL && i < rx; i++ )
+    {
+        // GPIO 16 has no interrupt
+        if( loopbackPairs[i].rxPin < 0 || loopbackPairs[i].rxPin > 15 ||
+            loopbackPairs[i].txPin < 0 || loopbackPairs[i].txPin > 16 ||
+            loopbackPairs[i].rxPin == loopbackPairs[i].txPin )
         {
-            pageContent += " checked>\n";
+            retVal = F("invalid GPIO pair");
         }
-        else
+        else if( SONRunning && useHwFlowCtrl &&
+                 !comHandshakePinsFree(loopbackPairs[i].rxPin, loopbackPairs[i].txPin) )
         {
-            pageContent += " unchecked>\n";
+            retVal = F("RTS/CTS pins used by SON");
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_12) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_12) + "\"";
+        loopbackPairs[i].edges = loopbackPairs[i].lost = 0;
+        loopbackPairs[i].maxCycles = loopbackPairs[i].sumCycles = 0;
+    }
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_12) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+    loopbackNumPairs = retVal == NULL ? rx : 0;
+    loopbackDone = 0;
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_TX_13) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_13) + "\"";
+    return( retVal );
+}
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_13) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+void handleApiLoopback()
+{
+    comLineSettings line = { 0, COM_DATABITS_8, COM_PARITY_NONE, COM_STOPBITS_1 };
+    const __FlashStringHelper *error;
+    loopbackPair *pair;
+    char key[12];
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_14) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_14) + "\"";
+    if( !adminAccess() )
+    {
+        sendJsonError(403, F("login required"));
+        return;
+    }
 
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_14) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+    if( server.method() == SERVER_METHOD_POST )
+    {
+        if( SONRunning && !useHardSerial )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(409, F("SON runs on the software UART"));
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "    <label>" + String(COM_LABEL_GPIO_TX_15) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_15) + "\"";
-
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_15) )
+        if( loopbackTask >= 0 )
         {
-            pageContent += " checked>\n";
+            sendJsonError(409, F("loopback test running"));
+            return;
         }
-        else
+
+        if( (error = loopbackTakePairs()) != NULL )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(400, error);
+            return;
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_LABEL_GPIO_TX_16) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_GPIO_TX) +
-                                 "\" value=\"" + String(COM_RADIO_GPIO_TX_16) + "\"";
-
-        if( useTxPin.equalsIgnoreCase(COM_RADIO_GPIO_TX_16) )
+        // the GPIO interrupt of RX belongs to the test now
+        if( pSoftSerial != NULL )
         {
-            pageContent += " checked>\n";
+            pSoftSerial->enableRx(false);
         }
-        else
+
+        if( (loopbackTask = Tasks.Every(LOOPBACK_STEP_INTERVAL, loopbackStep, NULL, "loopback")) < 0 )
         {
-            pageContent += " unchecked>\n";
+            sendJsonError(503, F("no free task"));
+            return;
         }
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
-//
-// ********************************** DATABITS **********************************
-//
-
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<!-- Data bits -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_DATALEN) + "\">\n";
-        pageContent += "    </td>\n";
+    jsonBegin();
+    jsonString(F("state"), loopbackTask >= 0 ? "running" : "done");
+    jsonNumber(F("cpu_mhz"), ESP.getCpuFreqMHz());
+    jsonNumber(F("estimate_cycles"), SON_SOFT_ISR_LATENCY_CYCLES);
+    jsonNumber(F("latency_cycles"), sonSoftLatencyCycles);
+    jsonObject(F("pairs"));
 
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_DATALEN_6BIT) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_DATALEN) +
-                                "\" value=\"" + String(COM_RADIO_DATALEN_SIX) + "\"";
+    for( int i = 0; i < loopbackDone; i++ )
+    {
+        pair = &loopbackPairs[i];
+        snprintf(key, sizeof(key), "%d-%d", pair->rxPin, pair->txPin);
+        jsonObject(key);
+        jsonNumber(F("edges"), pair->edges);
+        jsonNumber(F("lost"), pair->lost);
+        jsonNumber(F("max_cycles"), pair->maxCycles);
+        jsonNumber(F("avg_cycles"), pair->edges > 0 ? pair->sumCycles / pair->edges : 0);
+        jsonEnd();
+    }
 
-        if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_SIX) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+    jsonEnd();
+    jsonObject(F("accepted"));
 
-        pageContent += "    </td>\n";
+    for( size_t i = 0; i < sizeof(loopbackBauds) / sizeof(loopbackBauds[0]); i++ )
+    {
+        line.baud = loopbackBauds[i];
+        snprintf(key, sizeof(key), "%lu", (unsigned long) line.baud);
+        jsonKey(key);
+        pageContent += comSoftSerialCapable(&line) ? F("true") : F("false");
+    }
 
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_DATALEN_7BIT) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_DATALEN) +
-                                "\" value=\"" + String(COM_RADIO_DATALEN_SEVEN) + "\"";
+    jsonEnd();
+    sendJson(server.method() == SERVER_METHOD_POST ? 202 : 200);
+}
+//
+// ---- /api/stats: transfer counters, page, loop and task timing ----
+//
+void handleApiStats()
+{
+    const SimpleTaskInfo *task;
+    unsigned long queueDropped = 0;
 
-        if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_SEVEN) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+    for( int i = 0; i < SON_MAX_CLIENTS; i++ )
+    {
+        if( sonClients[i].used )
         {
-            pageContent += " unchecked>\n";
+            queueDropped += sonClients[i].dropped;
         }
-        pageContent += "    </td>\n";
-
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_DATALEN_8BIT) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_DATALEN) +
-                                "\" value=\"" + String(COM_RADIO_DATALEN_EIGHT) + "\"";
+    }
 
-        if( useDataBits.equalsIgnoreCase(COM_RADIO_DATALEN_EIGHT) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
+    jsonBegin();
+    jsonNumber(F("uptime_ms"), millis());
+
+    jsonObject(F("son"));
+    jsonNumber(F("to_net_bytes"), sonStats.toNetBytes);
+    jsonNumber(F("to_net_packets"), sonStats.toNetPackets);
+    jsonNumber(F("to_uart_bytes"), sonStats.toUartBytes);
+    jsonNumber(F("to_uart_packets"), sonStats.toUartPackets);
+    jsonNumber(F("uart_bursts"), sonStats.uartBursts);
+    jsonNumber(F("max_burst_bytes"), sonStats.maxBurst);
+    jsonNumbers(F("latency_ms_log2"), sonStats.latency, SON_LATENCY_BUCKETS);
+    jsonNumber(F("max_latency_ms"), sonStats.maxLatency);
+    jsonNumber(F("net_write_ms"), (unsigned long) (sonStats.netWriteMicros / 1000));
+    jsonNumber(F("uart_write_ms"), (unsigned long) (sonStats.uartWriteMicros / 1000));
+    jsonNumber(F("max_write_us"), sonStats.maxWriteMicros);
+    jsonNumber(F("connects"), sonStats.connects);
+    jsonNumber(F("reconnects"), sonStats.reconnects);
+    jsonNumber(F("connect_fails"), sonStats.connectFails);
+    jsonNumber(F("disconnects"), sonStats.disconnects);
+    jsonNumber(F("udp_lost"), sonUdpLost);
+    jsonNumber(F("queue_dropped_bytes"), queueDropped);
+    jsonEnd();
+
+    jsonObject(F("uart"));
+    jsonNumber(F("overruns"), sonOverruns);
+    jsonNumber(F("flow_stops"), sonFlowStops);
+    jsonNumber(F("held_bytes"), sonHeldBytes);
+    jsonNumber(F("writer_held_bytes"), sonHoldLen);
+    jsonNumber(F("writer_dropped_bytes"), sonHoldDropped);
+    jsonBool(F("flow_stopped"), sonFlowStopped);
+    jsonBool(F("output_paused"), sonUartTxPaused);
+    jsonEnd();
+
+    jsonObject(F("loop"));
+    jsonNumber(F("count"), loopStats.count);
+    jsonNumber(F("max_us"), loopStats.maxMicros);
+    jsonNumber(F("avg_us"), loopStats.count > 0 ?
+                            (unsigned long) (loopStats.totalMicros / loopStats.count) : 0);
+    jsonEnd();
+
+    jsonObject(F("pages"));
+
+    for( int i = 0; i < WEB_PAGE_STATS; i++ )
+    {
+        if( webPageStats[i].asset != NULL )
+        {
+            jsonKey(webPageStats[i].asset->name);
+            pageContent += '{';
+            jsonNeedComma = false;
+            jsonNumber(F("count"), webPageStats[i].count);
+            jsonNumber(F("first_byte_ms"), webPageStats[i].firstByteMillis);
+            jsonNumber(F("max_first_byte_ms"), webPageStats[i].maxFirstByteMillis);
+            jsonNumber(F("heap_used"), webPageStats[i].heapUsed);
+            jsonNumber(F("max_heap_used"), webPageStats[i].maxHeapUsed);
+            jsonEnd();
         }
-        pageContent += "    </td>\n";
+    }
 
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
-//
-// ********************************** STOPBITS **********************************
-//
-        pageContent += "<!-- Stop bits -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_STOPBITS) + "\">\n";
+    jsonEnd();
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_STOPBIT_ONE) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_STOPBIT) +
-                                "\" value=\"" + String(COM_RADIO_STOPBIT_ONE) + "\"";
+    jsonObject(F("tasks"));
 
-        if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_ONE) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
+    for( int id = 0; id < SIMPLE_TASK_MAX_TASKS; id++ )
+    {
+        if( (task = Tasks.GetInfo(id)) != NULL )
+        {
+            jsonKey(task->name);
+            pageContent += '{';
+            jsonNeedComma = false;
+            jsonBool(F("active"), task->used);
+            jsonNumber(F("runs"), task->runs);
+            jsonNumber(F("max_us"), task->maxMicros);
+            jsonNumber(F("max_late_ms"), task->maxLate);
+            jsonNumber(F("overruns"), task->overruns);
+            jsonEnd();
         }
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_STOPBIT_TWO) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_STOPBIT) +
-                                "\" value=\"" + String(COM_RADIO_STOPBIT_TWO) + "\"";
+    jsonEnd();
 
-        if( useStopBits.equalsIgnoreCase(COM_RADIO_STOPBIT_TWO) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
-        {
-            pageContent += " unchecked>\n";
-        }
+    sendJson(200);
+}
 
-        pageContent += "    </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
+// ******************************************** COMSETTINGS *********************************
 //
-// ********************************** PARITY **********************************
+// ---- get user input data from comsettings page ----
 //
+void getComInputValues()
+{
+    String btnValue = "";
+    String opMode = "";
+    bool nodeRestart = false;
+    String newDataBits = useDataBits;
+    String newStopBits = useStopBits;
+    String newParity = useParity;
+    String newBaudRate = useBaudRate;
+    comLineSettings newLine;
+    size_t newRxBufferSize;
 
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG,"getComInputValues ...\n");
+    }
 
-        pageContent += "<!-- Parity -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_PARITY) + "\">\n";
+    btnValue = server.arg(COM_RADIONAME_SON);
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_PARITY_NO) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_PARITY) +
-                                "\" value=\"" + String(COM_RADIO_PARITY_NO) + "\"";
+    if( btnValue.equals(COM_RADIO_SON_ENABLED) )
+    {
+        SerialOverNetwork = true;
+    }
+    else
+    {
+        SerialOverNetwork = false;
+    }
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_NO)) )
+    if( server.hasArg(COM_RADIONAME_OPERATIONMODE) )
+    {
+        nodeRestart = false;
+    	opMode = server.arg(COM_RADIONAME_OPERATIONMODE);
+        if( opMode.equalsIgnoreCase( COM_RADIO_OPERATIONMODE_SERVER ) )
         {
-            pageContent += " checked>\n";
+            if( ! COMServerMode )
+            {
+                nodeRestart = true;
+            }
         }
         else
         {
-            pageContent += " unchecked>\n";
+            if( COMServerMode )
+            {
+                nodeRestart = true;
+            }
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_PARITY_EVEN) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_PARITY) +
-                                "\" value=\"" + String(COM_RADIO_PARITY_EVEN) + "\"";
+        COMServerMode = opMode.equalsIgnoreCase( COM_RADIO_OPERATIONMODE_SERVER );
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_EVEN)) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+        if( !beQuiet )
         {
-            pageContent += " unchecked>\n";
+            Logger.Log(LOGLEVEL_DEBUG, "COMServerMode is now set to %d\n", COMServerMode);
         }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_PARITY_ODD) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_PARITY) +
-                                "\" value=\"" + String(COM_RADIO_PARITY_ODD) + "\"";
+    }
 
-        if( useParity.equalsIgnoreCase(String(COM_RADIO_PARITY_ODD)) )
-        {
-            pageContent += " checked>\n";
-        }
-        else
+    if( server.hasArg(COM_RADIONAME_PROTOCOL) )
+    {
+        btnValue = server.arg(COM_RADIONAME_PROTOCOL);
+
+        // the sockets of the other protocol are set up at start only
+        if( COMProtocolTCP != btnValue.equalsIgnoreCase(String(COM_RADIO_PROTOCOL_TCP)) )
         {
-            pageContent += " unchecked>\n";
+            nodeRestart = true;
         }
-        pageContent += "    </td>\n";
-
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
-//
-// ********************************** HANDSHAKE **********************************
-//
 
+        COMProtocolTCP = btnValue.equalsIgnoreCase(String(COM_RADIO_PROTOCOL_TCP));
+    }
 
-        pageContent += "<!-- Handshake -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_FLOWCTRL) + "\">\n";
+    if( server.hasArg(COM_RADIONAME_UDP_SEQUENCE) )
+    {
+        comTakeUdpSequence(server.arg(COM_RADIONAME_UDP_SEQUENCE));
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_HANDSHAKE_SW) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_FLOWCTRL) +
-                                "\" value=\"" + String(COM_RADIO_LBL_HANDSHAKE_SW) + "\"";
+    if( server.hasArg(COM_FIELDNAME_RX_BUFSIZE) )
+    {
+        newRxBufferSize = sonRxBufferSize;
 
-        if( useFlowCtrl )
+        if( !comTakeRxBufferSize(server.arg(COM_FIELDNAME_RX_BUFSIZE)) )
         {
-            pageContent += " checked>\n";
+            Logger.Log(LOGLEVEL_ERROR, "rejected UART RX ring of %s bytes\n",
+                       server.arg(COM_FIELDNAME_RX_BUFSIZE).c_str());
         }
-        else
+        else if( SONRunning && useHardSerial && sonRxBufferSize != newRxBufferSize )
         {
-            pageContent += " unchecked>\n";
+            // the ring is allocated again by begin()
+            sonApplyLineSettings();
         }
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <label>" + String(COM_RADIO_LBL_HANDSHAKE_NO) + "</label>\n";
-        pageContent += "        <input type=\"radio\" name=\"" + String(COM_RADIONAME_FLOWCTRL) +
-                                "\" value=\"" + String(COM_RADIO_LBL_HANDSHAKE_NO) + "\"";
+    if( server.hasArg(COM_RADIONAME_COM_TYPE) )
+    {
+        btnValue = server.arg(COM_RADIONAME_COM_TYPE);
 
-        if( useFlowCtrl )
+        // the fallback to the hardware UART stays, unless the type changes
+        if( btnValue.equalsIgnoreCase(COM_RADIO_COM_TYPE_HW) )
         {
-            pageContent += " unchecked>\n";
+            useHardSerial = true;
+            sonSoftFallback = false;
         }
-        else
+        else if( !sonSoftFallback )
         {
-            pageContent += " checked>\n";
+            useHardSerial = false;
         }
+    }
 
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    <td> <div align=\"center\"> </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
+    if( server.hasArg(COM_TARGET_IP) )
+    {
+        useTargetIP = server.arg(COM_TARGET_IP);
+    }
 
-//
-// ****************************** TRANSFER SPEED ******************************
-//
+    if( server.hasArg(COM_RADIONAME_GPIO_RX) )
+    {
+        useRxPin = server.arg(COM_RADIONAME_GPIO_RX);
+    }
 
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "<!-- Baud rate -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <optgroup label=\"" + String(COM_OPTGRP_LABEL_SPEED) + "\">\n";
-        pageContent += "    </td>\n";
-        pageContent += "    <td> <div align=\"center\"></div></td>\n";
-        pageContent += "    <td> <div align=\"center\">\n";
-        pageContent += "        <select name=\"" + String(COM_SELECTION_NAME_BAUD) + "\" size=\"1\">\n";
+    if( server.hasArg(COM_RADIONAME_GPIO_TX) )
+    {
+        useTxPin = server.arg(COM_RADIONAME_GPIO_TX);
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B9600)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B9600) + "\">" +
-                                    String(COM_OPTION_LBL_B9600) + "</option>\n";
+    if( server.hasArg(COM_RADIONAME_DATALEN) )
+    {
+        newDataBits = server.arg(COM_RADIONAME_DATALEN);
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B19200)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B19200) + "\">" +
-                                    String(COM_OPTION_LBL_B19200) + "</option>\n";
+    if( server.hasArg(COM_RADIONAME_STOPBIT) )
+    {
+        newStopBits = server.arg(COM_RADIONAME_STOPBIT);
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B38400)) )
+    if( server.hasArg(COM_RADIONAME_FLOWCTRL) )
+    {
+        btnValue = server.arg(COM_RADIONAME_FLOWCTRL);
+        if( !comTakeHandshake(btnValue) )
         {
-            pageContent += "        selected ";
+            Logger.Log(LOGLEVEL_ERROR, "rejected RTS/CTS, GPIO %d/%d are used by the software UART\n",
+                       SON_RTS_PIN, SON_CTS_PIN);
         }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B38400) + "\">" +
-                                    String(COM_OPTION_LBL_B38400) + "</option>\n";
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B57600)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B57600) + "\">" +
-                                    String(COM_OPTION_LBL_B57600) + "</option>\n";
+    if( server.hasArg(COM_RADIONAME_PARITY) )
+    {
+        newParity = server.arg(COM_RADIONAME_PARITY);
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B74880)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B74880) + "\">" +
+    if( server.hasArg(COM_SELECTION_NAME_BAUD) )
+    {
+        newBaudRate = server.arg(COM_SELECTION_NAME_BAUD);
+    }
 
-                                    String(COM_OPTION_LBL_B74880) + "</option>\n";
+    if( !comTakePacketSettings(comPacketArg(COM_FIELDNAME_PACKET_MAXBYTES, sonPacketMaxBytes),
+                               comPacketArg(COM_FIELDNAME_PACKET_TIMEOUT, sonPacketTimeout),
+                               comPacketArg(COM_FIELDNAME_PACKET_DELIMITER, sonPacketDelimiter)) )
+    {
+        Logger.Log(LOGLEVEL_ERROR, "rejected packet settings %s/%s/%s\n",
+                   server.arg(COM_FIELDNAME_PACKET_MAXBYTES).c_str(),
+                   server.arg(COM_FIELDNAME_PACKET_TIMEOUT).c_str(),
+                   server.arg(COM_FIELDNAME_PACKET_DELIMITER).c_str());
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B115200)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B115200) + "\">" +
-                                    String(COM_OPTION_LBL_B115200) + "</option>\n";
+    // an invalid combination is rejected as a whole
+    if( comParseLineSettings(newBaudRate, newDataBits, newParity, newStopBits, &newLine) &&
+        (useHardSerial || comSoftSerialCapable(&newLine)) )
+    {
+        comLine = newLine;
+        useBaudRate = newBaudRate;
+        useDataBits = newDataBits;
+        useParity = newParity;
+        useStopBits = newStopBits;
+    }
+    else
+    {
+        Logger.Log(LOGLEVEL_ERROR, "rejected COM settings %s %s%s%s\n",
+                   newBaudRate.c_str(), newDataBits.c_str(),
+                   newParity.c_str(), newStopBits.c_str());
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B230400)) )
-        {
-            pageContent += "        selected ";
-        }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B230400) + "\">" +
-                                    String(COM_OPTION_LBL_B230400) + "</option>\n";
+    nodeStoreCOMSettings();
+
+    if( nodeRestart )
+    {
+        server.close();
+        ESP.restart();
+    }
 
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B460800)) )
+    if( SerialOverNetwork )
+    {
+        if( !SONRunning )
         {
-            pageContent += "        selected ";
+            StartSON();
         }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B460800) + "\">" +
-                                    String(COM_OPTION_LBL_B460800) + "</option>\n";
-
-        pageContent += "            <option ";
-        if( useBaudRate.equalsIgnoreCase(String(COM_OPTION_VALUE_B921600)) )
+    }
+    else
+    {
+        if( SONRunning )
         {
-            pageContent += "        selected ";
+            StopSON();
         }
-        pageContent += "            value=\"" + String(COM_OPTION_VALUE_B921600) + "\">" +
-                                    String(COM_OPTION_LBL_B921600) + "</option>\n";
-
-        pageContent += "        </select>\n";
-        pageContent += "    </td>\n";
-        pageContent += "    </optgroup>\n";
-        pageContent += "</tr>\n";
+    }
 
-        pageContent += "<!-- Delimiter -->\n";
-        pageContent += "<tr>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "    <td> <div align=\"center\"> <hr>\n";
-        pageContent += "    </div></td>\n";
-        pageContent += "</tr>\n";
-        pageContent += "</table>\n";
-        pageContent += "<div align=\"center\">\n";
+}
+//
+// ---- load and handle /comsettings page ----
+//
+void handleComSettings()
+{
+    String btnValue = "";
 
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(COM_BUTTONNAME_FORMRESET) + "\" value=\"" + 
-                       String(COM_ACTION_RESET) + "\"> \n";
 
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(COM_BUTTONNAME_COMMIT) + "\" value=\"" + 
-                       String(COM_ACTION_COMMIT) + "\"> \n";
+    if( !beQuiet )
+    {
+        Logger.Log(LOGLEVEL_DEBUG,"handleComSettings\n");
+           logServerArgs();
+    }
 
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(COM_BUTTONNAME_FACTORY) + "\" value=\"" + 
-                       String(COM_ACTION_FACTORY) + "\"> \n";
+   if( !adminAccess() )
+   {
+       sendRedirect("/login");
+       return;
+   }
 
-        pageContent += "<input type=\"submit\" name=\"" +
-                       String(COM_BUTTONNAME_CLOSE) + "\" value=\"" + 
-                       String(COM_ACTION_CLOSE) + "\"> \n";
+   if( server.method() == SERVER_METHOD_POST &&
+        ( server.hasArg(COM_BUTTONNAME_FORMRESET) ||
+         server.hasArg(COM_BUTTONNAME_COMMIT) ||
+         server.hasArg(COM_BUTTONNAME_FACTORY) ||
+         server.hasArg(COM_BUTTONNAME_CLOSE) ))
+    {
+        if( server.hasArg(COM_BUTTONNAME_FORMRESET) )
+        {
+            btnValue = server.arg(COM_BUTTONNAME_FORMRESET);
+            if( btnValue.equals(COM_ACTION_RESET) )
+            {
+                nodeRestoreCOMSettings();
+            }
+        }
 
-        pageContent += "</div>\n";
-        pageContent += "</form>\n";
-        pageContent += "<br>";
-        pageContent += "<div align=\"center\">\n";
-        pageContent += "*If you select Software-Serial, you also have to specify\n";
-        pageContent += " a GPIO to use as Rx and one to use as Tx\n";
-        pageContent += "</div>\n";
+        if( server.hasArg(COM_BUTTONNAME_COMMIT) )
+        {
+            btnValue = server.arg(COM_BUTTONNAME_COMMIT);
+            if( btnValue.equals(COM_ACTION_COMMIT) )
+            {
+                getComInputValues();
+            }
+        }
 
-        pageContent += "</body>\n";
-        pageContent += "</html>\n";
+        if( server.hasArg(COM_BUTTONNAME_FACTORY) )
+        {
+            btnValue = server.arg(COM_BUTTONNAME_FACTORY);
+            if( btnValue.equals(COM_ACTION_FACTORY) )
+            {
+                resetCOM2FactorySettings();
+            }
+        }
 
-        server.send(200, "text/html", pageContent);  
+        sendRedirect("/");
+    }
+    else
+    {
+        sendTemplate(&webAssetComSettings);
     }
 
     return;
@@ -3403,50 +5813,44 @@ void LEDOff( void )
 #endif // HAS_STATUS_LED
 }
 
-void signalLED( void )
+void signalLED( void *arg )
 {
 #ifdef HAS_STATUS_LED
 
     static int currLED, lastLED;
-    static long lastLEDChange;
     static int lastChangeMode;
 
-    if( millis() - lastLEDChange >= LED_INTVAL )
+    if( lastChangeMode )
     {
-        if( lastChangeMode )
+        if( SONConnected )
         {
-            if( SONConnected )
-            {
-                currLED = GREEN;
-            }
-            else
-            {
-                currLED = RED;
-            }
-
-            lastChangeMode = 0;
+            currLED = GREEN;
         }
         else
         {
-            if( COMServerMode )
-            {
-                currLED = BLUE;
-            }
-            else
-            {
-                currLED = GREEN;
-            }
-            
-            lastChangeMode = 1;
+            currLED = RED;
         }
 
-        analogWrite(lastLED, 0);
-        analogWrite(currLED, 127);
-        lastLED = currLED;
-        lastLEDChange = millis();
-
+        lastChangeMode = 0;
+    }
+    else
+    {
+        if( COMServerMode )
+        {
+            currLED = BLUE;
+        }
+        else
+        {
+            currLED = GREEN;
+        }
+        
+        lastChangeMode = 1;
     }
 
+    analogWrite(lastLED, 0);
+    analogWrite(currLED, 127);
+    lastLED = currLED;
+
 #endif // HAS_STATUS_LED
 }
 
@@ -3455,117 +5859,151 @@ void signalLED( void )
 // main loop is quite simple ...
 // ************************************************************************
 //
-void loop() 
+//
+// ************************************************************************
+// periodic jobs, run by the scheduler in loop()
+// ************************************************************************
+//
+// ---- a COM-Client connects to its server again. connect() blocks, so
+//      it is only tried every SON_CONNECT_INTERVAL msecs ----
+//
+#define SON_CONNECT_INTERVAL      1000
+
+void sonConnectTask( void *arg )
 {
-    signalLED();
+    IPAddress targetServer;
 
-    if( SerialOverNetwork )
+    if( SerialOverNetwork && COMProtocolTCP && !COMServerMode && !SONConnected )
     {
-        if( SONConnected )
+        if( !beQuiet )
         {
-            if( COMServerMode )
-            {
-                if( !incomingTelnetConnection.connected() )
-                {
-                    if( !beQuiet )
-                    {
-                        Logger.Log(LOGLEVEL_DEBUG,"Client has dropped Connection\n");              
-                    }
-
-                    incomingTelnetConnection.stop();
-                    SONConnected = false;
-
-                    if( !beQuiet )
-                    {
-                        Logger.Log(LOGLEVEL_DEBUG,"free'd IP slot for new client to connect\n");                
-                    }
-                } 
-            }
+            Logger.Log(LOGLEVEL_DEBUG,"try to connect to server\n");
         }
 
-      
-        //check if there are any new clients
-        if( COMServerMode )
+        targetServer.fromString(useTargetIP);
+        if (outgoingTelnetConnection.connect(targetServer, SON_SERVER_PORT)) 
         {
-            if (TelnetServer.hasClient())
+            if( !beQuiet )
             {
-                if( !beQuiet )
-                {
-                    Logger.Log(LOGLEVEL_DEBUG,"Connection request\n");          
-                }
-
-                if( !SONConnected )
-                {
-                    if( !beQuiet )
-                    {
-                        Logger.Log(LOGLEVEL_DEBUG,"SON is NOT connected\n");              
-                    }
-                    incomingTelnetConnection = TelnetServer.available();
-                    SONConnected = true;
-                }
-                else
-                {
-                    if( !incomingTelnetConnection.connected() )
-                    {
-                        incomingTelnetConnection.stop();
-                        incomingTelnetConnection = TelnetServer.available();
-                        SONConnected = true;
-                    }
-                    else
-                    {
-                        WiFiClient Client = TelnetServer.available();
-                        Client.stop();
-                        SONConnected = false;
-                    }
-                }
+                Logger.Log(LOGLEVEL_DEBUG,"connected\n");
             }
+            outgoingTelnetConnection.setNoDelay(true);
+            sonStats.connects++;
+            sonStats.reconnects++;
+            SONConnected = true;
         }
         else
         {
+            sonStats.connectFails++;
+        }
+    }
+}
+//
+// ---- count the age of the cached lease, DHCP takes over when it has
+//      expired. The DHCP client keeps its lease itself, its length and
+//      age are recorded for the next boot ----
+//
+void wlanLeaseTask( void *arg )
+{
+    if( wlanOnCachedLease )
+    {
+        wlanLease.ageSecs += WLAN_LEASE_TICK_MSECS / 1000;
 
-            if( !SONConnected )
-            {
-                if( !beQuiet )
-                {
-                    Logger.Log(LOGLEVEL_DEBUG,"try to connect to server\n");
-                }
+        if( wlanLease.ageSecs >= wlanLease.leaseSecs )
+        {
+            Logger.Log(LOGLEVEL_WARNING, "cached lease of %lu s expired, starting DHCP\n",
+                       (unsigned long) wlanLease.leaseSecs);
+            wlanOnCachedLease = false;
+            WiFi.config(0U, 0U, 0U);
+        }
 
-                IPAddress targetServer;
-                targetServer.fromString(useTargetIP);
-                if (outgoingTelnetConnection.connect(targetServer, SON_SERVER_PORT)) 
-                {
-                    if( !beQuiet )
-                    {
-                        Logger.Log(LOGLEVEL_DEBUG,"connected\n");
-                    }
-                    SONConnected = true;
-                }
+        ESP.rtcUserMemoryWrite(WLAN_LEASE_RTC_OFFSET, (uint32_t*) &wlanLease, sizeof(wlanLease));
+    }
+    else
+    {
+        wlanStoreLease();
+    }
+}
+//
+// ---- log the SON statistics ----
+//
+void sonStatsTask( void *arg )
+{
+    if( SONRunning )
+    {
+        sonLogStats();
+    }
+}
+//
+// ---- start the periodic jobs ----
+//
+void startTasks()
+{
+    Tasks.Every(LED_INTVAL, signalLED, NULL, "led");
+    Tasks.Every(SON_CONNECT_INTERVAL, sonConnectTask, NULL, "connect");
+    Tasks.Every(WLAN_LEASE_TICK_MSECS, wlanLeaseTask, NULL, "lease");
+
+    if( sonStatsLogInterval > 0 )
+    {
+        Tasks.Every(sonStatsLogInterval, sonStatsTask, NULL, "stats");
+    }
+}
+//
+// ************************************************************************
+// main loop
+// - SON and the web server are served in each loop, the scheduler runs
+//   at most one periodic job in between
+// - there is no idle time, the UART has to be read as soon as possible
+// ************************************************************************
+//
+void loop() 
+{
+    unsigned long loopStart = micros();
+    unsigned long loopMicros;
+
+    Tasks.Run();
+
+    if( SerialOverNetwork )
+    {
+        // UDP has no connections to watch
+        if( COMProtocolTCP )
+        {
+            if( COMServerMode )
+            {
+                sonAcceptClients();
             }
             else
             {
-                if (!outgoingTelnetConnection.connected()) 
+                if( SONConnected )
                 {
-                    if( !beQuiet )
+                    if (!outgoingTelnetConnection.connected()) 
                     {
-                        Logger.Log(LOGLEVEL_DEBUG,"Server has dropped Connection\n");              
-                    }
+                        if( !beQuiet )
+                        {
+                            Logger.Log(LOGLEVEL_DEBUG,"Server has dropped Connection\n");              
+                        }
 
-                    outgoingTelnetConnection.stop();
-                    SONConnected = false;
+                        outgoingTelnetConnection.stop();
+                        sonStats.disconnects++;
+                        SONConnected = false;
+                    }
                 }
             }
-
         }
 
         processSON();
     }
-    
-    delay(1);
 
     server.handleClient();
-    
-    delay(1);
 
+    loopMicros = micros() - loopStart;
+    loopStats.count++;
+    loopStats.totalMicros += loopMicros;
+
+    if( loopMicros > loopStats.maxMicros )
+    {
+        loopStats.maxMicros = loopMicros;
+    }
 }
 
 //
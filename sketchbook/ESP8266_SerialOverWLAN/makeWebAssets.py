@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+#
+# ************************************************************************
+# makeWebAssets.py
+# (C) 2016 Dirk Schanz aka dreamshader
+# ************************************************************************
+#
+#   Converts the page templates of the sketch (*.html) into webAssets.h,
+#   that holds them gzip compressed in flash. Run it after a template or
+#   one of the #defines used by a template has been changed:
+#
+#     python3 makeWebAssets.py
+#
+#   Templates are plain HTML with two kinds of placeholders:
+#
+#     %#NAME%        replaced by the value of "#define NAME" of the
+#                    sketch while the asset is built
+#     %NAME%         replaced by the sketch while the page is sent,
+#     %NAME:arg%     see webPageValue(). arg may be a %#NAME% too,
+#     %NAME:#DEF%    written as #DEF.
+#     %%             a percent sign
+#
+#   The text between two runtime placeholders is compressed on its own
+#   and ends at a byte boundary (sync flush), so the sketch can insert
+#   the values as stored deflate blocks and send the page without
+#   compressing anything. The CRC32 of each text and the factor to
+#   shift a CRC over its length are precomputed, so the CRC of the
+#   page can be combined from these and the CRC of the values.
+#
+# ************************************************************************
+#
+#
+#-------- History --------------------------------------------------------
+#
+# 2016/12/28: initial version
+#
+#
+# ************************************************************************
+#
+
+import os
+import re
+import sys
+import zlib
+import gzip
+
+SKETCH = 'ESP8266_SerialOverWLAN.ino'
+OUTPUT = 'webAssets.h'
+
+# file, C name
+ASSETS = [
+    ('index.html',       'webAssetIndex'),
+    ('login.html',       'webAssetLogin'),
+    ('loginfail.html',   'webAssetLoginFail'),
+    ('admin.html',       'webAssetAdmin'),
+    ('comsettings.html', 'webAssetComSettings'),
+]
+
+# has to match PAGE_TEMPLATE_MAX_VALUES in pageTemplate.h
+MAX_VALUES = 64
+MAX_ARGS = 0xFFFF
+
+CRC_POLY = 0xEDB88320
+
+PLACEHOLDER = re.compile(r'%(#?)([A-Z][A-Z0-9_]*)(?::(#?)([^%]*))?%|%%')
+
+#
+# ---- read the #defines of the sketch --------------------------------------
+#
+def readDefines(path):
+    raw = {}
+    for line in open(path, encoding='latin-1'):
+        m = re.match(r'\s*#define\s+(\w+)\s+(.*?)\s*(//.*)?$', line)
+        if m and m.group(1) not in raw:
+            raw[m.group(1)] = m.group(2)
+
+    def resolve(name, depth=0):
+        value = raw[name]
+        m = re.match(r'^"((?:[^"\\]|\\.)*)"$', value)
+        if m:
+            return bytes(m.group(1), 'latin-1').decode('unicode_escape')
+        m = re.match(r"^'(.)'$", value)
+        if m:
+            return m.group(1)
+        if re.match(r'^-?\d+$', value):
+            return value
+        if value in raw and depth < 8:
+            return resolve(value, depth + 1)
+        return None
+
+    defines = {}
+    for name in raw:
+        value = resolve(name)
+        if value is not None:
+            defines[name] = value
+    return defines
+
+#
+# ---- CRC32 arithmetic as in zlib's crc32_combine() ------------------------
+#
+def multmodp(a, b):
+    m = 1 << 31
+    p = 0
+    while True:
+        if a & m:
+            p ^= b
+            if (a & (m - 1)) == 0:
+                break
+        m >>= 1
+        b = (b >> 1) ^ CRC_POLY if b & 1 else b >> 1
+    return p
+
+def x2nmodp(n, k):
+    # x^(n * 2^k) mod p
+    table = [1 << 30]
+    for i in range(1, 32):
+        table.append(multmodp(table[-1], table[-1]))
+    p = 1 << 31
+    while n:
+        if n & 1:
+            p = multmodp(table[k & 31], p)
+        n >>= 1
+        k += 1
+    return p
+
+def crcCombine(crc1, crc2, len2):
+    return multmodp(x2nmodp(len2, 3), crc1) ^ crc2
+
+#
+# ---- split a template into texts and runtime values -----------------------
+#
+def parseTemplate(name, text, defines):
+    parts = []
+    static = ''
+    pos = 0
+
+    def define(ref):
+        if ref not in defines:
+            sys.exit('%s: unknown #define %s' % (name, ref))
+        return defines[ref]
+
+    for m in PLACEHOLDER.finditer(text):
+        static += text[pos:m.start()]
+        pos = m.end()
+        if m.group(0) == '%%':
+            static += '%'
+        elif m.group(1):
+            static += define(m.group(2))
+        else:
+            arg = m.group(4)
+            if arg is not None and m.group(3):
+                arg = define(arg)
+            parts.append((static, m.group(2), arg))
+            static = ''
+
+    static += text[pos:]
+    parts.append((static, None, None))
+    return parts
+
+def compressText(data):
+    if len(data) == 0:
+        return b''
+    c = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    return c.compress(data) + c.flush(zlib.Z_SYNC_FLUSH)
+
+#
+# ---- assemble a page the way pageTemplate does -----------------------------
+#
+def assemble(parts, values):
+    out = bytearray(b'\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\x03')
+    crc = 0
+    size = 0
+    for z, raw, value in parts:
+        out += z
+        crc = crcCombine(crc, zlib.crc32(raw), len(raw))
+        size += len(raw)
+        if value is not None:
+            data = values[value].encode('latin-1')
+            if len(data) > 0:
+                out += bytes([0, len(data) & 0xFF, len(data) >> 8,
+                              ~len(data) & 0xFF, (~len(data) >> 8) & 0xFF])
+                out += data
+                crc = zlib.crc32(data, crc)
+                size += len(data)
+    out += b'\x01\x00\x00\xff\xff'
+    out += crc.to_bytes(4, 'little') + (size & 0xFFFFFFFF).to_bytes(4, 'little')
+    return bytes(out)
+
+def hexLines(data, indent):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ''.join('0x%02x,' % b for b in data[i:i + 16]))
+    return '\n'.join(lines)
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    defines = readDefines(os.path.join(here, SKETCH))
+
+    pages = []
+    valueNames = set()
+
+    for fileName, cName in ASSETS:
+        text = open(os.path.join(here, fileName), encoding='latin-1').read()
+        parts = parseTemplate(fileName, text, defines)
+        for static, value, arg in parts:
+            if value is not None:
+                valueNames.add(value)
+        if len(parts) - 1 > MAX_VALUES:
+            sys.exit('%s: more than %d values' % (fileName, MAX_VALUES))
+        pages.append((fileName, cName, text, parts))
+
+    valueNames = sorted(valueNames)
+
+    args = bytearray()
+    argOffsets = {}
+
+    out = []
+    out.append('//')
+    out.append('// ************************************************************************')
+    out.append('// webAssets.h')
+    out.append('// generated by makeWebAssets.py from the page templates, do not edit')
+    out.append('// ************************************************************************')
+    out.append('//')
+    out.append('')
+    out.append('#ifndef _WEB_ASSETS_')
+    out.append('#define _WEB_ASSETS_')
+    out.append('')
+    out.append('#include "pageTemplate.h"')
+    out.append('')
+    out.append('enum webValueId')
+    out.append('{')
+    for n in valueNames:
+        out.append('    WEB_VALUE_%s,' % n)
+    out.append('    WEB_VALUE_COUNT')
+    out.append('};')
+
+    body = []
+    total = 0
+    for fileName, cName, text, parts in pages:
+        data = bytearray()
+        table = []
+        check = []
+        for static, value, arg in parts:
+            raw = static.encode('latin-1')
+            if len(raw) > 0xFFFF:
+                sys.exit('%s: text longer than 65535 bytes' % fileName)
+            z = compressText(raw)
+            argOffset = 0xFFFF
+            if arg is not None:
+                if arg not in argOffsets:
+                    argOffsets[arg] = len(args)
+                    args.extend(arg.encode('latin-1') + b'\0')
+                argOffset = argOffsets[arg]
+            table.append('    { %5d, %5d, %5d, 0x%08x, 0x%08x, 0x%04x, %s },' % (
+                len(data), len(z), len(raw), zlib.crc32(raw),
+                x2nmodp(len(raw), 3), argOffset,
+                'WEB_VALUE_' + value if value else 'PAGE_TEMPLATE_NO_VALUE'))
+            check.append((z, raw, value))
+            data += z
+
+        # the result has to inflate to the template filled in
+        sample = dict((n, '<%s>' % n) for n in valueNames)
+        sample[valueNames[0]] = ''
+        expect = ''.join(s + (sample[v] if v else '') for s, v, a in parts)
+        if gzip.decompress(assemble(check, sample)) != expect.encode('latin-1'):
+            sys.exit('%s: self check failed' % fileName)
+
+        total += len(data)
+        hashValue = zlib.crc32(data)
+        body.append('')
+        body.append('// %s: %d bytes text, %d bytes compressed, %d values' % (
+            fileName, sum(len(p[0]) for p in parts), len(data), len(parts) - 1))
+        body.append('static const uint8_t %sData[] PROGMEM =' % cName)
+        body.append('{')
+        body.append(hexLines(data, '    '))
+        body.append('};')
+        body.append('')
+        body.append('static const pageTemplatePart %sParts[] PROGMEM =' % cName)
+        body.append('{')
+        body.extend(table)
+        body.append('};')
+        body.append('')
+        body.append('static const pageTemplateAsset %s =' % cName)
+        body.append('{')
+        body.append('    "%s", %sData, %sParts, webAssetArgs,' % (fileName, cName, cName))
+        body.append('    %d, 0x%08x' % (len(parts), hashValue))
+        body.append('};')
+
+    if len(args) > MAX_ARGS:
+        sys.exit('too many arguments')
+
+    out.append('')
+    out.append('// arguments of the values, see pageTemplatePart.arg')
+    out.append('static const char webAssetArgs[] PROGMEM =')
+    out.append('{')
+    out.append(hexLines(args, '    '))
+    out.append('};')
+    out.extend(body)
+    out.append('')
+    out.append('#endif // _WEB_ASSETS_')
+
+    open(os.path.join(here, OUTPUT), 'w').write('\n'.join(out) + '\n')
+    print('%s: %d pages, %d bytes compressed' % (OUTPUT, len(pages), total))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,333 @@
+//
+// ************************************************************************
+// pageStream
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Streams a HTML page to the client of an ESP8266WebServer while it
+//   is built, see pageStream.h
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/28: initial version
+// 2016/12/29: capture(), write()
+//
+//
+// ************************************************************************
+//
+
+#include "pageStream.h"
+
+pageStream::pageStream()
+{
+  _server = NULL;
+  _sink = NULL;
+  _sinkCtx = NULL;
+  _code = 200;
+  _contentType = "text/html";
+  // no reset() here, the SDK is not up while globals are constructed
+  _len = 0;
+  _total = 0;
+  _streaming = false;
+  _startMillis = 0;
+  _firstByteMillis = 0;
+  _heapAtStart = 0;
+  _heapMin = 0;
+}
+
+//
+// ************************************************************************
+// the web server the pages are sent with
+// ************************************************************************
+//
+void pageStream::begin(ESP8266WebServer *server)
+{
+  _server = server;
+}
+
+//
+// ************************************************************************
+// status code and content type for the next page. Has to be called
+// before the page is started.
+// ************************************************************************
+//
+void pageStream::begin(int code, const char *contentType)
+{
+  _code = code;
+  _contentType = contentType;
+}
+
+//
+// ************************************************************************
+// forget the current page. A page that is streamed already is
+// terminated first, so the client is not left waiting.
+// ************************************************************************
+//
+void pageStream::reset()
+{
+  if( _streaming && _server != NULL )
+  {
+    flush();
+    _server->sendContent("");
+  }
+
+  _len = 0;
+  _total = 0;
+  _streaming = false;
+  _startMillis = millis();
+  _firstByteMillis = 0;
+  _heapAtStart = ESP.getFreeHeap();
+  _heapMin = _heapAtStart;
+}
+
+pageStream& pageStream::operator=(const char *s)
+{
+  reset();
+  return( *this += s );
+}
+
+pageStream& pageStream::operator=(const __FlashStringHelper *s)
+{
+  reset();
+  return( *this += s );
+}
+
+pageStream& pageStream::operator+=(const char *s)
+{
+  if( s != NULL )
+  {
+    append(s, strlen(s));
+  }
+
+  return( *this );
+}
+
+pageStream& pageStream::operator+=(const __FlashStringHelper *s)
+{
+  if( s != NULL )
+  {
+    append_P((PGM_P) s, strlen_P((PGM_P) s));
+  }
+
+  return( *this );
+}
+
+pageStream& pageStream::operator+=(const String &s)
+{
+  sampleHeap();
+  append(s.c_str(), s.length());
+
+  return( *this );
+}
+
+pageStream& pageStream::operator+=(char c)
+{
+  append(&c, 1);
+
+  return( *this );
+}
+
+pageStream& pageStream::operator+=(int value)
+{
+  return( *this += (long) value );
+}
+
+pageStream& pageStream::operator+=(unsigned int value)
+{
+  return( *this += (unsigned long) value );
+}
+
+pageStream& pageStream::operator+=(long value)
+{
+  char num[12];
+
+  ltoa(value, num, 10);
+
+  return( *this += num );
+}
+
+pageStream& pageStream::operator+=(unsigned long value)
+{
+  char num[12];
+
+  ultoa(value, num, 10);
+
+  return( *this += num );
+}
+
+void pageStream::write(const uint8_t *data, size_t len)
+{
+  append((const char *) data, len);
+}
+
+void pageStream::write_P(PGM_P data, size_t len)
+{
+  append_P(data, len);
+}
+
+//
+// ************************************************************************
+// pass everything appended from now on to sink. The counters start
+// over, length() is the amount passed. capture(NULL, NULL) flushes the
+// buffer and returns to normal operation.
+// ************************************************************************
+//
+void pageStream::capture(pageStreamSink sink, void *ctx)
+{
+  if( _sink != NULL )
+  {
+    flush();
+  }
+
+  _sink = sink;
+  _sinkCtx = ctx;
+  _len = 0;
+  _total = 0;
+}
+
+//
+// ************************************************************************
+// copy data to the buffer, a full buffer is sent as a chunk
+// ************************************************************************
+//
+void pageStream::append(const char *data, size_t len)
+{
+  size_t part;
+
+  while( len > 0 )
+  {
+    if( _len == sizeof(_buf) )
+    {
+      flush();
+    }
+
+    part = sizeof(_buf) - _len;
+
+    if( part > len )
+    {
+      part = len;
+    }
+
+    memcpy(_buf + _len, data, part);
+    _len += part;
+    _total += part;
+    data += part;
+    len -= part;
+  }
+}
+
+//
+// ************************************************************************
+// same as append() for data in flash
+// ************************************************************************
+//
+void pageStream::append_P(PGM_P data, size_t len)
+{
+  size_t part;
+
+  while( len > 0 )
+  {
+    if( _len == sizeof(_buf) )
+    {
+      flush();
+    }
+
+    part = sizeof(_buf) - _len;
+
+    if( part > len )
+    {
+      part = len;
+    }
+
+    memcpy_P(_buf + _len, data, part);
+    _len += part;
+    _total += part;
+    data += part;
+    len -= part;
+  }
+}
+
+//
+// ************************************************************************
+// send the buffer as a chunk resp. pass it to the sink. The header goes
+// out with the first chunk. Without a client (e.g. while the page is
+// built in setup()) the data is dropped.
+// ************************************************************************
+//
+void pageStream::flush()
+{
+  sampleHeap();
+
+  if( _sink != NULL )
+  {
+    if( _len > 0 )
+    {
+      _sink(_sinkCtx, _buf, _len);
+    }
+  }
+  else if( _server != NULL && _server->client().connected() )
+  {
+    if( !_streaming )
+    {
+      _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+      _server->send(_code, _contentType, "");
+      _streaming = true;
+      _firstByteMillis = millis() - _startMillis;
+    }
+
+    if( _len > 0 )
+    {
+      _server->sendContent(_buf, _len);
+    }
+  }
+
+  _len = 0;
+}
+
+//
+// ************************************************************************
+// finish the page. A page that fits into the buffer is sent as a whole,
+// otherwise the last chunk and the end mark are sent.
+// ************************************************************************
+//
+void pageStream::send(int code, const char *contentType)
+{
+  if( _server != NULL )
+  {
+    if( !_streaming )
+    {
+      sampleHeap();
+      _server->setContentLength(_len);
+      _server->send(code, contentType, "");
+      _firstByteMillis = millis() - _startMillis;
+
+      if( _len > 0 )
+      {
+        _server->sendContent(_buf, _len);
+      }
+    }
+    else
+    {
+      flush();
+      _server->sendContent("");
+    }
+  }
+
+  _len = 0;
+  _streaming = false;
+  _code = 200;
+  _contentType = "text/html";
+}
+
+void pageStream::sampleHeap()
+{
+  uint32_t heap = ESP.getFreeHeap();
+
+  if( heap < _heapMin )
+  {
+    _heapMin = heap;
+  }
+}
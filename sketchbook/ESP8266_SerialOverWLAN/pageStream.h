@@ -0,0 +1,113 @@
+//
+// ************************************************************************
+// pageStream
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Streams a HTML page to the client of an ESP8266WebServer while it
+//   is built. The page is collected in a fixed buffer that is sent as
+//   a chunk whenever it is full, so the memory used does not depend on
+//   the size of the page. Pages that fit into the buffer are sent in
+//   one piece with a Content-Length header.
+//
+//   It is used like the String the pages were built in before:
+//
+//     pageContent  = F("<!DOCTYPE html>\n");
+//     pageContent += "...";
+//     pageContent.send(200, "text/html");
+//
+//   Status code and content type have to be known before the first
+//   chunk goes out, they are set by begin() resp. default to 200 and
+//   text/html.
+//
+//   capture() passes the buffer to a function instead of the client,
+//   e.g. to measure a text or to send it as part of a response built
+//   by the caller.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/28: initial version
+// 2016/12/29: capture(), write()
+//
+//
+// ************************************************************************
+//
+
+#ifndef _PAGE_STREAM_
+#define _PAGE_STREAM_
+
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include "Arduino.h"
+#else
+  #include "WProgram.h"
+#endif
+#include <ESP8266WebServer.h>
+
+#ifndef PAGE_STREAM_CHUNK
+#define PAGE_STREAM_CHUNK             1024
+#endif
+
+typedef void (*pageStreamSink)(void *ctx, const char *data, size_t len);
+
+class pageStream
+{
+ public:
+   pageStream();
+   void begin(ESP8266WebServer *server);
+   void begin(int code, const char *contentType);
+
+   // start a new page
+   pageStream& operator=(const char *s);
+   pageStream& operator=(const __FlashStringHelper *s);
+
+   // append to the page
+   pageStream& operator+=(const char *s);
+   pageStream& operator+=(const __FlashStringHelper *s);
+   pageStream& operator+=(const String &s);
+   pageStream& operator+=(char c);
+   pageStream& operator+=(int value);
+   pageStream& operator+=(unsigned int value);
+   pageStream& operator+=(long value);
+   pageStream& operator+=(unsigned long value);
+
+   // append binary data
+   void write(const uint8_t *data, size_t len);
+   void write_P(PGM_P data, size_t len);
+
+   // finish the page
+   void send(int code, const char *contentType);
+
+   // pass the buffer to sink instead of the client, NULL to stop
+   void capture(pageStreamSink sink, void *ctx);
+   void flush();
+
+   // figures of the last page sent
+   size_t length() { return( _total ); };
+   unsigned long firstByteMillis() { return( _firstByteMillis ); };
+   uint32_t heapUsed() { return( _heapAtStart - _heapMin ); };
+
+ private:
+   void reset();
+   void append(const char *data, size_t len);
+   void append_P(PGM_P data, size_t len);
+   void sampleHeap();
+
+   ESP8266WebServer *_server;
+   pageStreamSink _sink;
+   void *_sinkCtx;
+   char _buf[PAGE_STREAM_CHUNK];
+   size_t _len;
+   size_t _total;
+   bool _streaming;
+   int _code;
+   const char *_contentType;
+   unsigned long _startMillis;
+   unsigned long _firstByteMillis;
+   uint32_t _heapAtStart;
+   uint32_t _heapMin;
+};
+
+#endif // _PAGE_STREAM_
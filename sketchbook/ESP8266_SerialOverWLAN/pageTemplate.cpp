@@ -0,0 +1,329 @@
+//
+// ************************************************************************
+// pageTemplate
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Sends a gzip compressed page template with values filled in, see
+//   pageTemplate.h
+//
+//   The response is a gzip member: header, the compressed texts, each
+//   followed by its value as stored deflate block, an empty final
+//   block, CRC32 and length of the inflated page.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/29: initial version
+// 2016/12/30: time to first byte and heap use of the last page
+//
+//
+// ************************************************************************
+//
+
+#include "pageTemplate.h"
+
+#define CRC32_POLY                0xEDB88320UL
+
+#define GZIP_HEADER_LEN           10
+#define GZIP_STORED_HEADER_LEN     5
+#define GZIP_TRAILER_LEN          (5 + 8)    // final block, CRC, length
+
+static const uint8_t gzipHeader[GZIP_HEADER_LEN] PROGMEM =
+{
+  0x1f, 0x8b,               // magic
+  0x08,                     // deflate
+  0x00,                     // no flags
+  0x00, 0x00, 0x00, 0x00,   // no time stamp
+  0x00,                     // no extra flags
+  0x03                      // Unix
+};
+
+pageTemplate::pageTemplate()
+{
+  _server = NULL;
+  _page = NULL;
+  _valueFunc = NULL;
+  _crc = 0;
+  _rawLen = 0;
+  _length = 0;
+  _startMillis = 0;
+  _firstByteMillis = 0;
+  _heapAtStart = 0;
+  _heapMin = 0;
+}
+
+void pageTemplate::begin(ESP8266WebServer *server, pageStream *page, pageTemplateValueFunc valueFunc)
+{
+  _server = server;
+  _page = page;
+  _valueFunc = valueFunc;
+}
+
+//
+// ************************************************************************
+// send the page resp. 304 if the client has it already
+// ************************************************************************
+//
+int pageTemplate::send(const pageTemplateAsset *asset, const char *cacheControl)
+{
+  char etag[24];
+  int retVal;
+
+  _startMillis = millis();
+  _heapAtStart = ESP.getFreeHeap();
+  _heapMin = _heapAtStart;
+
+  if( !measure(asset) )
+  {
+    _server->send(500, "text/plain", "value too long\n");
+    _firstByteMillis = millis() - _startMillis;
+    retVal = 500;
+  }
+  else
+  {
+    snprintf(etag, sizeof(etag), "\"%08lx-%08lx\"",
+             (unsigned long) asset->hash, (unsigned long) _crc);
+
+    _server->sendHeader("ETag", etag);
+    _server->sendHeader("Cache-Control", cacheControl);
+
+    if( _server->header("If-None-Match").indexOf(etag) >= 0 )
+    {
+      _server->send(304, "text/html", "");
+      _firstByteMillis = millis() - _startMillis;
+      _length = 0;
+      retVal = 304;
+    }
+    else
+    {
+      _server->sendHeader("Content-Encoding", "gzip");
+      _server->setContentLength(_length);
+      _server->send(200, "text/html", "");
+      _firstByteMillis = millis() - _startMillis;
+      sampleHeap();
+      stream(asset);
+      retVal = 200;
+    }
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// first pass: render the values to get their lengths and the CRC and
+// length of the inflated page. The CRC of the texts is shifted in from
+// the precomputed parts.
+// ************************************************************************
+//
+bool pageTemplate::measure(const pageTemplateAsset *asset)
+{
+  pageTemplatePart part;
+  size_t before, len;
+  uint16_t numValues = 0;
+  bool retVal = true;
+
+  _crc = 0;
+  _rawLen = 0;
+  _length = GZIP_HEADER_LEN + GZIP_TRAILER_LEN;
+
+  _page->capture(measureSink, this);
+
+  for( uint16_t i = 0; i < asset->numParts; i++ )
+  {
+    readPart(asset, i, &part);
+
+    _crc = crc32Shift(part.crcShift, _crc) ^ part.crc;
+    _rawLen += part.rawLen;
+    _length += part.zLen;
+
+    if( part.value != PAGE_TEMPLATE_NO_VALUE && numValues < PAGE_TEMPLATE_MAX_VALUES )
+    {
+      before = _page->length();
+      value(asset, &part);
+      _page->flush();
+      len = _page->length() - before;
+
+      if( len > PAGE_TEMPLATE_MAX_VALUE_LEN )
+      {
+        len = 0;
+        retVal = false;
+      }
+
+      _valueLen[numValues++] = len;
+
+      if( len > 0 )
+      {
+        _length += GZIP_STORED_HEADER_LEN + len;
+      }
+    }
+  }
+
+  _page->capture(NULL, NULL);
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// second pass: send header, texts and values
+// ************************************************************************
+//
+void pageTemplate::stream(const pageTemplateAsset *asset)
+{
+  pageTemplatePart part;
+  uint8_t block[GZIP_TRAILER_LEN];
+  uint16_t numValues = 0;
+  uint16_t len;
+
+  _page->capture(sendSink, this);
+  _page->write_P((PGM_P) gzipHeader, sizeof(gzipHeader));
+
+  for( uint16_t i = 0; i < asset->numParts; i++ )
+  {
+    readPart(asset, i, &part);
+
+    _page->write_P((PGM_P) asset->data + part.offset, part.zLen);
+
+    if( part.value != PAGE_TEMPLATE_NO_VALUE && numValues < PAGE_TEMPLATE_MAX_VALUES )
+    {
+      len = _valueLen[numValues++];
+
+      if( len > 0 )
+      {
+        // stored block, not final. The texts end byte aligned.
+        block[0] = 0x00;
+        block[1] = len & 0xff;
+        block[2] = len >> 8;
+        block[3] = ~len & 0xff;
+        block[4] = (~len >> 8) & 0xff;
+        _page->write(block, GZIP_STORED_HEADER_LEN);
+        value(asset, &part);
+      }
+    }
+  }
+
+  // empty final block
+  block[0] = 0x01;
+  block[1] = 0x00;
+  block[2] = 0x00;
+  block[3] = 0xff;
+  block[4] = 0xff;
+
+  for( int i = 0; i < 4; i++ )
+  {
+    block[5 + i] = (_crc >> (8 * i)) & 0xff;
+    block[9 + i] = (_rawLen >> (8 * i)) & 0xff;
+  }
+
+  _page->write(block, GZIP_TRAILER_LEN);
+  _page->capture(NULL, NULL);
+}
+
+void pageTemplate::readPart(const pageTemplateAsset *asset, uint16_t idx, pageTemplatePart *part)
+{
+  memcpy_P(part, &asset->parts[idx], sizeof(*part));
+}
+
+//
+// ************************************************************************
+// let the sketch write a value to the page
+// ************************************************************************
+//
+void pageTemplate::value(const pageTemplateAsset *asset, const pageTemplatePart *part)
+{
+  char arg[PAGE_TEMPLATE_MAX_ARG];
+
+  if( part->arg != PAGE_TEMPLATE_NO_ARG )
+  {
+    strncpy_P(arg, asset->args + part->arg, sizeof(arg) - 1);
+    arg[sizeof(arg) - 1] = '\0';
+    _valueFunc(part->value, arg);
+  }
+  else
+  {
+    _valueFunc(part->value, NULL);
+  }
+}
+
+void pageTemplate::measureSink(void *ctx, const char *data, size_t len)
+{
+  pageTemplate *self = (pageTemplate *) ctx;
+
+  self->sampleHeap();
+  self->_crc = crc32Update(self->_crc, (const uint8_t *) data, len);
+  self->_rawLen += len;
+}
+
+void pageTemplate::sendSink(void *ctx, const char *data, size_t len)
+{
+  pageTemplate *self = (pageTemplate *) ctx;
+
+  self->sampleHeap();
+
+  if( self->_server->client().connected() )
+  {
+    self->_server->sendContent(data, len);
+  }
+}
+
+//
+// ************************************************************************
+// CRC32 as used by gzip, continued from a previous CRC
+// ************************************************************************
+//
+uint32_t pageTemplate::crc32Update(uint32_t crc, const uint8_t *data, size_t len)
+{
+  crc = ~crc;
+
+  while( len-- > 0 )
+  {
+    crc ^= *data++;
+
+    for( int bit = 0; bit < 8; bit++ )
+    {
+      crc = (crc >> 1) ^ (CRC32_POLY & (0 - (crc & 1)));
+    }
+  }
+
+  return( ~crc );
+}
+
+//
+// ************************************************************************
+// multiply crc by shift modulo the CRC polynomial. With shift being
+// x^(8 * n) this is the CRC of the data followed by n zero bytes, the
+// CRC of a text can then just be xored in (see zlib's crc32_combine).
+// ************************************************************************
+//
+uint32_t pageTemplate::crc32Shift(uint32_t shift, uint32_t crc)
+{
+  uint32_t m = 1UL << 31;
+  uint32_t retVal = 0;
+
+  while( m != 0 )
+  {
+    if( shift & m )
+    {
+      retVal ^= crc;
+    }
+
+    m >>= 1;
+    crc = (crc & 1) ? (crc >> 1) ^ CRC32_POLY : crc >> 1;
+  }
+
+  return( retVal );
+}
+
+void pageTemplate::sampleHeap()
+{
+  uint32_t heap = ESP.getFreeHeap();
+
+  if( heap < _heapMin )
+  {
+    _heapMin = heap;
+  }
+}
@@ -0,0 +1,117 @@
+//
+// ************************************************************************
+// pageTemplate
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Sends a page template that makeWebAssets.py has put into flash as
+//   gzip compressed response. The template consists of compressed texts
+//   and values that are filled in while the page is sent. A value
+//   function writes them to a pageStream and is called twice per page:
+//   once to get the length and the CRC of the page, once to send it.
+//   It has to produce the same text both times.
+//
+//   The ETag of a page is made of the hash of the template and the CRC
+//   of the page. A request with a matching If-None-Match gets a 304.
+//   The header has to be collected by the web server:
+//
+//     const char *headers[] = { "If-None-Match" };
+//     server.collectHeaders(headers, 1);
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/29: initial version
+// 2016/12/30: time to first byte and heap use of the last page
+//
+//
+// ************************************************************************
+//
+
+#ifndef _PAGE_TEMPLATE_
+#define _PAGE_TEMPLATE_
+
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include "Arduino.h"
+#else
+  #include "WProgram.h"
+#endif
+#include <ESP8266WebServer.h>
+#include "pageStream.h"
+
+#ifndef PAGE_TEMPLATE_MAX_VALUES
+#define PAGE_TEMPLATE_MAX_VALUES        64    // see makeWebAssets.py
+#endif
+#define PAGE_TEMPLATE_MAX_ARG           32
+#define PAGE_TEMPLATE_MAX_VALUE_LEN  65535    // one stored deflate block
+#define PAGE_TEMPLATE_NO_VALUE        0xFF
+#define PAGE_TEMPLATE_NO_ARG        0xFFFF
+
+//
+// a compressed text followed by a value, in flash
+//
+struct pageTemplatePart
+{
+  uint32_t offset;        // of the compressed text in the data
+  uint16_t zLen;          // compressed length, 0 for an empty text
+  uint16_t rawLen;        // length of the text
+  uint32_t crc;           // CRC32 of the text
+  uint32_t crcShift;      // x^(8 * rawLen) mod P, see crc32Shift()
+  uint16_t arg;           // offset of the argument, PAGE_TEMPLATE_NO_ARG
+  uint8_t value;          // id of the value, PAGE_TEMPLATE_NO_VALUE
+};
+
+struct pageTemplateAsset
+{
+  const char *name;
+  const uint8_t *data;              // in flash
+  const pageTemplatePart *parts;    // in flash
+  const char *args;                 // in flash
+  uint16_t numParts;
+  uint32_t hash;                    // CRC32 of the data
+};
+
+typedef void (*pageTemplateValueFunc)(uint8_t value, const char *arg);
+
+class pageTemplate
+{
+ public:
+   pageTemplate();
+   void begin(ESP8266WebServer *server, pageStream *page, pageTemplateValueFunc valueFunc);
+
+   // send the page, returns the status code
+   int send(const pageTemplateAsset *asset, const char *cacheControl);
+
+   // figures of the last page sent
+   size_t length() { return( _length ); };
+   uint32_t rawLength() { return( _rawLen ); };
+   unsigned long firstByteMillis() { return( _firstByteMillis ); };
+   uint32_t heapUsed() { return( _heapAtStart - _heapMin ); };
+
+ private:
+   bool measure(const pageTemplateAsset *asset);
+   void stream(const pageTemplateAsset *asset);
+   void readPart(const pageTemplateAsset *asset, uint16_t idx, pageTemplatePart *part);
+   void value(const pageTemplateAsset *asset, const pageTemplatePart *part);
+   static void measureSink(void *ctx, const char *data, size_t len);
+   static void sendSink(void *ctx, const char *data, size_t len);
+   static uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len);
+   static uint32_t crc32Shift(uint32_t shift, uint32_t crc);
+   void sampleHeap();
+
+   ESP8266WebServer *_server;
+   pageStream *_page;
+   pageTemplateValueFunc _valueFunc;
+   uint16_t _valueLen[PAGE_TEMPLATE_MAX_VALUES];
+   uint32_t _crc;
+   uint32_t _rawLen;
+   size_t _length;
+   unsigned long _startMillis;
+   unsigned long _firstByteMillis;
+   uint32_t _heapAtStart;
+   uint32_t _heapMin;
+};
+
+#endif // _PAGE_TEMPLATE_
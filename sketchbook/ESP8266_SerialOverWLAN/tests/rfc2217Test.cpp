@@ -0,0 +1,553 @@
+//
+// ************************************************************************
+// SerialOverWLAN - host test of the Telnet/RFC 2217 handling
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Acts as RFC 2217 client of the COM-Server: the option negotiation
+//   and the SET-BAUDRATE, SET-DATASIZE, SET-PARITY, SET-STOPSIZE and
+//   SET-CONTROL commands a client like pyserial sends are fed through
+//   sonClientInput() resp. sonTelnetFilter() and the answers queued for
+//   the client are compared with the expected ones.
+//
+//   The output queues are checked, too: data dropped from the queue of
+//   a slow Telnet client must never cut an answer or an IAC IAC.
+//
+//   While the device has stopped us, the commands of the writer must
+//   still be handled, its data is held back.
+//
+//   The functions are taken from the sketch by extract.py, see the
+//   Makefile. Build and run on a Linux host with "make test".
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/30: initial version
+// 2016/12/31: commands while the device has stopped us, RTS/CTS
+// 2017/01/01: PURGE-DATA RX clears the queues of all clients
+//             the software UART check uses the measured latency
+//
+//
+// ************************************************************************
+//
+
+#include <stdio.h>
+#include "sonStubs.h"
+
+size_t sonUartRoom();
+size_t sonUartWrite(const uint8_t *data, size_t len);
+void sonApplyLineSettings();
+
+#include "sonSketch.inc"
+
+static int fails = 0;
+static int total = 0;
+static int lineChanges = 0;
+
+size_t sonUartRoom()
+{
+    return( sonUartStopped() ? 0 : Serial.availableForWrite() );
+}
+
+size_t sonUartWrite(const uint8_t *data, size_t len)
+{
+    return( Serial.write(data, len) );
+}
+
+void sonApplyLineSettings()
+{
+    lineChanges++;
+}
+
+static std::string bytes(std::initializer_list<int> list)
+{
+    std::string retVal;
+
+    for( int c : list )
+    {
+        retVal += (char) c;
+    }
+
+    return( retVal );
+}
+
+static std::string hex(const std::string &data)
+{
+    std::string retVal;
+    char buf[4];
+
+    for( unsigned char c : data )
+    {
+        snprintf(buf, sizeof(buf), "%02x ", c);
+        retVal += buf;
+    }
+
+    return( retVal );
+}
+
+static void expect(const char *what, const std::string &result, const std::string &expected)
+{
+    total++;
+    if( result != expected )
+    {
+        fails++;
+        printf("FAIL %s:\n  got      %s\n  expected %s\n", what, hex(result).c_str(),
+               hex(expected).c_str());
+    }
+}
+
+static void expectTrue(const char *what, bool ok)
+{
+    total++;
+    if( !ok )
+    {
+        fails++;
+        printf("FAIL %s\n", what);
+    }
+}
+
+//
+// an answer of the server to a COM-PORT-OPTION command
+//
+static std::string reply(int cmd, std::initializer_list<int> value)
+{
+    return( bytes({ TELNET_IAC, TELNET_SB, TELNET_OPT_COM_PORT, cmd + RFC2217_SERVER_OFFSET }) +
+            bytes(value) + bytes({ TELNET_IAC, TELNET_SE }) );
+}
+
+static std::string command(int cmd, std::initializer_list<int> value)
+{
+    return( bytes({ TELNET_IAC, TELNET_SB, TELNET_OPT_COM_PORT, cmd }) +
+            bytes(value) + bytes({ TELNET_IAC, TELNET_SE }) );
+}
+
+static void connect(int idx)
+{
+    sonClientSlot *slot = &sonClients[idx];
+
+    slot->used = true;
+    slot->client = WiFiClient();
+    slot->head = slot->len = slot->ctrlLen = 0;
+    slot->dropped = 0;
+    slot->tnIacPending = false;
+    slot->telnet = SON_TELNET_UNKNOWN;
+    slot->tnState = TN_DATA;
+    slot->tnAgreed = 0;
+    slot->tnSuspended = false;
+    slot->tnSbLen = 0;
+    sonNumClients++;
+
+    if( sonWriter < 0 )
+    {
+        sonWriter = idx;
+    }
+}
+
+//
+// send data from a client to the server, byteWise feeds one byte
+// per call. Returns what the server sent back.
+//
+static std::string talk(int idx, const std::string &data, bool byteWise = false)
+{
+    sonClientSlot *slot = &sonClients[idx];
+
+    slot->client.tx.clear();
+
+    if( byteWise )
+    {
+        for( char c : data )
+        {
+            slot->client.rx += c;
+            sonClientInput(idx);
+        }
+    }
+    else
+    {
+        slot->client.rx += data;
+        sonClientInput(idx);
+    }
+
+    slot->client.room = 4096;
+    sonFlushQueue(slot);
+
+    return( slot->client.tx );
+}
+
+static void testNegotiation()
+{
+    // what pyserial's rfc2217 client sends first
+    std::string in = bytes({ TELNET_IAC, TELNET_WILL, TELNET_OPT_BINARY,
+                             TELNET_IAC, TELNET_DO, TELNET_OPT_BINARY,
+                             TELNET_IAC, TELNET_WILL, TELNET_OPT_SGA,
+                             TELNET_IAC, TELNET_DO, TELNET_OPT_SGA,
+                             TELNET_IAC, TELNET_WILL, TELNET_OPT_COM_PORT,
+                             TELNET_IAC, TELNET_DO, 1 });           // ECHO
+    std::string out = bytes({ TELNET_IAC, TELNET_DO, TELNET_OPT_BINARY,
+                              TELNET_IAC, TELNET_WILL, TELNET_OPT_BINARY,
+                              TELNET_IAC, TELNET_DO, TELNET_OPT_SGA,
+                              TELNET_IAC, TELNET_WILL, TELNET_OPT_SGA,
+                              TELNET_IAC, TELNET_DO, TELNET_OPT_COM_PORT,
+                              TELNET_IAC, TELNET_WONT, 1 });
+
+    expect("negotiation", talk(0, in), out);
+    expectTrue("Telnet client detected", sonClients[0].telnet == SON_TELNET_ON);
+
+    // agreed options are not confirmed again
+    expect("no negotiation loop", talk(0, bytes({ TELNET_IAC, TELNET_WILL, TELNET_OPT_BINARY })), "");
+}
+
+static void testLineSettings()
+{
+    lineChanges = 0;
+
+    expect("SET-BAUDRATE 115200",
+           talk(0, command(RFC2217_SET_BAUDRATE, { 0x00, 0x01, 0xc2, 0x00 })),
+           reply(RFC2217_SET_BAUDRATE, { 0x00, 0x01, 0xc2, 0x00 }));
+    expectTrue("baud rate set", comLine.baud == 115200);
+
+    expect("SET-DATASIZE 7", talk(0, command(RFC2217_SET_DATASIZE, { 7 })),
+           reply(RFC2217_SET_DATASIZE, { 7 }));
+    expect("SET-PARITY EVEN", talk(0, command(RFC2217_SET_PARITY, { RFC2217_PARITY_EVEN })),
+           reply(RFC2217_SET_PARITY, { RFC2217_PARITY_EVEN }));
+    expect("SET-STOPSIZE 2", talk(0, command(RFC2217_SET_STOPSIZE, { 2 })),
+           reply(RFC2217_SET_STOPSIZE, { 2 }));
+    expectTrue("7E2 set", comLine.dataBits == COM_DATABITS_7 &&
+                          comLine.parity == COM_PARITY_EVEN &&
+                          comLine.stopBits == COM_STOPBITS_2);
+    expectTrue("each change applied", lineChanges == 4);
+
+    // queries and invalid values answer with the current setting
+    expect("SET-BAUDRATE query", talk(0, command(RFC2217_SET_BAUDRATE, { 0, 0, 0, 0 })),
+           reply(RFC2217_SET_BAUDRATE, { 0x00, 0x01, 0xc2, 0x00 }));
+    expect("SET-DATASIZE 5", talk(0, command(RFC2217_SET_DATASIZE, { 5 })),
+           reply(RFC2217_SET_DATASIZE, { 7 }));
+    expect("SET-PARITY MARK", talk(0, command(RFC2217_SET_PARITY, { 4 })),
+           reply(RFC2217_SET_PARITY, { RFC2217_PARITY_EVEN }));
+    expect("SET-STOPSIZE 1.5", talk(0, command(RFC2217_SET_STOPSIZE, { 3 })),
+           reply(RFC2217_SET_STOPSIZE, { 2 }));
+    expectTrue("queries change nothing", lineChanges == 4);
+
+    // 0xff in the value is sent as IAC IAC, in both directions
+    expect("SET-BAUDRATE 115455",
+           talk(0, command(RFC2217_SET_BAUDRATE, { 0x00, 0x01, 0xc2, TELNET_IAC, TELNET_IAC })),
+           reply(RFC2217_SET_BAUDRATE, { 0x00, 0x01, 0xc2, TELNET_IAC, TELNET_IAC }));
+    expectTrue("baud rate with 0xff", comLine.baud == 115455);
+
+    // split over several reads
+    expect("SET-BAUDRATE 9600 byte by byte",
+           talk(0, command(RFC2217_SET_BAUDRATE, { 0x00, 0x00, 0x25, 0x80 }), true),
+           reply(RFC2217_SET_BAUDRATE, { 0x00, 0x00, 0x25, 0x80 }));
+    expectTrue("baud rate 9600", comLine.baud == 9600);
+}
+
+static void testControl()
+{
+    useFlowCtrl = false;
+
+    expect("SET-CONTROL XON/XOFF", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_XONXOFF })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_XONXOFF }));
+    expectTrue("flow control on", useFlowCtrl);
+    expect("SET-CONTROL query", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_QUERY })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_XONXOFF }));
+    expect("SET-CONTROL inbound query", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_INFLOW_QUERY })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_INFLOW_XONXOFF }));
+    expect("SET-CONTROL none", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE }));
+    expectTrue("flow control off", !useFlowCtrl);
+    expect("SET-CONTROL BREAK ON", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_BREAK_ON })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_BREAK_OFF }));
+    expect("SET-CONTROL DTR OFF", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_DTR_OFF })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_DTR_ON }));
+    expect("SIGNATURE", talk(0, command(RFC2217_SIGNATURE, {})),
+           reply(RFC2217_SIGNATURE, { 'n', 'o', 'd', 'e' }));
+}
+
+static void testData()
+{
+    Serial.tx.clear();
+
+    // the writer's data reaches the UART with IAC IAC as 0xff
+    talk(0, bytes({ 'A', TELNET_IAC, TELNET_IAC, 'B' }) +
+            command(RFC2217_SET_DATASIZE, { 8 }) + "C");
+    expect("writer data", Serial.tx, bytes({ 'A', TELNET_IAC, 'B', 'C' }));
+}
+
+static void testMonitor()
+{
+    comLineSettings before = comLine;
+
+    connect(1);
+    Serial.tx.clear();
+    lineChanges = 0;
+
+    expect("monitor SET-BAUDRATE",
+           talk(1, command(RFC2217_SET_BAUDRATE, { 0x00, 0x00, 0x4b, 0x00 }) + "x"),
+           reply(RFC2217_SET_BAUDRATE, { 0x00, 0x00, 0x25, 0x80 }));
+    expectTrue("monitor changes nothing", lineChanges == 0 && comLine.baud == before.baud);
+    expect("monitor data discarded", Serial.tx, "");
+}
+
+//
+// decode what a Telnet client receives. Returns false on a broken
+// sequence, answers are counted.
+//
+static bool decode(const std::string &stream, std::string *data, int *answers)
+{
+    size_t i = 0;
+    unsigned char c;
+
+    *answers = 0;
+
+    while( i < stream.size() )
+    {
+        c = stream[i++];
+
+        if( c != TELNET_IAC )
+        {
+            *data += c;
+            continue;
+        }
+
+        if( i >= stream.size() )
+        {
+            return( false );
+        }
+
+        c = stream[i++];
+
+        if( c == TELNET_IAC )
+        {
+            *data += c;
+        }
+        else if( c == TELNET_SB )
+        {
+            while( i + 1 < stream.size() &&
+                   !((unsigned char) stream[i] == TELNET_IAC && (unsigned char) stream[i + 1] == TELNET_SE) )
+            {
+                i += (unsigned char) stream[i] == TELNET_IAC ? 2 : 1;
+            }
+
+            if( i + 1 >= stream.size() )
+            {
+                return( false );
+            }
+
+            i += 2;
+            (*answers)++;
+        }
+        else if( c >= TELNET_WILL )
+        {
+            i++;
+            (*answers)++;
+        }
+        else
+        {
+            return( false );
+        }
+    }
+
+    return( true );
+}
+
+static void testQueue()
+{
+    sonClientSlot *slot = &sonClients[1];
+    std::string sent, data, expected;
+    int answers;
+    bool ok = true;
+
+    // UART output full of 0xff overruns the queue of the slow monitor,
+    // answers are queued in between
+    srand(2016);
+    slot->client.room = 0;
+    slot->client.tx.clear();
+
+    for( int i = 0; i < 40; i++ )
+    {
+        data.clear();
+        for( int j = 0; j < 100; j++ )
+        {
+            data += (char) (rand() % 3 == 0 ? TELNET_IAC : 'a' + rand() % 26);
+        }
+        sent += data;
+        sonQueueData(slot, (const uint8_t *) data.data(), data.size());
+
+        if( i % 10 == 5 )
+        {
+            slot->client.rx += command(RFC2217_SET_PARITY, { 0 });
+            sonClientInput(1);
+        }
+
+        // the client takes a few bytes now and then
+        slot->client.room = rand() % 8;
+        sonFlushQueue(slot);
+        slot->client.room = 0;
+    }
+
+    while( slot->len > 0 || slot->ctrlLen > 0 || slot->tnIacPending )
+    {
+        slot->client.room = rand() % 8;
+        sonFlushQueue(slot);
+    }
+
+    data.clear();
+    ok = decode(slot->client.tx, &data, &answers);
+    expectTrue("Telnet stream of the slow client intact", ok);
+    expectTrue("all answers complete", answers == 4);
+    expectTrue("data is the input without the dropped bytes",
+               data.size() + slot->dropped == sent.size());
+
+    // what is left after dropping is a sequence of tails of the input
+    expectTrue("data not corrupted", data.size() >= sizeof(slot->queue) &&
+               data.substr(data.size() - sizeof(slot->queue)) ==
+               sent.substr(sent.size() - sizeof(slot->queue)));
+
+    // a single byte at a time splits IAC IAC
+    slot->client.tx.clear();
+    sonQueueData(slot, (const uint8_t *) "\xff\xff", 2);
+    for( int i = 0; i < 10; i++ )
+    {
+        slot->client.room = 1;
+        sonFlushQueue(slot);
+    }
+    expect("IAC IAC one byte at a time", slot->client.tx,
+           bytes({ TELNET_IAC, TELNET_IAC, TELNET_IAC, TELNET_IAC }));
+}
+
+static void testPaused()
+{
+    std::string data(300, 'q');
+
+    // the writer has agreed to COM-PORT-OPTION in testNegotiation()
+    useFlowCtrl = true;
+    sonUartTxPaused = true;
+    Serial.tx.clear();
+
+    expect("commands answered while stopped",
+           talk(0, "abc" + command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_QUERY })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_XONXOFF }) +
+           reply(RFC2217_FLOWCONTROL_SUSPEND, {}));
+    expect("data held back", Serial.tx, "");
+    expectTrue("held data", sonHoldLen == 3);
+
+    sonUartTxPaused = false;
+    expect("resumed", talk(0, "d"), reply(RFC2217_FLOWCONTROL_RESUME, {}));
+    expect("held data sent first", Serial.tx, "abcd");
+
+    // PURGE-DATA TX drops what is held
+    sonUartTxPaused = true;
+    Serial.tx.clear();
+    talk(0, "xyz");
+    expect("PURGE-DATA TX", talk(0, command(RFC2217_PURGE_DATA, { RFC2217_PURGE_TX })),
+           reply(RFC2217_PURGE_DATA, { RFC2217_PURGE_TX }));
+    expectTrue("hold purged", sonHoldLen == 0);
+
+    // a writer that does not suspend loses what does not fit
+    sonHoldDropped = 0;
+    talk(0, data);
+    expectTrue("hold full", sonHoldLen == sizeof(sonHold) &&
+                            sonHoldDropped == data.size() - sizeof(sonHold));
+
+    // no flow control any more, a XOFF received before must not block
+    expect("SET-CONTROL none while stopped",
+           talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE }));
+    expectTrue("XOFF forgotten", !sonUartTxPaused);
+    expect("resumed after SET-CONTROL", talk(0, ""), reply(RFC2217_FLOWCONTROL_RESUME, {}));
+    expect("held data sent", Serial.tx, data.substr(0, sizeof(sonHold)));
+
+    // RTS/CTS
+    Serial.tx.clear();
+    expect("SET-CONTROL hardware", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_HARDWARE })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_HARDWARE }));
+    expectTrue("RTS/CTS on", useHwFlowCtrl && !useFlowCtrl);
+    expect("SET-CONTROL inbound hardware", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_INFLOW_QUERY })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_INFLOW_HARDWARE }));
+
+    digitalWrite(SON_CTS_PIN, HIGH);
+    expect("CTS stops the writer",
+           talk(0, "e" + command(RFC2217_SET_DATASIZE, { 0 })),
+           reply(RFC2217_SET_DATASIZE, { 8 }) + reply(RFC2217_FLOWCONTROL_SUSPEND, {}));
+    expect("no data while CTS is high", Serial.tx, "");
+
+    digitalWrite(SON_CTS_PIN, LOW);
+    expect("CTS low again", talk(0, "f"), reply(RFC2217_FLOWCONTROL_RESUME, {}));
+    expect("data after CTS", Serial.tx, "ef");
+
+    // the software UART on GPIO 13 leaves no CTS pin
+    useHardSerial = false;
+    sonSoftRxPin = SON_CTS_PIN;
+    expect("SET-CONTROL hardware refused", talk(0, command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE }) +
+                                              command(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_HARDWARE })),
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE }) +
+           reply(RFC2217_SET_CONTROL, { RFC2217_CONTROL_FLOW_NONE }));
+    useHardSerial = true;
+    sonSoftRxPin = -1;
+}
+
+static void testSoftLatency()
+{
+    comLineSettings line = { 115200, COM_DATABITS_8, COM_PARITY_NONE, COM_STOPBITS_1 };
+
+    ESP.cpuMHz = 80;
+    sonSoftLatencyCycles = 0;
+    expectTrue("115200 refused with the estimate", !comSoftSerialCapable(&line));
+    sonSoftLatencyCycles = 100;
+    expectTrue("115200 taken with a measured latency", comSoftSerialCapable(&line));
+    sonSoftLatencyCycles = 600;
+    expectTrue("115200 refused with a long latency", !comSoftSerialCapable(&line));
+    sonSoftLatencyCycles = 0;
+}
+
+static void testPurge()
+{
+    // UART data queued for the writer and the monitor
+    sonQueueData(&sonClients[0], (const uint8_t *) "uart", 4);
+    sonQueueData(&sonClients[1], (const uint8_t *) "uart", 4);
+    Serial.rx = "more";
+
+    expect("PURGE-DATA RX", talk(0, command(RFC2217_PURGE_DATA, { RFC2217_PURGE_RX })),
+           reply(RFC2217_PURGE_DATA, { RFC2217_PURGE_RX }));
+    expectTrue("writer queue purged", sonClients[0].len == 0);
+    expectTrue("monitor queue purged", sonClients[1].len == 0);
+    expectTrue("UART purged", Serial.available() == 0);
+}
+
+int main()
+{
+    nodeName = "node";
+    beQuiet = true;
+    useHardSerial = true;
+
+    connect(0);
+    testNegotiation();
+    testLineSettings();
+    testControl();
+    testData();
+    testMonitor();
+    testQueue();
+    testPaused();
+    testPurge();
+    testSoftLatency();
+
+    printf("%d of %d checks failed\n", fails, total);
+
+    return( fails != 0 );
+}
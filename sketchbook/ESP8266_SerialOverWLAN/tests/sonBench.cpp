@@ -0,0 +1,249 @@
+//
+// ************************************************************************
+// SerialOverWLAN - throughput of the network -> UART path
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Compares sonNetToUart() of the sketch, which copies blocks as far
+//   as the UART has room, with the per-byte copy it replaced:
+//
+//     while( client.available() ) Serial.write(client.read());
+//
+//   The UART is a stub with a TX FIFO of BENCH_FIFO bytes that empties
+//   at baud / 10 bytes per second (8N1), like the one of the ESP8266.
+//   As HardwareSerial::write() does, the per-byte copy waits for room
+//   in the FIFO. The network delivers TCP segments of BENCH_SEGMENT
+//   bytes as fast as the path takes them.
+//
+//   Printed are the time per byte of the copy itself (FIFO unbounded)
+//   and, at 115200 and 921600 baud, the bytes per second that reach the
+//   UART and the longest time a single call kept loop() from doing
+//   anything else. Each is the best of BENCH_ROUNDS rounds. The host
+//   is much faster than an ESP8266, the numbers compare the two paths,
+//   they are not the times on the device.
+//
+//   The functions are taken from the sketch by extract.py, see the
+//   Makefile. Build and run on a Linux host with "make bench".
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2017/01/01: initial version
+//
+//
+// ************************************************************************
+//
+
+#include <stdio.h>
+#include "sonStubs.h"
+
+#include "sonBench.inc"
+
+#define BENCH_SEGMENT       1460      // bytes of a TCP segment
+#define BENCH_SEGMENTS         4      // per baud rate and round
+#define BENCH_COPY_SEGMENTS 2000      // for the time per byte
+#define BENCH_FIFO           128      // TX FIFO of the UART
+#define BENCH_ROUNDS           5
+
+struct benchResult {
+    double bytesPerSec;
+    double maxCallMicros;             // longest single call
+    unsigned long calls;
+};
+
+static unsigned long uartBaud;        // 0: the FIFO never fills
+static double uartLast;               // time the FIFO was emptied last
+static double uartCredit;             // bytes sent, not yet taken out
+
+static std::string segment(BENCH_SEGMENT, 'x');
+
+static double now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return( ts.tv_sec + ts.tv_nsec * 1e-9 );
+}
+
+//
+// take out of the FIFO what the UART has sent since the last call
+//
+static void uartDrain()
+{
+    double t = now();
+    size_t sent;
+
+    if( uartBaud == 0 )
+    {
+        Serial.room = BENCH_SEGMENT * BENCH_COPY_SEGMENTS;
+        return;
+    }
+
+    uartCredit += (t - uartLast) * uartBaud / 10;
+    uartLast = t;
+
+    if( uartCredit >= 1 )
+    {
+        sent = (size_t) uartCredit;
+        uartCredit -= sent;
+
+        if( (Serial.room += sent) >= BENCH_FIFO )
+        {
+            // an empty FIFO sends nothing
+            Serial.room = BENCH_FIFO;
+            uartCredit = 0;
+        }
+    }
+}
+
+//
+// the copy sonNetToUart() replaced
+//
+static void perByteNetToUart(WiFiClient &client)
+{
+    while( client.available() )
+    {
+        // HardwareSerial::write() waits for room in the FIFO
+        while( Serial.availableForWrite() == 0 )
+        {
+            uartDrain();
+        }
+
+        Serial.write(client.read());
+    }
+}
+
+//
+// feed segments segments to the path like loop() does
+//
+static void run(bool perByte, unsigned long baud, int segments, benchResult *result)
+{
+    WiFiClient client;
+    size_t total = (size_t) segments * BENCH_SEGMENT;
+    size_t fed = 0, written = 0;
+    double start, call;
+
+    uartBaud = baud;
+    uartLast = now();
+    uartCredit = 0;
+    Serial.room = BENCH_FIFO;
+    Serial.tx.clear();
+
+    result->maxCallMicros = 0;
+    result->calls = 0;
+
+    start = now();
+
+    while( written < total )
+    {
+        if( client.available() == 0 && fed < total )
+        {
+            client.rx = segment;
+            fed += BENCH_SEGMENT;
+        }
+
+        uartDrain();
+
+        call = now();
+
+        if( perByte )
+        {
+            perByteNetToUart(client);
+        }
+        else
+        {
+            sonNetToUart(client);
+        }
+
+        call = (now() - call) * 1e6;
+
+        if( call > result->maxCallMicros )
+        {
+            result->maxCallMicros = call;
+        }
+
+        result->calls++;
+        written += Serial.tx.size();
+        Serial.tx.clear();
+    }
+
+    // until the UART has sent the FIFO, too
+    while( uartBaud > 0 && Serial.room < BENCH_FIFO )
+    {
+        uartDrain();
+    }
+
+    result->bytesPerSec = total / (now() - start);
+}
+
+//
+// fastest of BENCH_ROUNDS rounds, a round the host was busy elsewhere
+// only takes longer
+//
+static void best(bool perByte, unsigned long baud, int segments, benchResult *result)
+{
+    benchResult round;
+
+    run(perByte, baud, segments, result);
+
+    for( int i = 1; i < BENCH_ROUNDS; i++ )
+    {
+        run(perByte, baud, segments, &round);
+
+        if( round.maxCallMicros < result->maxCallMicros )
+        {
+            result->maxCallMicros = round.maxCallMicros;
+        }
+
+        if( round.bytesPerSec > result->bytesPerSec )
+        {
+            result->bytesPerSec = round.bytesPerSec;
+            result->calls = round.calls;
+        }
+    }
+}
+
+int main()
+{
+    static const unsigned long bauds[] = { 115200, 921600 };
+    benchResult perByte, block;
+
+    useHardSerial = true;
+
+    best(true, 0, BENCH_COPY_SEGMENTS, &perByte);
+    best(false, 0, BENCH_COPY_SEGMENTS, &block);
+
+    printf("copy         per byte %8.1f ns/byte        block %8.1f ns/byte\n",
+           1e9 / perByte.bytesPerSec, 1e9 / block.bytesPerSec);
+
+    for( size_t i = 0; i < sizeof(bauds) / sizeof(bauds[0]); i++ )
+    {
+        best(true, bauds[i], BENCH_SEGMENTS, &perByte);
+        best(false, bauds[i], BENCH_SEGMENTS, &block);
+
+        printf("%6lu baud  per byte %8.0f bytes/s %8.0f us max/call %6lu calls\n",
+               bauds[i], perByte.bytesPerSec, perByte.maxCallMicros, perByte.calls);
+        printf("             block    %8.0f bytes/s %8.0f us max/call %6lu calls\n",
+               block.bytesPerSec, block.maxCallMicros, block.calls);
+    }
+
+    return( 0 );
+}
@@ -0,0 +1,126 @@
+//
+// ************************************************************************
+// stand-ins for the Arduino core used by the host tests of the sketch
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//   Only what the extracted parts of the sketch use. Clients and the
+//   UART keep their data in strings, the room for writes and the level
+//   of the pins can be set. micros() is the clock of the host.
+//
+// ************************************************************************
+//
+
+#ifndef _SON_STUBS_H_
+#define _SON_STUBS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <string>
+
+#define LOGLEVEL_QUIET     0
+#define LOGLEVEL_CRITICAL  1
+#define LOGLEVEL_ERROR     2
+#define LOGLEVEL_WARNING   4
+#define LOGLEVEL_DEBUG     8
+#define LOGLEVEL_INFO     16
+
+struct SimpleLog {
+    void Log(int level, const char *format, ...) {}
+};
+
+static SimpleLog Logger;
+
+class String {
+public:
+    std::string s;
+    String(const char *str = "") : s(str) {}
+    const char *c_str() const { return( s.c_str() ); }
+    unsigned int length() const { return( s.size() ); }
+    long toInt() const { return( atol(s.c_str()) ); }
+};
+
+// the clock of the host
+static unsigned long micros()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return( (unsigned long) ts.tv_sec * 1000000UL + ts.tv_nsec / 1000 );
+}
+
+struct EspClass {
+    uint32_t cpuMHz = 80;
+    uint32_t getCpuFreqMHz() { return( cpuMHz ); }
+};
+
+static EspClass ESP;
+
+class Stream {
+public:
+    std::string rx;               // data to be read
+    size_t rxPos = 0;             // of the next byte of rx
+    std::string tx;               // data written
+    size_t room = 4096;           // bytes write() takes
+
+    int available() { return( rx.size() - rxPos ); }
+    int peek() { return( rxPos < rx.size() ? (uint8_t) rx[rxPos] : -1 ); }
+    int read()
+    {
+        int c = peek();
+
+        if( c >= 0 )
+        {
+            consumed(1);
+        }
+        return( c );
+    }
+    int read(uint8_t *buf, size_t len)
+    {
+        len = len < rx.size() - rxPos ? len : rx.size() - rxPos;
+        memcpy(buf, rx.data() + rxPos, len);
+        consumed(len);
+        return( len );
+    }
+    // reading costs the same per byte, however long rx is
+    void consumed(size_t len)
+    {
+        if( (rxPos += len) == rx.size() )
+        {
+            rx.clear();
+            rxPos = 0;
+        }
+    }
+    int availableForWrite() { return( room ); }
+    size_t write(const uint8_t *data, size_t len)
+    {
+        len = len < room ? len : room;
+        tx.append((const char *) data, len);
+        room -= len;
+        return( len );
+    }
+    size_t write(uint8_t c) { return( write(&c, 1) ); }
+};
+
+typedef Stream WiFiClient;
+
+#define LOW                0
+#define HIGH               1
+#define INPUT              0
+#define OUTPUT             1
+#define INPUT_PULLUP       2
+
+static int pinLevel[17];
+
+static void pinMode(int pin, int mode) {}
+static void digitalWrite(int pin, int level) { pinLevel[pin] = level; }
+static int digitalRead(int pin) { return( pinLevel[pin] ); }
+
+static Stream Serial;
+
+#endif // _SON_STUBS_H_
@@ -0,0 +1,762 @@
+//
+// ************************************************************************
+// webAssets.h
+// generated by makeWebAssets.py from the page templates, do not edit
+// ************************************************************************
+//
+
+#ifndef _WEB_ASSETS_
+#define _WEB_ASSETS_
+
+#include "pageTemplate.h"
+
+enum webValueId
+{
+    WEB_VALUE_ADMIN_PASSWD,
+    WEB_VALUE_CHECKED_COM_TYPE,
+    WEB_VALUE_CHECKED_DATALEN,
+    WEB_VALUE_CHECKED_DHCP,
+    WEB_VALUE_CHECKED_FLOWCTRL,
+    WEB_VALUE_CHECKED_GPIO_RX,
+    WEB_VALUE_CHECKED_GPIO_TX,
+    WEB_VALUE_CHECKED_OPERATIONMODE,
+    WEB_VALUE_CHECKED_PARITY,
+    WEB_VALUE_CHECKED_PROTOCOL,
+    WEB_VALUE_CHECKED_SON,
+    WEB_VALUE_CHECKED_STOPBIT,
+    WEB_VALUE_CHECKED_UDP_SEQUENCE,
+    WEB_VALUE_NODENAME,
+    WEB_VALUE_NODE_INFO,
+    WEB_VALUE_PACKET_DELIMITER,
+    WEB_VALUE_PACKET_MAXBYTES,
+    WEB_VALUE_PACKET_TIMEOUT,
+    WEB_VALUE_RX_BUFSIZE,
+    WEB_VALUE_SELECTED_BAUD,
+    WEB_VALUE_SERVER_IP,
+    WEB_VALUE_SERVER_PORT,
+    WEB_VALUE_TARGET_IP,
+    WEB_VALUE_WLAN_PASSPHRASE,
+    WEB_VALUE_WLAN_SSID,
+    WEB_VALUE_COUNT
+};
+
+// arguments of the values, see pageTemplatePart.arg
+static const char webAssetArgs[] PROGMEM =
+{
+    0x4f,0x4e,0x00,0x4f,0x46,0x46,0x00,0x54,0x00,0x55,0x00,0x68,0x61,0x72,0x64,0x77,
+    0x61,0x72,0x65,0x00,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x00,0x53,0x00,0x43,
+    0x00,0x30,0x30,0x00,0x30,0x32,0x00,0x30,0x34,0x00,0x30,0x35,0x00,0x30,0x39,0x00,
+    0x31,0x30,0x00,0x31,0x32,0x00,0x31,0x33,0x00,0x31,0x34,0x00,0x31,0x35,0x00,0x31,
+    0x36,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x31,0x00,0x32,0x00,0x4e,0x00,0x45,0x00,
+    0x4f,0x00,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x00,0x48,0x61,0x72,0x64,0x77,
+    0x61,0x72,0x65,0x00,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x00,0x39,0x36,0x30,
+    0x30,0x00,0x31,0x39,0x32,0x30,0x30,0x00,0x33,0x38,0x34,0x30,0x30,0x00,0x35,0x37,
+    0x36,0x30,0x30,0x00,0x37,0x34,0x38,0x38,0x30,0x00,0x31,0x31,0x35,0x32,0x30,0x30,
+    0x00,0x32,0x33,0x30,0x34,0x30,0x30,0x00,0x34,0x36,0x30,0x38,0x30,0x30,0x00,0x39,
+    0x32,0x31,0x36,0x30,0x30,0x00,
+};
+
+// index.html: 491 bytes text, 315 bytes compressed, 1 values
+static const uint8_t webAssetIndexData[] PROGMEM =
+{
+    0x6c,0x8f,0x3f,0x0f,0x82,0x30,0x10,0xc5,0x77,0x3f,0x45,0x2d,0xb3,0x29,0x18,0x07,
+    0x49,0x4a,0x17,0xfe,0xc4,0x4d,0x07,0x17,0xc7,0x02,0x27,0x10,0xa1,0x4d,0xca,0x49,
+    0xf4,0xdb,0x7b,0x45,0x98,0xb4,0xcb,0xeb,0xef,0x5e,0xdf,0x4b,0x4f,0x6e,0xb3,0x73,
+    0x7a,0xbd,0x5d,0x72,0xd6,0xe2,0xd0,0xab,0x8d,0x5c,0x05,0x74,0x4d,0x32,0x00,0x6a,
+    0x56,0xb5,0xda,0x8d,0x80,0x09,0x7f,0xe2,0x7d,0x77,0xe4,0x4c,0x90,0x81,0x1d,0xf6,
+    0xa0,0x4e,0x76,0x00,0x29,0xbe,0xf7,0x8d,0x14,0x4b,0xa8,0xb4,0xf5,0x9b,0x95,0x4d,
+    0x65,0x7b,0xeb,0x12,0x1e,0x64,0x87,0x34,0x4e,0x63,0xce,0x10,0x5e,0xd4,0x11,0x84,
+    0xf3,0xe1,0xac,0xef,0xcc,0x83,0x30,0xca,0xe3,0xb0,0x28,0x38,0x9b,0x16,0xf6,0xa6,
+    0x67,0xbd,0xf0,0x9e,0x88,0x9e,0x53,0x6d,0xdd,0x4d,0x7e,0xda,0x98,0x84,0x57,0x60,
+    0x10,0x1c,0x57,0x72,0x44,0x67,0x4d,0xa3,0x64,0x1b,0x29,0x63,0x6b,0x60,0xed,0xfc,
+    0x21,0x22,0x29,0x56,0x4b,0x50,0xce,0x2f,0xe4,0x7e,0xc2,0xa5,0xfb,0xdf,0xfa,0x01,
+    0x00,0x00,0xff,0xff,0x74,0x8e,0x4b,0x0e,0xc3,0x20,0x0c,0x44,0xf7,0x39,0x85,0xe5,
+    0x0b,0x70,0x01,0xe0,0x2e,0x26,0xd0,0x04,0x89,0x9f,0xc0,0x44,0xca,0xed,0x6b,0x9a,
+    0x4d,0xa5,0xaa,0x1b,0x8f,0x3c,0x4f,0xf6,0x8c,0x56,0x3e,0x5e,0x76,0xd3,0xae,0xcb,
+    0x78,0xd5,0x9e,0x81,0x76,0x8e,0xb5,0x18,0x54,0x08,0x39,0xf0,0x59,0xbd,0xc1,0x56,
+    0x07,0xa3,0xf0,0xb3,0x03,0xa5,0x78,0x08,0xdc,0x43,0xe1,0xd0,0xd1,0x3e,0x77,0xf2,
+    0xe2,0x07,0xc4,0xd2,0x26,0x03,0xdf,0x2d,0x18,0x1c,0xd3,0xe5,0xc8,0x08,0x85,0xb2,
+    0x6c,0xe4,0xb3,0x40,0x3a,0x02,0xc2,0x45,0x69,0x8a,0x53,0xaa,0x0f,0xf0,0xb1,0xe3,
+    0xe0,0x4e,0x2b,0x1f,0x2d,0xe8,0xef,0x6a,0xff,0xa2,0xd5,0xea,0xbc,0xd4,0x55,0x7f,
+    0x2f,0x3d,0x39,0x27,0xbb,0xbd,0x01,0x00,0x00,0xff,0xff,
+};
+
+static const pageTemplatePart webAssetIndexParts[] PROGMEM =
+{
+    {     0,   180,   276, 0xcb87c68e, 0x53a4f44a, 0xffff, WEB_VALUE_NODE_INFO },
+    {   180,   135,   215, 0x1eb39a27, 0x9c4ec763, 0xffff, PAGE_TEMPLATE_NO_VALUE },
+};
+
+static const pageTemplateAsset webAssetIndex =
+{
+    "index.html", webAssetIndexData, webAssetIndexParts, webAssetArgs,
+    2, 0x77f658eb
+};
+
+// login.html: 591 bytes text, 311 bytes compressed, 0 values
+static const uint8_t webAssetLoginData[] PROGMEM =
+{
+    0x7c,0x52,0x4d,0x4f,0xc3,0x30,0x0c,0xbd,0xf7,0x57,0x98,0xec,0x8c,0xb2,0x21,0x0e,
+    0x14,0xa5,0x91,0xa6,0x7d,0x5c,0xd9,0x81,0x0b,0xc7,0xb4,0xc9,0xda,0x68,0x69,0x52,
+    0xa5,0xee,0xc6,0xfe,0x3d,0x4e,0xbb,0x21,0x0d,0x06,0xbd,0x38,0x76,0x9c,0xf7,0x9e,
+    0x9f,0x2b,0x1e,0xd6,0x6f,0xab,0xf7,0x8f,0xdd,0x06,0x1a,0x6c,0x9d,0xcc,0xc4,0x35,
+    0x18,0xa5,0x29,0xb4,0x06,0x15,0x54,0x8d,0x8a,0xbd,0xc1,0x82,0x0d,0xb8,0x7f,0x7c,
+    0x61,0xc0,0xe9,0x02,0x2d,0x3a,0x23,0x97,0xba,0xb5,0xde,0xf6,0x18,0x15,0x86,0x28,
+    0xf8,0x54,0xcc,0x04,0xbf,0xbc,0x2e,0x83,0x3e,0x43,0x59,0x57,0xc1,0x85,0x58,0xb0,
+    0xd9,0xfa,0x79,0x95,0xaf,0x72,0x06,0x68,0x3e,0x09,0x6c,0x36,0x1f,0x3f,0x06,0xce,
+    0xfa,0x03,0xa5,0x8b,0x4d,0x3e,0xdf,0x6e,0x19,0x1c,0x2f,0x79,0xba,0x4c,0xb9,0xba,
+    0xe4,0x4f,0x94,0x51,0x3b,0xc1,0x6a,0x7b,0x4c,0xd5,0xda,0x17,0xac,0x32,0x1e,0x4d,
+    0x64,0x52,0x90,0x86,0xe0,0x6b,0x29,0x9a,0xc5,0xad,0x28,0x50,0x55,0x15,0x06,0x8f,
+    0xa4,0x69,0x21,0x05,0xbf,0xb6,0x71,0xc2,0x20,0xa4,0x7d,0x88,0x2d,0x75,0xa0,0x0d,
+    0x84,0xc5,0x5d,0xa8,0xad,0x67,0x40,0x33,0x37,0x41,0x17,0xac,0x0b,0x3d,0x26,0x3a,
+    0x54,0xa5,0x33,0x3f,0x09,0xa9,0x1c,0x65,0x06,0x20,0x50,0xcb,0x7b,0x82,0x76,0xaa,
+    0xef,0x4f,0x21,0xea,0xd7,0x89,0x8a,0xbc,0xd1,0xff,0xb5,0x0b,0xeb,0xbb,0x01,0x01,
+    0xcf,0x9d,0x29,0x58,0xf2,0x87,0x81,0x57,0x2d,0x9d,0x55,0x1a,0xa6,0x3b,0x31,0x09,
+    0x04,0x11,0x93,0xb7,0xa3,0x9c,0xb4,0xa1,0xf8,0x0b,0xa4,0x8c,0xf7,0xdd,0xc9,0x6e,
+    0xe0,0xfb,0xa1,0x6c,0xed,0x37,0x41,0x38,0x90,0xe5,0xca,0x0d,0x74,0x9c,0xe6,0x4f,
+    0x4c,0xa3,0xe4,0x11,0xed,0x2f,0x16,0x9e,0xac,0x4b,0x31,0xed,0x78,0x5c,0xf9,0xf8,
+    0xdf,0x7c,0x01,0x00,0x00,0xff,0xff,
+};
+
+static const pageTemplatePart webAssetLoginParts[] PROGMEM =
+{
+    {     0,   311,   591, 0x79d62901, 0x024ebd7f, 0xffff, PAGE_TEMPLATE_NO_VALUE },
+};
+
+static const pageTemplateAsset webAssetLogin =
+{
+    "login.html", webAssetLoginData, webAssetLoginParts, webAssetArgs,
+    1, 0x49fde67e
+};
+
+// loginfail.html: 563 bytes text, 310 bytes compressed, 0 values
+static const uint8_t webAssetLoginFailData[] PROGMEM =
+{
+    0x7c,0x92,0x3d,0x6f,0xc3,0x20,0x10,0x86,0xf7,0xfc,0x8a,0x0b,0x99,0x2b,0x9c,0xaa,
+    0x43,0xd3,0x62,0xa4,0x28,0x1f,0x6b,0x3b,0x74,0xe9,0x78,0xb6,0xb1,0x8d,0x8a,0x21,
+    0xc2,0xe7,0xa8,0xee,0xaf,0xef,0xe1,0x38,0x1d,0xfa,0xc5,0x72,0x7a,0xef,0x78,0x8f,
+    0x87,0x03,0xb5,0xdc,0x3f,0xed,0x5e,0x5e,0x9f,0x0f,0xd0,0x52,0xe7,0xf4,0x42,0x5d,
+    0x83,0xc1,0x8a,0x43,0x67,0x08,0xa1,0x6c,0x31,0xf6,0x86,0x72,0x31,0x50,0x7d,0x73,
+    0x2f,0x40,0x72,0x81,0x2c,0x39,0xa3,0xb7,0x55,0x67,0xbd,0xed,0x29,0x22,0x85,0xa8,
+    0xe4,0x25,0xb9,0x50,0x72,0x76,0x17,0xa1,0x1a,0xa1,0x68,0xca,0xe0,0x42,0xcc,0xc5,
+    0x6a,0x7f,0xb7,0xdb,0xec,0x36,0x02,0xc8,0xbc,0x73,0xb3,0x55,0x36,0x2d,0x01,0xce,
+    0xfa,0x37,0x96,0xeb,0xc3,0x26,0x3b,0x1e,0x05,0x9c,0x67,0x9d,0x8a,0x49,0xe3,0xac,
+    0x6f,0x59,0xf1,0x76,0x6e,0x5b,0xd9,0x73,0xca,0x36,0x3e,0x17,0xa5,0xf1,0x64,0xa2,
+    0xd0,0x8a,0x19,0x82,0x6f,0xb4,0x6a,0xd7,0xd0,0xd3,0xe8,0x0c,0x97,0xd2,0xa9,0x0f,
+    0xb0,0x4a,0xae,0x2c,0x7b,0x04,0xa1,0xb7,0x03,0xb5,0x21,0xda,0x0f,0x24,0x1b,0x3c,
+    0xd4,0x68,0x9d,0xa9,0x96,0x0c,0xbb,0xd6,0x4a,0x5e,0xfd,0x92,0x9b,0xf3,0x11,0x75,
+    0x88,0x1d,0x60,0x99,0x36,0xe6,0x42,0xba,0xd0,0x58,0x2f,0x80,0x87,0xd1,0x86,0x2a,
+    0x17,0xa7,0xd0,0x53,0xe2,0x20,0x2c,0x9c,0xf9,0x4e,0xc2,0xb7,0x9f,0xf2,0x69,0x86,
+    0xf1,0x07,0x66,0x11,0x7f,0xe7,0x07,0x5e,0xca,0xfa,0xd3,0x40,0x40,0xe3,0x89,0xe9,
+    0xfb,0xa1,0xe8,0x2c,0x09,0xf0,0xd8,0xb1,0xc2,0x06,0x13,0xc0,0x19,0xdd,0xc0,0x8a,
+    0xe2,0x08,0x97,0xcc,0xe4,0xfb,0xcf,0x58,0xa2,0x2f,0x8d,0xfb,0x72,0xce,0x52,0xc3,
+    0xf5,0x9e,0x13,0xcf,0x5f,0x9c,0x32,0x4d,0x21,0xc5,0xf4,0x8e,0xd3,0xb3,0x4e,0x7f,
+    0xe3,0x13,0x00,0x00,0xff,0xff,
+};
+
+static const pageTemplatePart webAssetLoginFailParts[] PROGMEM =
+{
+    {     0,   310,   563, 0x771512ed, 0x30e67aff, 0xffff, PAGE_TEMPLATE_NO_VALUE },
+};
+
+static const pageTemplateAsset webAssetLoginFail =
+{
+    "loginfail.html", webAssetLoginFailData, webAssetLoginFailParts, webAssetArgs,
+    1, 0xd0dcfcdb
+};
+
+// admin.html: 2780 bytes text, 1371 bytes compressed, 7 values
+static const uint8_t webAssetAdminData[] PROGMEM =
+{
+    0x6c,0x50,0xc1,0x6e,0xc2,0x30,0x0c,0xbd,0xf3,0x15,0x9e,0x39,0x4f,0xa5,0x68,0x42,
+    0x30,0xa5,0xb9,0x14,0x90,0x76,0x1a,0x52,0x77,0xd9,0x31,0x6d,0x42,0x1b,0x91,0x26,
+    0x55,0xe2,0xa2,0xf1,0xf7,0x73,0x47,0xb9,0x4c,0xe4,0x10,0xe7,0x3d,0x3b,0xcf,0xcf,
+    0x16,0x2f,0xfb,0xcf,0xf2,0xeb,0xfb,0x74,0x80,0x8e,0x7a,0x27,0x17,0xe2,0x11,0x8c,
+    0xd2,0x1c,0x7a,0x43,0x0a,0x9a,0x4e,0xc5,0x64,0xa8,0xc0,0x91,0xce,0xaf,0x5b,0x84,
+    0x8c,0x13,0x64,0xc9,0x19,0x79,0xa8,0x4e,0xdb,0xf5,0x66,0x03,0x95,0x21,0xb2,0xbe,
+    0x4d,0x22,0xbb,0xf3,0x0b,0x91,0xcd,0x02,0x75,0xd0,0x37,0xa8,0xdb,0x26,0xb8,0x10,
+    0x0b,0x5c,0xee,0xdf,0xca,0x5d,0xb9,0x43,0x20,0xf3,0xc3,0x7a,0xcb,0xd5,0xdf,0x41,
+    0x70,0xd6,0x5f,0x18,0xe6,0x87,0xdd,0xea,0x78,0x44,0xb8,0xce,0x78,0x4a,0x4e,0x58,
+    0xcd,0x78,0xcd,0x88,0xcb,0x59,0x56,0xdb,0xeb,0xc4,0xb6,0xbe,0xc0,0xc6,0x78,0x32,
+    0x11,0xa5,0x48,0x14,0x83,0x6f,0xa5,0xe8,0x72,0x59,0x76,0xca,0xb7,0x06,0xd2,0x6c,
+    0x0b,0xce,0x21,0x02,0x75,0x36,0x81,0x0f,0xda,0xb0,0xb7,0x5c,0x8a,0xec,0x51,0x9e,
+    0xb1,0x16,0x2b,0x72,0x49,0x0f,0xaa,0x21,0x1b,0x58,0x33,0x53,0xba,0xb7,0x1e,0x81,
+    0xc7,0xef,0x82,0x2e,0x70,0x08,0x89,0xa6,0xb6,0xa4,0x6a,0x67,0xfe,0x37,0x66,0x3a,
+    0x4e,0x97,0x96,0xf0,0xcc,0xd7,0x42,0x84,0x81,0xda,0x18,0xc6,0x01,0x9c,0xaa,0x8d,
+    0x2b,0xb0,0xaa,0x3e,0xf6,0xef,0xc8,0x3b,0x22,0x7d,0xff,0xf7,0x74,0x1c,0xeb,0x87,
+    0x91,0x80,0x6e,0x83,0x29,0x70,0x5a,0x17,0x82,0x57,0x3d,0xbf,0x53,0xb2,0x9a,0x57,
+    0xa4,0xdc,0xc8,0xe0,0x17,0x00,0x00,0xff,0xff,0x74,0x8d,0x41,0x0a,0xc3,0x30,0x0c,
+    0x04,0xef,0x7e,0x85,0xd0,0x07,0x02,0xed,0xad,0xd8,0x79,0x43,0xbf,0xa0,0x36,0xc2,
+    0x31,0x38,0x8e,0xb0,0xe5,0x90,0xfe,0x3e,0x0a,0xa5,0x87,0x1e,0x72,0x59,0x76,0x61,
+    0x76,0x17,0x61,0xa1,0x3d,0x73,0x89,0x3a,0x87,0xfb,0x0d,0x46,0x3f,0x4c,0x69,0x33,
+    0xd5,0x69,0x74,0xde,0xc4,0x5b,0x04,0xca,0x29,0x96,0x80,0x6f,0x2e,0xca,0x15,0xff,
+    0x99,0x61,0x15,0x8d,0x75,0xed,0x72,0x7a,0xad,0x67,0xab,0x5e,0x57,0x9d,0xff,0xe1,
+    0x90,0xe9,0xc5,0x39,0xe0,0x93,0x5a,0x93,0xb9,0x52,0xe3,0x07,0xba,0xef,0x26,0xc0,
+    0xe5,0x73,0x2a,0xd2,0x15,0xf4,0x23,0x1c,0x50,0x79,0x57,0x84,0x42,0x8b,0x79,0xb1,
+    0x15,0x84,0x8d,0x72,0xb7,0x70,0x00,0x00,0x00,0xff,0xff,0xa4,0x4f,0xc1,0x0a,0xc2,
+    0x30,0x0c,0xbd,0xef,0x2b,0x42,0x7e,0x60,0x08,0xe2,0xa9,0xdb,0xdd,0x9b,0xf8,0x07,
+    0xb1,0x0d,0x6b,0xb1,0xeb,0x4a,0x97,0x96,0xf9,0xf7,0x76,0x03,0xc1,0xa1,0x9e,0xbc,
+    0x3c,0xf2,0x92,0xbc,0xbc,0x17,0x84,0x91,0x16,0xcf,0x61,0x10,0xdb,0x9d,0x8e,0xd0,
+    0xab,0xd6,0xb8,0x52,0x51,0x4c,0xdf,0xa8,0x0a,0xaa,0x52,0x20,0xef,0x86,0xd0,0xa1,
+    0xe6,0x20,0x9c,0x70,0xbf,0xd3,0x4e,0x51,0x86,0x34,0xe5,0xb8,0xd6,0x92,0x56,0x55,
+    0x05,0x80,0x4d,0x6c,0xd3,0xa7,0x76,0x55,0xfd,0x37,0x7e,0xf3,0xf9,0x15,0xb1,0x51,
+    0xaf,0x58,0xe0,0xe9,0xc6,0xbe,0xc3,0x2b,0x6b,0x76,0x85,0xe1,0x7c,0x01,0x32,0x26,
+    0xf1,0x3c,0x43,0x71,0x04,0xc6,0xea,0x88,0xcd,0xce,0xf6,0xdb,0xc7,0x2e,0xc4,0x2c,
+    0x20,0x8f,0xc8,0xb5,0x69,0x59,0xdf,0x6f,0xd3,0x82,0x10,0x68,0xac,0x3c,0xcf,0xbc,
+    0x5d,0x81,0x42,0x3e,0x57,0x7e,0x40,0x78,0x02,0x00,0x00,0xff,0xff,0xa4,0x4f,0x31,
+    0x0a,0xc3,0x30,0x0c,0xdc,0xfb,0x0a,0xa1,0x0f,0x78,0x2f,0xb6,0xf7,0x6c,0x85,0xbe,
+    0xc0,0x6d,0x44,0x6a,0x70,0x1d,0xa3,0xca,0xa6,0xfd,0x7d,0xe4,0x40,0x87,0x90,0x6c,
+    0x59,0x8e,0x93,0x4e,0x27,0x9d,0xbc,0x35,0x63,0x6c,0xde,0x1a,0x19,0xfd,0xc5,0x2a,
+    0x58,0x2d,0x21,0xa4,0x38,0x65,0x87,0x4f,0xca,0x42,0x8c,0x7e,0x33,0x63,0xe6,0x22,
+    0x13,0xcf,0xb5,0x74,0x2e,0xdc,0x5d,0x0a,0x00,0xab,0xf9,0xc5,0x7b,0x6f,0x77,0x9d,
+    0x93,0x77,0x77,0xe0,0x28,0xa5,0x6a,0xaa,0xfe,0xd3,0x41,0x0a,0x0f,0x4a,0x0e,0xef,
+    0xc4,0x8d,0x18,0x86,0xdb,0x15,0x61,0x73,0xec,0xe8,0xcf,0x98,0x4b,0x15,0x90,0x5f,
+    0x21,0x87,0x42,0x5f,0x41,0xc8,0xe1,0xad,0xfc,0xb3,0x2e,0x89,0x05,0xa1,0x85,0x54,
+    0xb5,0xb1,0x00,0x00,0x00,0xff,0xff,0x9c,0x4f,0x3b,0x0e,0xc3,0x30,0x08,0xdd,0x7d,
+    0x0a,0xc4,0x05,0xac,0x2e,0x1d,0x2a,0xdb,0xd7,0xc8,0xec,0x36,0x28,0x89,0xe4,0x38,
+    0x16,0x21,0x56,0x7a,0xfb,0x10,0x55,0xfd,0xa9,0xed,0xd2,0xe5,0x01,0x0f,0xde,0x03,
+    0x10,0xc6,0xb8,0x26,0xca,0x9d,0xf4,0x1e,0x0f,0x47,0x0c,0x00,0xe0,0xac,0xb4,0xc1,
+    0x68,0xd4,0x00,0xae,0x1d,0x2a,0xc4,0x34,0x74,0xd9,0xe3,0x85,0xb2,0x10,0x63,0x70,
+    0x56,0xc9,0xf0,0x18,0xb3,0x53,0x91,0x8e,0xa7,0xa5,0x04,0xa3,0x1c,0x2b,0xee,0x70,
+    0xd3,0xbb,0x9e,0x3f,0xd5,0x4f,0xfb,0x7f,0xdb,0x2f,0x7b,0x7e,0x5e,0x69,0xdc,0xfd,
+    0x2e,0x48,0xf1,0x4c,0xc9,0x63,0xd3,0x34,0x30,0x13,0x57,0x62,0x28,0x13,0xcb,0x09,
+    0xcd,0xdb,0xb2,0x6f,0x9f,0x0e,0xb9,0x2c,0x02,0x72,0x2d,0xe4,0x51,0x68,0x15,0x84,
+    0x1c,0x47,0xcd,0x67,0xae,0xbb,0x05,0x42,0x8d,0x69,0xd1,0x7a,0x03,0x00,0x00,0xff,
+    0xff,0xa4,0x90,0xc1,0x0a,0xc3,0x20,0x0c,0x86,0xef,0x3e,0x45,0xc8,0x0b,0xf4,0xd2,
+    0xd3,0xd0,0x3e,0xc2,0xde,0xc1,0xcd,0x60,0x05,0xab,0xe2,0x62,0xe9,0xf6,0xf4,0x8b,
+    0x85,0xc1,0xca,0x7a,0xdb,0xe5,0x27,0x21,0xf9,0xf2,0x27,0x41,0x78,0x84,0x17,0x19,
+    0x1c,0x11,0x16,0xbb,0x45,0x4a,0x9e,0x67,0x33,0xc2,0xa4,0x07,0x17,0x56,0x51,0x76,
+    0x93,0xd2,0x22,0x5a,0x52,0xb0,0x31,0xf8,0x64,0xf0,0x4e,0x89,0xa9,0xe2,0xb1,0x67,
+    0xc8,0x85,0x7d,0xcd,0xad,0xf4,0x98,0x6b,0xa7,0x44,0x00,0x76,0x78,0xae,0xbf,0x6c,
+    0xa7,0xfe,0x2b,0x7f,0xf9,0xf4,0x3e,0x38,0xdb,0x51,0xe9,0xcf,0x5e,0x10,0xed,0x8d,
+    0xa2,0xc1,0x6b,0x76,0x04,0xc9,0x2e,0x74,0x41,0x75,0xb0,0x39,0xbb,0x30,0xa4,0xd2,
+    0x18,0xf8,0x59,0xe4,0x45,0x4c,0x1b,0xe3,0x4e,0x1a,0x4c,0x32,0x04,0x61,0xb5,0xb1,
+    0x49,0xf2,0x06,0x00,0x00,0xff,0xff,0x74,0x8d,0x4b,0x0a,0x02,0x31,0x10,0x44,0xf7,
+    0x39,0x45,0xd3,0x17,0x18,0xd0,0x9d,0x24,0x03,0x1e,0xa5,0x35,0x4d,0x0c,0xe4,0x47,
+    0xa6,0x33,0x9f,0xdb,0x9b,0x30,0xb8,0x10,0x74,0x53,0x54,0x41,0xbd,0x2a,0x84,0x48,
+    0x7b,0xe0,0xe4,0xe4,0x65,0xae,0x17,0x98,0xf5,0x64,0xfd,0xda,0x55,0xec,0xac,0x74,
+    0x17,0xdd,0x23,0x50,0xf0,0x2e,0x19,0x7c,0x72,0x12,0xae,0xf8,0xdd,0x99,0x72,0x11,
+    0x57,0x73,0x2b,0xc3,0x4b,0x1d,0x54,0x3d,0x51,0xf8,0xc5,0x2a,0xfd,0xe9,0x43,0xa0,
+    0x07,0x07,0x83,0x77,0x1b,0x7d,0x82,0x42,0xcb,0xb2,0xe5,0x6a,0x6f,0xa8,0xce,0x61,
+    0x80,0xbf,0xf7,0x3e,0x95,0x26,0x20,0x47,0x61,0x83,0xc2,0xbb,0x20,0x24,0x8a,0xdd,
+    0xd3,0x58,0x2a,0x1b,0xc2,0x4a,0xa1,0xf5,0xfc,0x06,0x00,0x00,0xff,0xff,0x9c,0x91,
+    0x41,0x6e,0xc4,0x20,0x0c,0x45,0xf7,0x39,0x85,0xc5,0x05,0x22,0xb5,0x5b,0x92,0x4d,
+    0xd7,0x55,0xcf,0x40,0x12,0x26,0x41,0x05,0x8c,0x8c,0x19,0x35,0xb7,0xaf,0x49,0x46,
+    0x19,0x45,0xad,0xa2,0xaa,0x0b,0x8c,0xbf,0xcc,0xb3,0xbf,0x8c,0x82,0x60,0xbe,0xbc,
+    0x8d,0x33,0x2f,0xdd,0xeb,0x0b,0xf4,0xba,0x9d,0xdc,0x5d,0x22,0x4f,0x7d,0xa3,0x25,
+    0x68,0x91,0x60,0xbc,0x9b,0x63,0xa7,0x46,0x1b,0xd9,0x92,0x3a,0xbf,0x69,0x31,0xf1,
+    0x4c,0x58,0x52,0xcd,0x99,0x2a,0x45,0x3b,0x0a,0x7a,0xa1,0x9f,0xe8,0xd1,0xf8,0x7f,
+    0xc5,0x7d,0x44,0xcb,0x66,0xf0,0x56,0x92,0x5f,0xdc,0x35,0xda,0xc5,0x54,0x18,0x78,
+    0x4d,0xb6,0x53,0xb9,0x0c,0xc1,0xb1,0x82,0x68,0x82,0x28,0xca,0x92,0xde,0x8d,0x2f,
+    0x35,0xb7,0xd9,0x32,0xdc,0x90,0xc2,0x35,0x83,0x9f,0x07,0x32,0x62,0x90,0x02,0x08,
+    0xc7,0x2e,0xce,0xf9,0x9a,0xbb,0x99,0x91,0x91,0xd6,0x03,0x7e,0xe8,0x13,0x3d,0x50,
+    0x5f,0xcf,0x55,0x9b,0xd1,0x63,0xb6,0x4f,0x07,0x9b,0xba,0x06,0x30,0xc8,0x88,0x92,
+    0x0e,0xe6,0xed,0xe3,0x1d,0x12,0xd2,0x5f,0x7d,0xcb,0x5e,0xd8,0xd0,0x69,0x4f,0x55,
+    0x43,0xc4,0x69,0x9b,0xbc,0x7f,0xfe,0xe6,0xba,0xad,0xdb,0xab,0xf7,0x80,0xd3,0x5a,
+    0xef,0x85,0x83,0xef,0x9b,0x6f,0x00,0x00,0x00,0xff,0xff,
+};
+
+static const pageTemplatePart webAssetAdminParts[] PROGMEM =
+{
+    {     0,   281,   447, 0x9944e745, 0x2ff295f8, 0xffff, WEB_VALUE_WLAN_SSID },
+    {   281,   130,   212, 0x295767a3, 0xd9ad6d87, 0xffff, WEB_VALUE_WLAN_PASSPHRASE },
+    {   411,   162,   342, 0xe29a6347, 0x00ac6a52, 0xffff, WEB_VALUE_CHECKED_DHCP },
+    {   573,   138,   311, 0x9550c6b8, 0x9cb9c19f, 0xffff, WEB_VALUE_SERVER_IP },
+    {   711,   154,   328, 0x956dfadb, 0x8cd2ef79, 0xffff, WEB_VALUE_SERVER_PORT },
+    {   865,   150,   324, 0x047242ca, 0x074deae6, 0xffff, WEB_VALUE_NODENAME },
+    {  1015,   135,   220, 0x34247f27, 0x92f8befe, 0xffff, WEB_VALUE_ADMIN_PASSWD },
+    {  1150,   221,   596, 0xa2ed1442, 0xdca82311, 0xffff, PAGE_TEMPLATE_NO_VALUE },
+};
+
+static const pageTemplateAsset webAssetAdmin =
+{
+    "admin.html", webAssetAdminData, webAssetAdminParts, webAssetArgs,
+    8, 0xdd0a8b82
+};
+
+// comsettings.html: 11365 bytes text, 6591 bytes compressed, 57 values
+static const uint8_t webAssetComSettingsData[] PROGMEM =
+{
+    0xdc,0x51,0xb1,0x6e,0x83,0x30,0x10,0xdd,0xf9,0x8a,0x8b,0x33,0x23,0x92,0xaa,0x43,
+    0x23,0x19,0x2f,0x24,0xd9,0x1a,0x2a,0xd1,0xa5,0xa3,0x01,0x07,0xac,0x18,0x1b,0x99,
+    0x83,0x36,0x7f,0xdf,0x73,0x02,0x1d,0xaa,0x56,0xdd,0xeb,0xc1,0xd6,0xbb,0x7b,0xf7,
+    0xee,0xf9,0x8e,0xaf,0xf6,0x79,0xf6,0xfa,0xf6,0x72,0x80,0x16,0x3b,0x23,0x22,0xbe,
+    0x3c,0x4a,0xd6,0xf4,0x74,0x0a,0x25,0x54,0xad,0xf4,0x83,0xc2,0x94,0x8d,0x78,0x8e,
+    0x9f,0x18,0x24,0x94,0x40,0x8d,0x46,0x89,0x2c,0x7f,0x86,0x42,0xe1,0xd8,0xf3,0xe4,
+    0x1e,0x88,0x78,0x32,0x57,0x96,0xae,0xbe,0x42,0xd9,0x54,0xce,0x38,0x9f,0xb2,0xf5,
+    0xfe,0x31,0xdb,0x65,0x3b,0x06,0xa8,0x3e,0x48,0x68,0xbd,0xb9,0x1d,0x66,0xb4,0xbd,
+    0x10,0xda,0x1e,0x76,0x9b,0xe3,0x91,0xc1,0x34,0xe3,0x90,0x0b,0x58,0xce,0xf8,0x81,
+    0x10,0xb1,0x49,0xb5,0xd6,0x53,0x88,0x36,0x36,0x65,0x95,0xb2,0xa8,0x3c,0x13,0x7c,
+    0x40,0xef,0x6c,0x23,0x78,0xbb,0x15,0x59,0x2b,0x6d,0xa3,0xc0,0xb8,0x4a,0x1a,0x08,
+    0xe6,0x7a,0xe7,0x11,0xc8,0x3b,0x6a,0xdb,0x0c,0xe4,0x6d,0x2b,0x78,0xb2,0xf0,0x13,
+    0x12,0x23,0xc9,0xb3,0xf3,0x1d,0xc8,0x0a,0xb5,0x23,0xd1,0xa4,0x72,0xdd,0x42,0x67,
+    0x40,0xbf,0x6f,0x5d,0x9d,0xb2,0xde,0x0d,0x18,0xba,0xa3,0x2c,0x8d,0xfa,0xde,0x3f,
+    0xe2,0xab,0x38,0x86,0xbd,0x32,0xba,0xd3,0x14,0x80,0x38,0x0e,0x4c,0x2f,0x22,0xa0,
+    0xc3,0xb1,0x16,0xf0,0x93,0x6b,0xe0,0xed,0x42,0xb9,0xf9,0xa0,0x01,0xd6,0xff,0xab,
+    0x84,0x6e,0xff,0x35,0x89,0x5f,0x6b,0xef,0x65,0xae,0xc7,0xc6,0xbb,0xb1,0x07,0x23,
+    0x4b,0x65,0x52,0x56,0x28,0xaf,0x69,0x83,0x6e,0xa2,0x79,0x5a,0x85,0xef,0xce,0x5f,
+    0x58,0x50,0x99,0xbd,0xfc,0xa1,0x76,0x13,0x11,0xca,0x86,0x6d,0xf1,0xe4,0x8e,0xee,
+    0x19,0x6d,0xfb,0x11,0x01,0xaf,0xbd,0x4a,0x99,0x97,0xb5,0x76,0x0c,0xac,0xec,0x08,
+    0x14,0xf9,0xa9,0x40,0x89,0x23,0x2d,0x7d,0x92,0x66,0xa4,0x48,0x7e,0x62,0xf0,0x09,
+    0x00,0x00,0xff,0xff,0x24,0x89,0x31,0x0e,0x80,0x20,0x0c,0x00,0x77,0x5f,0xd1,0xf4,
+    0x03,0x7e,0x00,0x18,0x1d,0x75,0xf0,0x05,0x45,0x1a,0xd3,0xa4,0xa2,0xd1,0x42,0xe2,
+    0xef,0x85,0x38,0x5d,0xee,0x2e,0x0c,0x00,0x6e,0xb4,0x14,0x3a,0x1b,0xc0,0x25,0xa9,
+    0x40,0x2a,0x7b,0xf6,0xb8,0x71,0x36,0xbe,0xb1,0xbf,0x76,0x95,0x22,0x6b,0x48,0xf2,
+    0x50,0x54,0x76,0xe3,0xaf,0xff,0x92,0x7c,0x15,0x03,0x7b,0x2f,0xf6,0x78,0x53,0x92,
+    0x13,0x21,0xd3,0xd1,0x64,0x5d,0xe6,0xd5,0xc8,0xca,0x83,0x50,0x49,0x4b,0x2b,0xcb,
+    0x34,0x21,0x7c,0x00,0x00,0x00,0xff,0xff,0x84,0x8d,0x41,0x0a,0xc3,0x30,0x0c,0x04,
+    0xef,0x79,0xc5,0xa2,0x0f,0xe4,0x5e,0x12,0x5f,0xf2,0x81,0x1e,0xf2,0x01,0xd7,0x36,
+    0xc1,0xe0,0x4a,0xc6,0xc8,0x81,0xfe,0xbe,0x6a,0x42,0x7a,0x2b,0xbd,0x2c,0xac,0x46,
+    0xbb,0xeb,0x06,0x60,0x1a,0x35,0xba,0x61,0x8a,0x79,0x87,0x2f,0x79,0xe3,0x99,0x42,
+    0x62,0x4d,0x8d,0xdc,0x01,0xa5,0xea,0xd6,0xa4,0x57,0x7b,0x19,0xb5,0x99,0x7e,0xc4,
+    0x80,0x85,0xf0,0x23,0x64,0xf4,0x4a,0xa1,0xf8,0x47,0x2a,0x33,0x2d,0xc2,0x9c,0x82,
+    0x66,0x61,0xd4,0x26,0x2a,0x41,0xca,0x8d,0xbe,0xe3,0x7f,0xeb,0x8e,0x16,0x87,0x75,
+    0xb9,0x9f,0x3e,0x73,0xed,0x0a,0x7d,0xd5,0x34,0x53,0xf3,0x31,0x0b,0x81,0xfd,0xd3,
+    0xcc,0x55,0x4e,0xd8,0x7d,0xe9,0x76,0x58,0x09,0x6f,0x00,0x00,0x00,0xff,0xff,0x24,
+    0x89,0xc1,0x0d,0x80,0x20,0x10,0x04,0xff,0x56,0xb1,0xb9,0x06,0x6c,0x00,0x78,0x59,
+    0x80,0x1f,0x0a,0x38,0x85,0x18,0x92,0x13,0x08,0x39,0x4c,0xec,0x5e,0x88,0xaf,0xc9,
+    0xcc,0xb8,0x05,0x30,0xab,0x06,0x37,0x39,0x00,0x13,0xd2,0x03,0x96,0x74,0x65,0x4b,
+    0x67,0xcc,0x1a,0x1b,0xcd,0x37,0xae,0xf0,0x11,0xc5,0xc1,0x6f,0xfb,0xef,0x29,0xd7,
+    0xae,0xd0,0xb7,0x46,0x4b,0x8d,0x43,0x2a,0x84,0xcc,0xf7,0x90,0xda,0x8a,0x96,0xb3,
+    0x08,0xe1,0x61,0xe9,0x23,0x78,0xc2,0x07,0x00,0x00,0xff,0xff,0x7c,0x8d,0xb1,0x0e,
+    0xc2,0x30,0x0c,0x44,0xf7,0x7e,0xc5,0xc9,0x3f,0xc0,0x8e,0xda,0x4c,0xcc,0xc0,0xc2,
+    0x07,0xa4,0x8d,0x55,0x45,0x4a,0x9d,0x90,0xc6,0x95,0xf8,0x7b,0xdc,0x22,0x24,0x26,
+    0x96,0xb3,0xee,0x9e,0x7c,0xe7,0x3a,0xa0,0x3f,0xb5,0xe0,0x8e,0x9b,0x4b,0x9b,0x6b,
+    0xd6,0xe2,0x3a,0xcb,0xaa,0xe9,0x2e,0x06,0x8c,0xa3,0x0f,0x71,0x83,0x4f,0x71,0x96,
+    0x81,0x26,0x96,0xc6,0x95,0x76,0x66,0xf4,0xfb,0x85,0xe4,0x47,0x4e,0x03,0x3d,0x2e,
+    0x77,0xac,0xfc,0x54,0x96,0x89,0x21,0xba,0x8c,0x5c,0xd7,0x33,0xfd,0x0e,0xfd,0xef,
+    0x3b,0x6a,0x1c,0xb2,0x7c,0x6c,0x94,0xa2,0x0d,0xed,0x55,0x78,0xa0,0xea,0x43,0xcc,
+    0x04,0xf1,0x8b,0x19,0x0d,0xc5,0x66,0x08,0x9b,0x4f,0x6a,0xf6,0x76,0x25,0xbc,0x01,
+    0x00,0x00,0xff,0xff,0x24,0xc9,0xc1,0x0d,0x80,0x20,0x10,0x05,0xd1,0xbb,0x55,0xfc,
+    0x6c,0x03,0x36,0x20,0x1c,0xb9,0x5a,0xc3,0x2a,0x8b,0x21,0x41,0x44,0x04,0x12,0xbb,
+    0x17,0xe2,0x69,0xf2,0x32,0x7a,0x02,0x96,0xb9,0x58,0x3d,0xda,0x83,0xc5,0xfa,0x06,
+    0x0e,0xfe,0x88,0x8a,0x76,0x89,0x45,0x32,0x8d,0xd7,0x6f,0xe0,0x4d,0x82,0xc6,0xe5,
+    0xdc,0x6f,0x1f,0x53,0x2d,0x28,0x6f,0x12,0x45,0x99,0xad,0xbf,0x08,0x91,0xcf,0x8e,
+    0x6a,0xd3,0x23,0x37,0xa1,0x71,0xa8,0x9d,0xab,0x31,0x84,0x0f,0x00,0x00,0xff,0xff,
+    0x8c,0x8e,0x31,0x0e,0xc2,0x30,0x0c,0x45,0x77,0x4e,0x61,0x3c,0x01,0x52,0xd4,0x0b,
+    0xa4,0x99,0xd9,0x39,0x81,0x69,0xa2,0x36,0x52,0x9a,0x44,0x26,0x6d,0xc5,0xed,0x71,
+    0xd3,0x56,0x30,0xe2,0xc1,0xd6,0xf7,0xff,0x7e,0xb2,0x39,0x01,0xe8,0xa6,0x58,0x53,
+    0x67,0xca,0xa5,0xe7,0x34,0x65,0x73,0x92,0x1d,0x4b,0x3f,0x2b,0x05,0x0f,0xc7,0x9e,
+    0x02,0x94,0x77,0x76,0x70,0x79,0x2d,0xcd,0xb0,0x5c,0x41,0x29,0x31,0xd7,0x04,0x48,
+    0x69,0x39,0x07,0x6d,0xfd,0x0c,0x14,0x7c,0x1f,0x5b,0xec,0x5c,0x2c,0x8e,0x71,0x73,
+    0x6b,0xe2,0x00,0x43,0xa0,0xa7,0x0b,0x2d,0xfe,0x30,0x6f,0x7b,0xee,0xf8,0xe2,0x2f,
+    0x5e,0xc5,0x98,0x3b,0xb1,0x5d,0x88,0x9d,0x6e,0x36,0xfd,0xf5,0x7d,0xcc,0x53,0xa9,
+    0xf8,0x16,0x99,0xac,0x4f,0x08,0x91,0x46,0x11,0x5d,0x1a,0xd7,0x2d,0xc2,0x4c,0x61,
+    0x12,0x3d,0xec,0x08,0x84,0x0f,0x00,0x00,0x00,0xff,0xff,0x2c,0x8c,0xd1,0x0d,0x80,
+    0x20,0x0c,0x44,0xff,0x9d,0xa2,0xe9,0x02,0x2e,0x80,0x2c,0xe1,0x04,0x15,0xaa,0x21,
+    0x41,0x20,0x58,0x30,0x6e,0x2f,0x0a,0xf7,0x75,0xef,0x5e,0x72,0x7a,0x82,0x16,0x35,
+    0x8b,0xd5,0xbd,0xb5,0x02,0xca,0xba,0x0a,0xe4,0xdd,0x11,0x16,0x34,0x1c,0x84,0x33,
+    0x0e,0xeb,0x69,0x63,0xaf,0xd7,0xb8,0xcb,0x4d,0x99,0xd5,0xdc,0xf9,0x77,0xbf,0x77,
+    0x21,0x15,0x01,0x79,0x12,0x2f,0x98,0xc9,0xba,0x88,0x10,0xe8,0x6c,0x60,0xe2,0xf9,
+    0xad,0x08,0x95,0x7c,0x69,0x7c,0x8d,0x0b,0x84,0x17,0x00,0x00,0xff,0xff,0xd4,0x51,
+    0x31,0x0e,0xc2,0x30,0x0c,0xdc,0xfb,0x0a,0xe3,0x3d,0xca,0x8e,0xda,0x2c,0xb0,0xa2,
+    0x0e,0xbc,0x20,0x10,0xab,0x58,0x4a,0x93,0x28,0x4a,0x2b,0xf1,0x7b,0x5c,0x42,0x05,
+    0x0b,0x2a,0x2b,0x19,0x22,0xfb,0x7c,0x77,0x8e,0x2e,0xa6,0x01,0x39,0xad,0x2e,0xce,
+    0xd4,0x4a,0x0a,0x68,0x1d,0xcf,0x60,0x3d,0x0f,0xa1,0xc3,0x2b,0x85,0x42,0x19,0xcd,
+    0x27,0x47,0xc7,0x54,0x86,0x1c,0xa7,0x64,0x1a,0x41,0xb3,0xdc,0x3b,0xa5,0xe0,0x48,
+    0x9e,0x47,0x16,0x32,0x28,0x25,0xd0,0x82,0x6f,0x38,0xde,0x56,0x8a,0x96,0xb1,0xf9,
+    0xe9,0x11,0x7f,0x25,0x79,0x85,0x53,0x93,0xf8,0xaa,0xad,0xb2,0x35,0x52,0xf0,0xf6,
+    0x42,0xbe,0xc3,0x3e,0x51,0xb6,0x85,0x63,0x80,0x31,0x3a,0xda,0x63,0xf3,0xfe,0xa5,
+    0x0d,0xa7,0xa7,0x81,0x39,0xf4,0x27,0x75,0xa6,0x3c,0x53,0x6e,0x75,0x45,0xea,0x94,
+    0x43,0x9a,0x0a,0x94,0x7b,0xa2,0x0e,0xb3,0x75,0x1c,0x11,0x82,0x1d,0xa5,0x89,0x69,
+    0x59,0x84,0x30,0x5b,0x3f,0x49,0x7b,0x46,0x78,0x00,0x00,0x00,0xff,0xff,0x24,0xc9,
+    0x31,0x0a,0x80,0x30,0x0c,0x85,0xe1,0xdd,0x53,0x84,0xec,0xe2,0x05,0x6a,0x97,0xce,
+    0xe2,0x19,0xa2,0x0d,0x12,0x88,0x6d,0x29,0xad,0xe0,0xed,0x8d,0x74,0x7a,0xfc,0xef,
+    0xf3,0x13,0x80,0x5b,0x5a,0xf4,0xff,0xda,0x80,0x8b,0xf2,0x00,0xa9,0x5c,0x69,0xc5,
+    0x93,0x53,0xe3,0x8a,0xbf,0x99,0x2a,0x1d,0xac,0x3e,0xec,0xdb,0x1c,0x54,0x4c,0xdc,
+    0x32,0x9e,0xa1,0x92,0x4a,0x6f,0xd0,0xde,0xc2,0x2b,0x56,0x8a,0x92,0x11,0x12,0xdd,
+    0x16,0xb9,0xdc,0x39,0x32,0xc2,0x43,0xda,0x2d,0x03,0xc2,0x07,0x00,0x00,0xff,0xff,
+    0x7c,0x8d,0xb1,0x0e,0x83,0x30,0x0c,0x44,0x77,0xbe,0xc2,0xf2,0x0f,0x64,0x47,0x49,
+    0x76,0x36,0x86,0xfe,0x80,0x29,0x56,0x14,0x29,0x84,0x28,0x72,0x10,0xfc,0x7d,0x0d,
+    0x6a,0xa5,0x0e,0x2d,0xcb,0xc9,0xba,0x77,0xe7,0xf3,0x1d,0x80,0x35,0x32,0xfb,0xce,
+    0xce,0x71,0x03,0x4a,0x31,0x64,0x87,0x4f,0xce,0xc2,0x15,0xfd,0x05,0xd7,0x22,0xa1,
+    0xae,0xad,0x68,0xc4,0x48,0x55,0x3d,0x45,0x81,0x96,0xe0,0x4f,0x49,0xe9,0xa7,0x05,
+    0x89,0x26,0x4e,0x0e,0x1f,0x54,0x03,0x0b,0x0c,0x63,0x8f,0xef,0xc1,0x9b,0x17,0xd6,
+    0xa8,0xe9,0xbf,0x63,0x3f,0x53,0x31,0x97,0x26,0x20,0x47,0x61,0x87,0xc2,0xbb,0x20,
+    0x64,0x5a,0xce,0xfb,0xda,0x1a,0x46,0x84,0x8d,0x52,0x53,0xe3,0x05,0x00,0x00,0xff,
+    0xff,0xdc,0x90,0x31,0x0f,0x82,0x30,0x10,0x85,0x77,0x7f,0xc5,0xf3,0x76,0x02,0x2e,
+    0x4e,0xa5,0x93,0x89,0x71,0xd2,0xf8,0x0f,0xaa,0x34,0xd0,0xa4,0x94,0xa6,0x14,0x82,
+    0xff,0xde,0x03,0x83,0xe8,0xa2,0xce,0x2e,0xbd,0xdc,0xbb,0x77,0xdf,0x35,0x8f,0x50,
+    0xab,0xc1,0x6a,0x57,0xc6,0x2a,0xa7,0xcd,0x96,0x24,0x00,0x91,0xc6,0x42,0xae,0xb8,
+    0x72,0x81,0x28,0x4c,0x0f,0x65,0x4d,0xe9,0x72,0xba,0x6a,0x17,0x75,0x20,0x29,0x52,
+    0x16,0xe5,0xd3,0x96,0x36,0x3e,0x96,0xa1,0xe9,0xbc,0x5c,0xb1,0x16,0xf8,0x5d,0x27,
+    0x09,0x76,0xda,0x9a,0xda,0xb0,0x1f,0x49,0xc2,0xd2,0xa8,0x03,0x1f,0xa0,0x10,0xd5,
+    0x6c,0x79,0xc3,0xff,0xcf,0xca,0x4b,0x38,0xe7,0x01,0xde,0xb8,0x1f,0x93,0x99,0xa6,
+    0x93,0x63,0x0e,0x1a,0x56,0x5d,0xb4,0xcd,0x69,0x7f,0x3a,0x1c,0x11,0x1b,0x74,0xad,
+    0x86,0x6a,0x99,0x4a,0xf3,0xd5,0xaf,0x5f,0x5c,0xa0,0x13,0x4b,0x4e,0xa8,0x2c,0x13,
+    0xe9,0xa3,0x5d,0xc6,0xc6,0xf9,0x2e,0x22,0xde,0xbc,0xce,0x29,0xa8,0xc2,0x34,0x04,
+    0xa7,0xea,0xb1,0x19,0xc6,0x1d,0x42,0xaf,0x6c,0xc7,0x6d,0x96,0x11,0xee,0x00,0x00,
+    0x00,0xff,0xff,0x2c,0x8b,0x41,0x0a,0x80,0x20,0x10,0x45,0xf7,0x9d,0x62,0x98,0x0b,
+    0x24,0xad,0xd5,0x6d,0xb4,0xaa,0x2b,0x4c,0x39,0x84,0x60,0x93,0x84,0x45,0xdd,0x3e,
+    0xcd,0xfe,0xea,0x3d,0x1e,0xdf,0x36,0x90,0xa7,0xdb,0xe4,0x6c,0xa5,0x0c,0xa0,0x9d,
+    0xbf,0x80,0x82,0x5f,0xc5,0xe0,0xc2,0x92,0xf8,0xc0,0xbf,0x06,0x9a,0x39,0xd8,0x7e,
+    0x1a,0x46,0x50,0x9d,0x6e,0xab,0x7e,0xe9,0xcb,0x5e,0xe2,0x99,0x20,0x3d,0x91,0x0d,
+    0x1e,0xe4,0xfc,0x8e,0x20,0xb4,0x15,0xb9,0xcb,0x07,0xe1,0xa2,0x70,0x66,0x55,0x1d,
+    0xc2,0x0b,0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,0x14,0x3b,
+    0x08,0x0b,0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,0xcf,0xb3,0x55,
+    0x4a,0x4e,0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,0x26,0xa5,0xe6,
+    0xd8,0xb9,0x07,0x78,0xfa,0x2b,0x18,0x98,0xd8,0xe8,0x43,0xb8,0x08,0xe9,0xcc,0xbc,
+    0x82,0xd2,0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,0xcc,0x7c,0x25,
+    0x85,0xbc,0xc4,0x5c,0x10,0xa7,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,0xa7,0x14,0xc8,
+    0x35,0x30,0x51,0x52,0x00,0x00,0x00,0x00,0xff,0xff,0x7c,0x8b,0x31,0x0e,0x80,0x20,
+    0x0c,0x45,0x77,0x4f,0xd1,0xf4,0x02,0xba,0xb0,0x01,0xab,0x71,0xd2,0x2b,0x54,0x21,
+    0x86,0x04,0x91,0x10,0x34,0x7a,0x7b,0x0b,0x3a,0xdb,0xe1,0x25,0xef,0xff,0x5f,0xdd,
+    0x00,0x9f,0x6c,0xb3,0xd1,0x0d,0x33,0x31,0x0b,0x6a,0xc8,0x19,0x48,0xe3,0x4e,0x20,
+    0xef,0xd6,0xa0,0x70,0xb1,0x21,0xdb,0x84,0xfa,0x9b,0xff,0x6e,0xde,0xd6,0xd3,0x6c,
+    0xbd,0xee,0xa7,0x61,0x84,0x4e,0xc8,0xf6,0xd5,0x5a,0xd5,0xda,0x85,0x78,0x64,0xc8,
+    0x77,0xb4,0x0a,0x13,0x19,0xb7,0x23,0x04,0xda,0x8a,0x5c,0xe5,0x07,0xe1,0x24,0x7f,
+    0xb0,0x76,0x02,0xe1,0x01,0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,
+    0x92,0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,
+    0xcf,0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,
+    0x26,0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,0x2b,0x18,0x58,0xda,0xe8,0x43,0xb8,0x08,
+    0xe9,0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,
+    0xcc,0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x10,0xa7,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,
+    0xa7,0x14,0xc8,0x35,0xb0,0x54,0x52,0x00,0x00,0x00,0x00,0xff,0xff,0x2c,0x8b,0x41,
+    0x0a,0x80,0x20,0x10,0x45,0xf7,0x9d,0x62,0x98,0x0b,0x64,0x7b,0x75,0x1b,0xad,0xea,
+    0x0a,0x53,0x0e,0x21,0xd8,0x24,0x61,0x51,0xb7,0x4f,0xb3,0xbf,0x7a,0x8f,0xc7,0xb7,
+    0x0d,0xe4,0xe9,0x36,0x39,0x5b,0x29,0x03,0x68,0xe7,0x2f,0xa0,0xe0,0x57,0x31,0xb8,
+    0xb0,0x24,0x3e,0xf0,0xaf,0x81,0x66,0x0e,0xb6,0x9f,0x86,0x11,0x3a,0xa5,0xdb,0xaa,
+    0x5f,0xfa,0xb2,0x97,0x78,0x26,0x48,0x4f,0x64,0x83,0x07,0x39,0xbf,0x23,0x08,0x6d,
+    0x45,0xee,0xf2,0x41,0xb8,0x28,0x9c,0x59,0x3b,0x85,0xf0,0x02,0x00,0x00,0xff,0xff,
+    0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,0x14,0x3b,0x2e,0x20,0x59,0x04,0x24,0x41,
+    0x04,0x58,0x10,0x28,0xa6,0x60,0x93,0x92,0x59,0xa6,0x90,0x98,0x93,0x99,0x9e,0x67,
+    0xab,0x94,0x9c,0x9a,0x57,0x92,0x5a,0xa4,0x64,0x07,0x55,0x8e,0x57,0x0d,0x58,0x16,
+    0xac,0x22,0x27,0x31,0x29,0x35,0xc7,0xce,0x3d,0xc0,0xd3,0x5f,0xc1,0xd0,0xc8,0x46,
+    0x1f,0xc2,0x45,0x48,0x67,0xe6,0x15,0x94,0x96,0x28,0x94,0x54,0x16,0xa4,0xda,0x2a,
+    0x15,0x25,0xa6,0x64,0xe6,0x2b,0x29,0xe4,0x25,0xe6,0x82,0x38,0x15,0x20,0x3d,0x4a,
+    0x0a,0x65,0x89,0x39,0xa5,0x40,0xae,0xa1,0x91,0x92,0x02,0x00,0x00,0x00,0xff,0xff,
+    0x2c,0x8b,0x41,0x0a,0x80,0x20,0x10,0x45,0xf7,0x9d,0x62,0x98,0x0b,0x84,0xb4,0x55,
+    0xb7,0xd1,0xaa,0xae,0x30,0xe5,0x10,0x82,0x4d,0x12,0x16,0x75,0xfb,0x34,0xfb,0xab,
+    0xf7,0x78,0x7c,0xdb,0x40,0x9e,0x6e,0x93,0xb3,0x95,0x32,0x80,0x76,0xfe,0x02,0x0a,
+    0x7e,0x15,0x83,0x0b,0x4b,0xe2,0x03,0xff,0x1a,0x68,0xe6,0x60,0xfb,0x69,0x18,0x41,
+    0x75,0xba,0xad,0xfa,0xa5,0x2f,0x7b,0x89,0x67,0x82,0xf4,0x44,0x36,0x78,0x90,0xf3,
+    0x3b,0x82,0xd0,0x56,0xe4,0x2e,0x1f,0x84,0x8b,0xc2,0x99,0x55,0x75,0x08,0x2f,0x00,
+    0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,0x14,0x3b,0x08,0x0b,
+    0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,0xcf,0xb3,0x55,0x4a,0x4e,
+    0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,0x26,0xa5,0xe6,0xd8,0xb9,
+    0x07,0x78,0xfa,0x2b,0x18,0x9a,0xd8,0xe8,0x43,0xb8,0x08,0xe9,0xcc,0xbc,0x82,0xd2,
+    0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,0xcc,0x7c,0x25,0x85,0xbc,
+    0xc4,0x5c,0x10,0xa7,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,0xa7,0x14,0xc8,0x35,0x34,
+    0x51,0x52,0x00,0x00,0x00,0x00,0xff,0xff,0x7c,0x8b,0x31,0x0e,0x80,0x20,0x0c,0x45,
+    0x77,0x4f,0xd1,0xf4,0x02,0xc6,0x81,0x0d,0x58,0x8d,0x93,0x5e,0xa1,0x0a,0x31,0x24,
+    0x88,0x84,0xa0,0xd1,0xdb,0x5b,0xd0,0xd9,0x0e,0x2f,0x79,0xff,0xff,0xea,0x06,0xf8,
+    0x64,0x9b,0x8d,0x6e,0x98,0x89,0x59,0x50,0x43,0xce,0x40,0x1a,0x77,0x02,0x79,0xb7,
+    0x06,0x85,0x8b,0x0d,0xd9,0x26,0xd4,0xdf,0xfc,0x77,0xf3,0xb6,0x9e,0x66,0xeb,0x75,
+    0x3f,0x0d,0x23,0x74,0x42,0xb6,0xaf,0xd6,0xaa,0xd6,0x2e,0xc4,0x23,0x43,0xbe,0xa3,
+    0x55,0x98,0xc8,0xb8,0x1d,0x21,0xd0,0x56,0xe4,0x2a,0x3f,0x08,0x27,0xf9,0x83,0xb5,
+    0x13,0x08,0x0f,0x00,0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,
+    0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,0xcf,
+    0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,0x26,
+    0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,0x2b,0x18,0x9a,0xd9,0xe8,0x43,0xb8,0x08,0xe9,
+    0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,0xcc,
+    0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x10,0xa7,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,0xa7,
+    0x14,0xc8,0x35,0x34,0x53,0x52,0x00,0x00,0x00,0x00,0xff,0xff,0x8c,0x8e,0x31,0x0e,
+    0xc3,0x20,0x0c,0x45,0xf7,0x9c,0xe2,0xd7,0x3b,0x0a,0x07,0x48,0x58,0xab,0x4e,0xed,
+    0xd0,0x0b,0xd0,0x06,0x45,0x48,0x14,0x10,0x81,0x28,0xb9,0x7d,0x1d,0xa2,0x2a,0x9d,
+    0xaa,0x7a,0xb0,0xfe,0xb7,0xbf,0x9f,0xac,0x1a,0x70,0x75,0x6d,0x1e,0xd4,0xae,0x58,
+    0xa0,0x1b,0xec,0x0c,0xed,0xec,0xe8,0x7b,0x7a,0x1a,0x9f,0x4d,0x22,0xf5,0x9d,0x69,
+    0x43,0xcc,0x63,0x0a,0x25,0xaa,0x86,0xa7,0x89,0xfb,0x49,0x08,0xdc,0x17,0x44,0xeb,
+    0x21,0x04,0xfb,0x6d,0xf8,0x13,0x57,0xb7,0x35,0xf1,0x61,0xc1,0xe9,0x87,0x71,0x3d,
+    0x9d,0x6f,0x97,0x2b,0x72,0x40,0x99,0x0c,0xf4,0xc4,0x54,0x52,0xff,0xfe,0x78,0x40,
+    0x2b,0x4b,0x55,0x94,0x94,0x5d,0xbb,0xdb,0x63,0x6d,0x7d,0x2c,0x19,0x79,0x8d,0xa6,
+    0xa7,0xa4,0x07,0x1b,0x08,0x5e,0xbf,0xd8,0xe4,0x65,0xbb,0x21,0xcc,0xda,0x15,0xb6,
+    0x52,0x12,0xde,0x00,0x00,0x00,0xff,0xff,0x2c,0x8b,0x41,0x0a,0x80,0x20,0x10,0x45,
+    0xf7,0x9d,0x62,0x98,0x0b,0x28,0xae,0xd5,0x6d,0xb4,0xaa,0x2b,0x4c,0x29,0x21,0x98,
+    0x89,0x4c,0x51,0xb7,0xcf,0xb2,0xbf,0x7a,0x8f,0xc7,0xb7,0x1d,0xd4,0x69,0xc1,0xce,
+    0x36,0xaa,0x00,0xda,0x85,0x13,0x28,0x86,0x35,0x19,0x5c,0x7c,0x62,0x5f,0xf0,0xaf,
+    0x91,0x66,0x1f,0x6d,0x3f,0x0d,0x23,0x48,0xa5,0x45,0xd3,0x2f,0x7d,0x39,0xa4,0x7c,
+    0x30,0xf0,0x9d,0xbd,0xc1,0x42,0x2e,0xec,0x08,0x89,0xb6,0x2a,0x7c,0xbd,0x1f,0x84,
+    0x93,0xe2,0x51,0x55,0x2a,0x84,0x07,0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,0x02,
+    0x1b,0xfd,0x92,0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,0xcc,
+    0xc9,0x4c,0xcf,0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,0x55,
+    0xe4,0x24,0x26,0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,0x2b,0x18,0x98,0xd8,0xe8,0x43,
+    0xb8,0x08,0xe9,0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,0xa2,
+    0xc4,0x94,0xcc,0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x20,0xa7,0xa4,0x02,0xa4,0x47,0x49,
+    0xa1,0x2c,0x31,0xa7,0x14,0xc8,0x35,0x30,0x51,0x52,0x00,0x00,0x00,0x00,0xff,0xff,
+    0x7c,0x8b,0x31,0x0a,0x80,0x30,0x0c,0x45,0x77,0x4f,0x11,0x72,0x01,0x5d,0xba,0xd5,
+    0xae,0xe2,0xa4,0x57,0x88,0xb6,0x48,0xa1,0xd6,0x52,0xa2,0xe8,0xed,0x8d,0xd5,0xd9,
+    0x0c,0x0f,0xde,0xff,0x3f,0xa6,0x02,0x39,0x5d,0xb3,0x35,0x95,0x30,0x0b,0x1f,0x94,
+    0x50,0x32,0xd0,0xd6,0x1f,0x40,0xc1,0x2f,0xb1,0xc5,0xd9,0x45,0x76,0x19,0xcd,0x37,
+    0xff,0xdd,0xbc,0x6d,0xa0,0xc9,0x05,0xd3,0x8d,0xfd,0x00,0x8d,0xd2,0xf5,0xab,0xa5,
+    0x2a,0xb5,0x8f,0x69,0x67,0xe0,0x2b,0xb9,0x16,0x33,0x59,0xbf,0x21,0x44,0x5a,0x45,
+    0xf8,0x7c,0x7e,0x10,0x0e,0x0a,0xbb,0x68,0xa3,0x10,0x6e,0x00,0x00,0x00,0xff,0xff,
+    0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,0x49,
+    0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,0xcf,0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,0x2d,
+    0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,0x26,0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,0x2b,
+    0x18,0x58,0xda,0xe8,0x43,0xb8,0x08,0xe9,0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,0xca,
+    0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,0xcc,0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x20,0xa7,
+    0xa4,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,0xa7,0x14,0xc8,0x35,0xb0,0x54,0x52,0x00,
+    0x00,0x00,0x00,0xff,0xff,0x2c,0x8b,0x41,0x0a,0x80,0x20,0x10,0x45,0xf7,0x9d,0x62,
+    0x98,0x0b,0xa8,0x7b,0x75,0x1b,0xad,0xea,0x0a,0x53,0x4a,0x08,0x66,0x22,0x53,0xd4,
+    0xed,0xb3,0xec,0xaf,0xde,0xe3,0xf1,0x6d,0x07,0x75,0x5a,0xb0,0xb3,0x8d,0x2a,0x80,
+    0x76,0xe1,0x04,0x8a,0x61,0x4d,0x06,0x17,0x9f,0xd8,0x17,0xfc,0x6b,0xa4,0xd9,0x47,
+    0xdb,0x4f,0xc3,0x08,0x4a,0x6a,0xd1,0xf4,0x4b,0x5f,0x0e,0x29,0x1f,0x0c,0x7c,0x67,
+    0x6f,0xb0,0x90,0x0b,0x3b,0x42,0xa2,0xad,0x0a,0x5f,0xef,0x07,0xe1,0xa4,0x78,0x54,
+    0x55,0x12,0xe1,0x01,0x00,0x00,0xff,0xff,0x7c,0x8b,0x31,0x0a,0x80,0x30,0x0c,0x45,
+    0x77,0x4f,0x11,0x72,0x01,0xd1,0xb9,0xed,0x2a,0x4e,0x7a,0x85,0x68,0x8b,0x14,0x6a,
+    0x95,0x12,0x45,0x6f,0x6f,0xac,0x82,0x9b,0x19,0x1e,0xfc,0xff,0x5f,0x4c,0x01,0x72,
+    0xaa,0x64,0x6b,0x0a,0x61,0x12,0xde,0xc8,0xa5,0x74,0xa0,0xac,0xdf,0x81,0x82,0x9f,
+    0xa2,0xc6,0xd1,0x45,0x76,0x09,0xcd,0xab,0xff,0x3a,0x79,0xcd,0x46,0xa0,0xc1,0x05,
+    0xd3,0xf4,0x6d,0x07,0x55,0xad,0xca,0x27,0x7e,0xb3,0x8f,0xeb,0xc6,0xc0,0xe7,0xea,
+    0x34,0x26,0xb2,0x7e,0x41,0x88,0x34,0x4b,0xe0,0xe3,0xfe,0x41,0xd8,0x29,0x6c,0x12,
+    0xab,0x1a,0xe1,0x02,0x00,0x00,0xff,0xff,0x2c,0x8b,0x41,0x0a,0x80,0x20,0x10,0x45,
+    0xf7,0x9d,0x62,0x98,0x0b,0x88,0xb8,0x55,0xb7,0xd1,0xaa,0xae,0x30,0xa5,0x84,0x60,
+    0x26,0x32,0x45,0xdd,0x3e,0xcb,0xfe,0xea,0x3d,0x1e,0xdf,0x76,0x50,0xa7,0x05,0x3b,
+    0xdb,0xa8,0x02,0x68,0x17,0x4e,0xa0,0x18,0xd6,0x64,0x70,0xf1,0x89,0x7d,0xc1,0xbf,
+    0x46,0x9a,0x7d,0xb4,0xfd,0x34,0x8c,0x20,0x95,0x16,0x4d,0xbf,0xf4,0xe5,0x90,0xf2,
+    0xc1,0xc0,0x77,0xf6,0x06,0x0b,0xb9,0xb0,0x23,0x24,0xda,0xaa,0xf0,0xf5,0x7e,0x10,
+    0x4e,0x8a,0x47,0x55,0xa9,0x10,0x1e,0x00,0x00,0x00,0xff,0xff,0xb2,0xe3,0x52,0x00,
+    0x02,0x1b,0xfd,0x92,0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,0x49,0xc9,0x2c,0x53,0x48,
+    0xcc,0xc9,0x4c,0xcf,0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,0x2d,0x52,0x82,0xc8,0x82,
+    0x55,0xe4,0x24,0x26,0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,0x2b,0x18,0x9a,0xd8,0xe8,
+    0x43,0xb8,0x08,0xe9,0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,0xca,0x82,0x54,0x5b,0xa5,
+    0xa2,0xc4,0x94,0xcc,0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x20,0xa7,0xa4,0x02,0xa4,0x47,
+    0x49,0xa1,0x2c,0x31,0xa7,0x14,0xc8,0x35,0x34,0x51,0x52,0x00,0x00,0x00,0x00,0xff,
+    0xff,0x7c,0x8b,0x31,0x0a,0x80,0x30,0x0c,0x45,0x77,0x4f,0x11,0x72,0x01,0x71,0xe8,
+    0x56,0xbb,0x8a,0x93,0x5e,0x21,0xda,0x22,0x85,0x5a,0x4b,0x89,0xa2,0xb7,0x37,0x56,
+    0x67,0x33,0x3c,0x78,0xff,0xff,0x98,0x0a,0xe4,0x74,0xcd,0xd6,0x54,0xc2,0x2c,0x7c,
+    0x50,0x42,0xc9,0x40,0x5b,0x7f,0x00,0x05,0xbf,0xc4,0x16,0x67,0x17,0xd9,0x65,0x34,
+    0xdf,0xfc,0x77,0xf3,0xb6,0x81,0x26,0x17,0x4c,0x37,0xf6,0x03,0x34,0x4a,0xd7,0xaf,
+    0x96,0xaa,0xd4,0x3e,0xa6,0x9d,0x81,0xaf,0xe4,0x5a,0xcc,0x64,0xfd,0x86,0x10,0x69,
+    0x15,0xe1,0xf3,0xf9,0x41,0x38,0x28,0xec,0xa2,0x8d,0x42,0xb8,0x01,0x00,0x00,0xff,
+    0xff,0xb2,0xe3,0x52,0x00,0x02,0x1b,0xfd,0x92,0x14,0x3b,0x08,0x0b,0xc8,0x50,0xb0,
+    0x49,0xc9,0x2c,0x53,0x48,0xcc,0xc9,0x4c,0xcf,0xb3,0x55,0x4a,0x4e,0xcd,0x2b,0x49,
+    0x2d,0x52,0x82,0xc8,0x82,0x55,0xe4,0x24,0x26,0xa5,0xe6,0xd8,0xb9,0x07,0x78,0xfa,
+    0x2b,0x18,0x9a,0xd9,0xe8,0x43,0xb8,0x08,0xe9,0xcc,0xbc,0x82,0xd2,0x12,0x85,0x92,
+    0xca,0x82,0x54,0x5b,0xa5,0xa2,0xc4,0x94,0xcc,0x7c,0x25,0x85,0xbc,0xc4,0x5c,0x20,
+    0xa7,0xa4,0x02,0xa4,0x47,0x49,0xa1,0x2c,0x31,0xa7,0x14,0xc8,0x35,0x34,0x53,0x52,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xd4,0x51,0x31,0x0e,0x83,0x30,0x0c,0xdc,0x79,0x85,
+    0xeb,0x3d,0xca,0xc6,0x04,0x99,0xfa,0x11,0xd3,0x44,0xd4,0x52,0x08,0x51,0x6a,0x90,
+    0xfa,0xfb,0x1a,0x10,0x85,0xad,0xac,0xcd,0x10,0xf9,0x7c,0xe7,0x73,0x74,0x71,0x15,
+    0xe8,0x69,0xac,0x78,0xb7,0x55,0x5a,0x40,0xe3,0x79,0x06,0x8a,0xdc,0xa7,0x16,0x1f,
+    0x21,0x49,0x28,0xe8,0xce,0x1a,0x3b,0x66,0xe9,0xcb,0x38,0x65,0x57,0x69,0xb7,0xe8,
+    0x7d,0x33,0x06,0xee,0x21,0xf2,0xc0,0x2a,0x06,0x63,0xb4,0xb5,0xf4,0x7f,0x38,0x3e,
+    0x77,0x89,0x55,0xda,0x5d,0x7a,0xc4,0x5f,0x8d,0x9c,0xc3,0x21,0x21,0xe8,0x58,0x5e,
+    0x17,0xc3,0x59,0xd9,0x55,0xb1,0x67,0x0d,0x91,0xba,0x10,0x5b,0xfc,0x3a,0xa1,0xbb,
+    0xfa,0x77,0x87,0xd9,0xea,0xe1,0xea,0x65,0xbe,0xb1,0x1b,0x38,0x48,0x4e,0x79,0x12,
+    0x90,0x77,0x0e,0x2d,0x16,0xf2,0x3c,0x22,0x24,0x1a,0x14,0x78,0x5d,0x89,0x30,0x53,
+    0x9c,0x14,0xd4,0x08,0x1f,0x00,0x00,0x00,0xff,0xff,0x44,0x8a,0x41,0x0a,0xc0,0x20,
+    0x0c,0x04,0xef,0x7d,0x45,0xc8,0x07,0x3c,0x7a,0xb1,0xfe,0x25,0x36,0x52,0x02,0xd6,
+    0x8a,0x44,0xa1,0xbf,0x6f,0xa8,0x87,0xee,0x69,0x86,0xd9,0xb8,0x81,0x2d,0x38,0xe5,
+    0xb8,0xc8,0x00,0x02,0xcb,0x04,0x2a,0x72,0xd6,0x1d,0x8f,0x5c,0x35,0x77,0x5c,0xf5,
+    0x7b,0x14,0x4a,0xb9,0x44,0x0f,0x49,0x34,0xb8,0x25,0x7f,0x94,0xda,0x86,0x82,0x3e,
+    0x2d,0xef,0xd8,0x89,0xe5,0x46,0xa8,0x74,0x99,0x30,0x29,0x21,0x4c,0x2a,0xc3,0xc4,
+    0x23,0xbc,0x00,0x00,0x00,0xff,0xff,0x44,0x8a,0x41,0x0a,0xc0,0x20,0x0c,0x04,0xef,
+    0x7d,0x45,0xc8,0x07,0xbc,0x7a,0xb0,0xfe,0x25,0x36,0x52,0x02,0xd6,0x8a,0x44,0xa1,
+    0xbf,0x6f,0xa8,0x87,0xee,0x69,0x86,0xd9,0xb8,0x81,0x2d,0x38,0xe5,0xb8,0xc8,0x00,
+    0x02,0xcb,0x04,0x2a,0x72,0xd6,0x1d,0x8f,0x5c,0x35,0x77,0x5c,0xf5,0x7b,0x14,0x4a,
+    0xb9,0x44,0x0f,0x49,0x34,0xb8,0x25,0x7f,0x94,0xda,0x86,0x82,0x3e,0x2d,0xef,0xd8,
+    0x89,0xe5,0x46,0xa8,0x74,0x99,0x30,0x29,0x21,0x4c,0x2a,0xc3,0xc4,0x23,0xbc,0x00,
+    0x00,0x00,0xff,0xff,0x84,0x8d,0x41,0x0e,0xc3,0x20,0x0c,0x04,0xef,0x79,0xc5,0xd6,
+    0x77,0x14,0xe5,0x9e,0xf0,0x89,0xbe,0x80,0x34,0x28,0x42,0xa2,0x80,0x88,0x89,0xd4,
+    0xdf,0xd7,0x40,0xaa,0x4a,0xbd,0xd4,0x07,0xcb,0x5e,0xef,0x8e,0xf5,0x00,0xa9,0x79,
+    0xe4,0x4d,0x5f,0x53,0x4c,0xbc,0xe7,0x58,0x92,0x1e,0x44,0xcd,0xd2,0x6f,0x4a,0xe1,
+    0xce,0x31,0x61,0x75,0x7c,0x40,0x29,0x91,0xaa,0xde,0xdc,0x12,0xc3,0xbc,0xb9,0x13,
+    0xc6,0xbb,0x3d,0x2c,0xf4,0xb0,0x81,0x6d,0xa6,0x7e,0x6d,0x8e,0x0f,0x0e,0xde,0xac,
+    0xd6,0x2f,0x54,0x49,0x15,0x44,0xfa,0xf7,0xf3,0x7f,0x56,0x43,0xe8,0x09,0x47,0x67,
+    0xcc,0x63,0x17,0xbe,0x06,0x17,0x52,0x61,0xf0,0x2b,0xd9,0x85,0xb2,0xd9,0x5c,0x24,
+    0x04,0xf3,0x94,0xa5,0x26,0x08,0xa7,0xf1,0x45,0x96,0x89,0xf0,0x06,0x00,0x00,0xff,
+    0xff,0x44,0x8b,0x4b,0x0a,0xc0,0x20,0x0c,0x44,0xf7,0x3d,0x45,0xc8,0x05,0x04,0xd7,
+    0xea,0x5d,0x62,0x95,0x12,0xb0,0x2a,0x36,0x0a,0xbd,0x7d,0x6d,0x5d,0x74,0x56,0xf3,
+    0x79,0xe3,0x36,0x98,0x32,0x4a,0x82,0x5b,0x6e,0x1a,0x30,0x81,0x07,0x50,0xe2,0x23,
+    0x5b,0xdc,0x63,0x96,0xd8,0x70,0xad,0x1f,0x91,0xc8,0xc7,0xe4,0x34,0x5c,0x52,0xaa,
+    0x67,0x31,0x6a,0x15,0x3f,0xc0,0xb9,0x76,0x01,0xb9,0x6b,0xb4,0xd8,0x28,0x70,0x41,
+    0xc8,0x74,0xce,0xf0,0x3e,0x10,0x06,0xa5,0x3e,0x83,0x46,0x78,0x00,0x00,0x00,0xff,
+    0xff,0x84,0x4d,0x4b,0x0a,0x03,0x21,0x0c,0xdd,0xcf,0x29,0xd2,0xec,0x65,0x2e,0xa0,
+    0x1e,0x61,0xe8,0x15,0xd2,0x2a,0x83,0x60,0x55,0x42,0x1c,0x98,0xdb,0x37,0xd5,0x96,
+    0x42,0x37,0xcd,0x22,0xbc,0x5f,0x5e,0xfc,0x02,0x3a,0x76,0x95,0xe0,0xdf,0xa8,0x36,
+    0xd9,0xb9,0xf6,0xe6,0x17,0x55,0x59,0xf7,0xc5,0x18,0xb8,0x12,0x27,0x39,0xc1,0x18,
+    0xe5,0x2f,0x71,0x44,0xf5,0x06,0x6c,0x48,0x07,0x50,0x4e,0x7b,0x71,0x78,0x8f,0x45,
+    0x22,0xe3,0x74,0x47,0xe2,0xd3,0x05,0x99,0x6e,0x31,0x3b,0x9c,0x35,0xe8,0x7f,0x9f,
+    0xfe,0x6f,0x1a,0x05,0x7e,0xab,0x76,0x9d,0xe8,0xeb,0xa4,0xd2,0xba,0x80,0x9c,0x2d,
+    0x3a,0x64,0x0a,0xa9,0x22,0x14,0x7a,0x28,0x69,0xc4,0x08,0x07,0xe5,0xae,0x78,0x43,
+    0x78,0x02,0x00,0x00,0xff,0xff,0x44,0xca,0x41,0x0a,0xc0,0x20,0x0c,0x04,0xc0,0x7b,
+    0x5f,0x11,0xf2,0x01,0x3f,0xa0,0xde,0x7c,0x48,0x5a,0x43,0x09,0xa4,0xa9,0x88,0x0a,
+    0xfd,0x7d,0xa5,0x1e,0xba,0xa7,0x59,0x76,0xe3,0x06,0x33,0xde,0xb5,0x1c,0x97,0x26,
+    0xc0,0x67,0x19,0x40,0x2a,0xa7,0x05,0x3c,0xd8,0x1a,0x57,0x5c,0xeb,0xf7,0x50,0xda,
+    0x59,0x63,0x1a,0x6c,0xde,0x2d,0xff,0x9b,0x58,0xe9,0x0d,0xda,0x53,0x38,0x60,0xa5,
+    0x2c,0x37,0x82,0xd1,0x35,0x4b,0xa1,0x8a,0x30,0x48,0xfb,0x74,0x42,0x78,0x01,0x00,
+    0x00,0xff,0xff,0x44,0xca,0xd1,0x09,0xc0,0x20,0x0c,0x04,0xd0,0xff,0x4e,0x11,0xb2,
+    0x80,0x0b,0xa8,0x2b,0x38,0x43,0xda,0x84,0x12,0x48,0xad,0x88,0x0a,0xdd,0xbe,0x52,
+    0x3f,0x7a,0x5f,0xef,0xb8,0x8b,0x1b,0xcc,0x78,0xd7,0x38,0x2e,0x4d,0x80,0x67,0x1d,
+    0x40,0xa6,0x67,0x0e,0x78,0x48,0x6e,0x52,0x71,0xad,0xdf,0xc3,0x68,0x17,0x8b,0x89,
+    0xd9,0xbb,0xc5,0x7f,0xd2,0x5c,0x7a,0x83,0xf6,0x14,0x09,0x58,0x89,0xf5,0x46,0xc8,
+    0x74,0xcd,0x52,0xa8,0x22,0x0c,0xb2,0x3e,0x9d,0x10,0x5e,0x00,0x00,0x00,0xff,0xff,
+    0x84,0x4d,0xcd,0x0e,0xc2,0x20,0x0c,0xbe,0xef,0x29,0x6a,0xef,0x64,0x2f,0x00,0x9c,
+    0xbd,0xfb,0x04,0x55,0xd8,0x24,0x22,0x10,0xec,0xb6,0xec,0xed,0xad,0xcc,0x69,0xe2,
+    0xc5,0x1e,0x9a,0x7e,0xbf,0xb5,0x1d,0xc8,0xe8,0x9e,0x9d,0x7d,0x5f,0xb9,0xf0,0x58,
+    0xf3,0x54,0x6c,0x27,0x6c,0x95,0x7d,0x50,0x0a,0x8e,0x94,0xdc,0xe3,0x4a,0x37,0x0f,
+    0x4a,0x09,0xf5,0xe2,0x9b,0x5b,0x62,0xa0,0x5d,0x98,0x81,0x62,0x18,0x93,0xc1,0x8b,
+    0x4f,0xec,0x2b,0x6e,0x6a,0x73,0xec,0x75,0x10,0xe9,0xec,0xa3,0xc1,0x4f,0x13,0xda,
+    0xdf,0xd7,0xff,0xcb,0x5a,0x87,0x3d,0xe5,0x81,0x17,0xaa,0x5e,0xf7,0x1b,0xfe,0xea,
+    0x21,0x95,0x89,0x81,0xd7,0xe2,0x0d,0x56,0x72,0x21,0x23,0x24,0xba,0x0b,0x18,0x62,
+    0x5e,0x10,0x66,0x8a,0x93,0x80,0x3d,0x8f,0xf0,0x04,0x00,0x00,0xff,0xff,0x44,0x8b,
+    0xcb,0x0d,0x80,0x20,0x10,0x44,0xef,0x56,0xb1,0xd9,0x06,0x68,0x00,0x38,0xdb,0xc6,
+    0x2a,0xab,0x21,0x59,0x81,0x10,0x3e,0xb1,0x7b,0x89,0xc4,0x38,0xa7,0x79,0x79,0x33,
+    0x76,0x81,0x11,0xad,0x8a,0xb3,0xb3,0x8d,0x02,0xda,0xf9,0x06,0x24,0xfe,0x0c,0x06,
+    0x77,0x0e,0x85,0x33,0x4e,0xfb,0x2e,0x84,0x36,0x16,0xbb,0x52,0x76,0x9d,0x32,0x6b,
+    0x35,0xf9,0xf7,0x3e,0xa4,0x5a,0xa0,0xdc,0x89,0x0d,0x66,0x72,0x3e,0x22,0x04,0xba,
+    0x06,0x1c,0x12,0x3b,0x42,0x23,0xa9,0x03,0xbe,0x3f,0xc2,0x03,0x00,0x00,0xff,0xff,
+    0x44,0x8b,0xd1,0x0d,0x80,0x20,0x0c,0x44,0xff,0x9d,0xa2,0xe9,0x02,0x2e,0x80,0xec,
+    0x52,0x6c,0x35,0x4d,0x2a,0x10,0x44,0x8d,0xdb,0x4b,0x24,0xc6,0xfb,0xba,0x97,0x77,
+    0xe7,0x07,0x68,0x71,0x63,0x65,0xdf,0x5b,0x2b,0xe0,0x58,0x4f,0x20,0xd3,0x35,0x4e,
+    0x38,0x4b,0xac,0x52,0xb0,0xdb,0x77,0x61,0x14,0xc4,0x3c,0xeb,0x4e,0xc1,0x84,0xdd,
+    0xd8,0xf9,0xf7,0x1a,0xf3,0x51,0xa1,0xde,0x59,0x26,0x2c,0xc4,0x9a,0x10,0x22,0x6d,
+    0x0d,0x16,0x4b,0x17,0xc2,0x49,0x76,0x34,0xf8,0xfe,0x08,0x0f,0x00,0x00,0x00,0xff,
+    0xff,0xbc,0x51,0x4b,0x0e,0xc2,0x20,0x10,0xdd,0xf7,0x14,0x23,0x7b,0x42,0xdc,0x9a,
+    0xc2,0xc2,0x78,0x04,0x2f,0x40,0xcb,0x58,0x49,0x28,0x34,0x40,0xbb,0xf0,0xf4,0x8e,
+    0x35,0x44,0x76,0x12,0x17,0xb2,0x98,0x3c,0xde,0x3c,0xe6,0xf3,0x50,0x1d,0xd0,0xe9,
+    0x45,0x36,0xea,0x8d,0x08,0x40,0x6f,0xec,0x06,0xda,0xd9,0xc9,0x4b,0x36,0xa2,0xcf,
+    0x18,0x99,0xaa,0x35,0x22,0x2c,0x79,0x8a,0x61,0x5d,0x54,0x47,0x6c,0xa4,0x78,0xe0,
+    0x1c,0x2e,0xe8,0xec,0x6c,0x49,0x0c,0x9c,0x13,0xf5,0xe2,0xbf,0x54,0xbc,0x17,0x89,
+    0xa0,0xb4,0x6a,0x1a,0xe2,0xcf,0x4f,0x7e,0xa8,0x5a,0xdd,0x2b,0x73,0xce,0x7a,0x35,
+    0x10,0x75,0xc6,0x46,0x73,0xf6,0xec,0xae,0x28,0x5e,0x83,0xd3,0x03,0x3a,0xc9,0xae,
+    0x51,0xfb,0x74,0x23,0x97,0xd3,0x82,0x68,0x4e,0x4c,0xb5,0xfe,0x60,0xf3,0xfe,0x9f,
+    0xde,0x09,0x1d,0x8e,0x19,0xbc,0x9e,0x51,0xb2,0x81,0x56,0x60,0x90,0xec,0x83,0xf0,
+    0xb1,0x52,0x95,0x29,0x6d,0xf0,0xf0,0x04,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,
+    0x29,0x4d,0xb5,0x55,0xb2,0x34,0x33,0x30,0x50,0xb2,0x53,0x50,0x00,0xd1,0x0a,0x4e,
+    0x89,0xa5,0x29,0x36,0xfa,0xf9,0x05,0x25,0x99,0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,
+    0x06,0x22,0xa8,0x00,0x00,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,0x29,0x4d,0xb5,
+    0x55,0x32,0xb4,0x34,0x32,0x30,0x50,0xb2,0x53,0x00,0xd3,0x0a,0x4e,0x89,0xa5,0x29,
+    0x36,0xfa,0xf9,0x05,0x25,0x99,0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,0x06,0x22,0xa8,
+    0x00,0x00,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,0x29,0x4d,0xb5,0x55,0x32,0xb6,
+    0x30,0x31,0x30,0x50,0xb2,0x53,0x00,0xd3,0x0a,0x4e,0x89,0xa5,0x29,0x36,0xfa,0xf9,
+    0x05,0x25,0x99,0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,0x06,0x22,0xa8,0x00,0x00,0x00,
+    0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,0x29,0x4d,0xb5,0x55,0x32,0x35,0x37,0x33,0x30,
+    0x50,0xb2,0x53,0x00,0xd3,0x0a,0x4e,0x89,0xa5,0x29,0x36,0xfa,0xf9,0x05,0x25,0x99,
+    0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,0x06,0x22,0xa8,0x00,0x00,0x00,0x00,0xff,0xff,
+    0x52,0x28,0x4b,0xcc,0x29,0x4d,0xb5,0x55,0x32,0x37,0xb1,0xb0,0x30,0x50,0xb2,0x53,
+    0x00,0xd3,0x0a,0x4e,0x89,0xa5,0x29,0x36,0xfa,0xf9,0x05,0x25,0x99,0xf9,0x79,0x76,
+    0x5c,0x0a,0x48,0xc0,0x06,0x22,0xa8,0x00,0x00,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,
+    0xcc,0x29,0x4d,0xb5,0x55,0x32,0x34,0x34,0x35,0x32,0x30,0x50,0xb2,0x33,0x84,0x30,
+    0x14,0x9c,0x12,0x4b,0x53,0x6c,0xf4,0xf3,0x0b,0x4a,0x32,0xf3,0xf3,0xec,0xb8,0x14,
+    0x90,0x80,0x0d,0x44,0x50,0x01,0x00,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,0x29,
+    0x4d,0xb5,0x55,0x32,0x32,0x36,0x30,0x31,0x30,0x50,0xb2,0x83,0xd0,0x0a,0x4e,0x89,
+    0xa5,0x29,0x36,0xfa,0xf9,0x05,0x25,0x99,0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,0x06,
+    0x22,0xa8,0x00,0x00,0x00,0x00,0xff,0xff,0x52,0x28,0x4b,0xcc,0x29,0x4d,0xb5,0x55,
+    0x32,0x31,0x33,0xb0,0x30,0x30,0x50,0xb2,0x83,0xd0,0x0a,0x4e,0x89,0xa5,0x29,0x36,
+    0xfa,0xf9,0x05,0x25,0x99,0xf9,0x79,0x76,0x5c,0x0a,0x48,0xc0,0x06,0x22,0xa8,0x00,
+    0x00,0x00,0x00,0xff,0xff,0x8c,0x90,0xc1,0x0a,0xc2,0x30,0x0c,0x86,0xef,0x3e,0x45,
+    0xcc,0xbd,0x74,0x7a,0x10,0x94,0x6e,0xa0,0x8f,0x30,0x14,0xbc,0x76,0x5b,0x1d,0x85,
+    0xda,0x95,0x9a,0x8e,0xf9,0xf6,0x46,0xb7,0xa1,0x20,0x82,0x39,0x24,0xe1,0xe3,0xcf,
+    0xff,0x43,0xa0,0xd7,0x2e,0x99,0x1c,0xb7,0xeb,0xd5,0x26,0xcb,0xb0,0x18,0x27,0x1c,
+    0x74,0x6a,0x94,0xec,0x02,0xd9,0xce,0x17,0x0b,0x98,0x4a,0xc9,0x9b,0x71,0xa6,0xa6,
+    0x91,0x28,0x49,0xcd,0xbc,0xb1,0xb2,0x8d,0x5d,0x0a,0xc5,0x82,0x69,0xe4,0xbe,0x14,
+    0x02,0xca,0x33,0x44,0xeb,0x5b,0x10,0x82,0xc1,0x93,0xbe,0xb4,0x7c,0x04,0xaa,0xb1,
+    0x3d,0x68,0x67,0x5b,0x9f,0x63,0x6d,0x3c,0x99,0x88,0x1f,0x29,0xb3,0x19,0x38,0x5d,
+    0x19,0x97,0xe3,0x69,0x5f,0x1e,0x67,0xb3,0x1d,0x7e,0x85,0xff,0x32,0x54,0x92,0x61,
+    0xf1,0x87,0xf0,0x9d,0x6c,0x7d,0x48,0x04,0x74,0x0f,0xfc,0x11,0x32,0x03,0x21,0x78,
+    0x7d,0xe5,0x3d,0x0e,0x55,0xba,0x20,0x4c,0xbf,0x7a,0x00,0x00,0x00,0xff,0xff,0x84,
+    0x50,0x31,0x0e,0x83,0x30,0x0c,0xdc,0x79,0x85,0xeb,0x3d,0x65,0xe9,0x54,0x05,0xde,
+    0xd0,0x2f,0x04,0xb0,0xd2,0x88,0x10,0x22,0x30,0x08,0xfa,0xfa,0x9a,0x00,0x52,0x25,
+    0x86,0x66,0xb0,0x7c,0x17,0xfb,0xce,0x36,0xc2,0xe8,0x3e,0x54,0xe0,0x03,0xa1,0x33,
+    0x8b,0xa7,0x60,0xf9,0xbd,0xa1,0x32,0x83,0xe3,0x69,0x6f,0x2a,0xf2,0x65,0xb5,0x32,
+    0x8d,0x3a,0xdf,0x41,0xfa,0xd4,0x39,0x37,0x67,0xd6,0x47,0xb6,0x43,0x3f,0xc5,0x32,
+    0x13,0x76,0x90,0x78,0x53,0x0a,0x5e,0xa6,0x6e,0x89,0x47,0x50,0x4a,0x88,0x8d,0x4d,
+    0xb5,0xd2,0x04,0xba,0x71,0x33,0x18,0xef,0x6c,0x28,0xb0,0xa6,0xc0,0x34,0xfc,0x1a,
+    0x9e,0x62,0x90,0xcc,0x0a,0x3c,0x74,0x9e,0x78,0xf1,0xfd,0xaf,0xb5,0xcf,0x2b,0xab,
+    0xdd,0xe1,0xba,0x41,0xaa,0x70,0x21,0x4e,0x0c,0xbc,0x46,0xb9,0x02,0xd3,0xc2,0x08,
+    0xc1,0x74,0x92,0xc7,0x96,0xa5,0x0d,0x61,0x36,0x7e,0x12,0xf8,0x05,0x00,0x00,0xff,
+    0xff,0x44,0x8d,0x41,0x0e,0x83,0x40,0x08,0x45,0xf7,0x3d,0x05,0x61,0xd5,0xae,0x5c,
+    0x74,0x3b,0x7a,0x17,0xac,0xc4,0x92,0x32,0x74,0xa2,0x68,0xac,0xa7,0x17,0xdb,0x49,
+    0xca,0xea,0xf1,0x79,0xe4,0x23,0xcc,0xb2,0x73,0x8b,0x77,0x84,0x4c,0x9b,0xb2,0x8d,
+    0xfe,0x3c,0xb7,0xee,0x02,0x31,0xa9,0xf1,0xa1,0x52,0x00,0xa4,0x41,0x56,0x20,0x95,
+    0xd1,0x5a,0x7c,0xb0,0x39,0x4f,0xd5,0xfb,0x1a,0x4a,0x3d,0x6b,0xe7,0x92,0xf9,0xbd,
+    0x38,0x5c,0xf3,0x7c,0x4b,0xcd,0x2f,0xfb,0x3b,0x62,0x25,0x6e,0xfe,0x29,0x51,0xe9,
+    0xbc,0x39,0x82,0x51,0x0e,0x2e,0x2f,0xaf,0x8f,0x08,0x2b,0xe9,0x12,0xd1,0x01,0x00,
+    0x00,0xff,0xff,0x44,0x8d,0x41,0x0e,0xc2,0x40,0x08,0x45,0xf7,0x9e,0x82,0xb0,0xd2,
+    0x85,0x69,0x5c,0xb8,0x9b,0xe9,0x5d,0xd0,0x21,0x95,0xc8,0xe0,0x44,0x69,0xd3,0x7a,
+    0x7a,0xb1,0x36,0x91,0xd5,0x83,0xff,0xc2,0x47,0x78,0xc9,0x9b,0x33,0x9e,0x11,0x2a,
+    0xcd,0xca,0x36,0xf8,0xed,0xbb,0xf5,0x3b,0x88,0x49,0x9d,0x97,0x8d,0x02,0x20,0x15,
+    0x99,0x80,0x54,0x06,0xcb,0x78,0x65,0x73,0x7e,0x6e,0xde,0x6a,0x28,0x5d,0x58,0xfb,
+    0xc2,0x2a,0x55,0x22,0x82,0xfd,0xf1,0x04,0x19,0xec,0x61,0x7c,0x48,0xdd,0x2f,0xfc,
+    0xcb,0x62,0x6d,0x74,0xf0,0xa5,0x45,0xb7,0xf3,0xec,0x08,0x46,0x35,0xb8,0xdd,0x7d,
+    0xfd,0x80,0x30,0x91,0x8e,0x71,0xf8,0x00,0x00,0x00,0xff,0xff,0xdc,0x90,0xbf,0x6e,
+    0x84,0x30,0x0c,0xc6,0x77,0x9e,0xc2,0x65,0xac,0x8a,0x18,0xba,0x72,0x4c,0x95,0xaa,
+    0x9b,0x5a,0xf5,0xfa,0x02,0x06,0x0c,0x44,0x0d,0x31,0x4a,0x0c,0x85,0x3e,0x7d,0x1d,
+    0x74,0xff,0x86,0xd3,0xa9,0x73,0x33,0xc4,0xf6,0x67,0xff,0xe4,0xe4,0x4b,0x21,0x98,
+    0x1f,0xda,0xa5,0xcf,0x29,0x0c,0xb8,0x58,0x72,0x9d,0xf4,0xb1,0x2a,0x13,0xd0,0x53,
+    0xe4,0xd2,0x9c,0x32,0x1e,0xa5,0xf3,0x3c,0x8d,0x65,0xa2,0xaa,0xd7,0xfb,0x21,0xcb,
+    0xe0,0x85,0xac,0x19,0x8c,0x90,0x87,0x2c,0x53,0x29,0xea,0xdb,0xb4,0x62,0x50,0x34,
+    0x66,0x06,0xb4,0xa6,0x73,0xbb,0xb4,0x26,0xa7,0x43,0xa9,0x8a,0xfd,0x69,0x24,0xd7,
+    0x76,0x79,0xb5,0xe0,0x9f,0x20,0x47,0x73,0x72,0xc1,0xca,0x92,0x26,0x37,0xc0,0xa4,
+    0x30,0x6e,0x9c,0x04,0x64,0x1d,0xd5,0xf9,0x30,0x55,0xea,0x60,0x0a,0x0e,0x07,0xad,
+    0x7c,0xd0,0x74,0x46,0x3b,0xc5,0x9c,0x02,0x09,0xb4,0xec,0x87,0xfb,0x0c,0x7f,0x9d,
+    0x91,0x9a,0x07,0x6d,0x80,0x72,0x62,0x5c,0x17,0xee,0x73,0x2d,0xd6,0xc2,0x7e,0x3d,
+    0xc3,0xc7,0xfa,0x8f,0x74,0x6d,0x39,0xd0,0x65,0xf1,0x56,0xc5,0x8f,0x47,0x2b,0x34,
+    0xc4,0x67,0x6b,0xac,0x7c,0x79,0xd3,0x82,0xc7,0x7d,0x0b,0x2b,0x4f,0xba,0xcb,0x52,
+    0x2d,0x70,0xe0,0x56,0xbe,0xd1,0x53,0x76,0x20,0x6f,0xd0,0x3e,0x6d,0x3d,0xb4,0x81,
+    0xa1,0xc7,0x99,0x40,0x18,0xc2,0x48,0xb5,0x69,0xd7,0x04,0x10,0x5e,0xdf,0xf7,0x6f,
+    0x51,0x9a,0x02,0x01,0x06,0xf8,0x58,0x00,0x5d,0x03,0xec,0xe8,0x4a,0xfc,0x5c,0x2e,
+    0x4f,0xa9,0xb8,0x59,0x63,0xec,0x65,0xb0,0x65,0xf2,0x0b,0x00,0x00,0xff,0xff,
+};
+
+static const pageTemplatePart webAssetComSettingsParts[] PROGMEM =
+{
+    {     0,   340,   797, 0xd8ad552f, 0xc69ae12d, 0x0000, WEB_VALUE_CHECKED_SON },
+    {   340,   100,   118, 0x38c78c5d, 0x3f0395b4, 0x0003, WEB_VALUE_CHECKED_SON },
+    {   440,   135,   229, 0xbd261134, 0x9a771f6b, 0x0007, WEB_VALUE_CHECKED_PROTOCOL },
+    {   575,    93,   104, 0x070cbd85, 0xd777606e, 0x0009, WEB_VALUE_CHECKED_PROTOCOL },
+    {   668,   136,   207, 0x4effa188, 0xc76dfa79, 0x0000, WEB_VALUE_CHECKED_UDP_SEQUENCE },
+    {   804,    92,   104, 0xfe2d12c4, 0xd777606e, 0x0003, WEB_VALUE_CHECKED_UDP_SEQUENCE },
+    {   896,   155,   266, 0x45b27a22, 0x8ea1e6a6, 0x000b, WEB_VALUE_CHECKED_COM_TYPE },
+    {  1051,    99,   130, 0x557e2efd, 0xc5178b8d, 0x0014, WEB_VALUE_CHECKED_COM_TYPE },
+    {  1150,   176,   540, 0xe4c23936, 0x6d9c9af5, 0x001d, WEB_VALUE_CHECKED_OPERATIONMODE },
+    {  1326,    98,   116, 0x316280e9, 0xf5449b3f, 0x001f, WEB_VALUE_CHECKED_OPERATIONMODE },
+    {  1424,   129,   230, 0x6622b17d, 0xdafacfcf, 0xffff, WEB_VALUE_TARGET_IP },
+    {  1553,   194,   590, 0xe29ac519, 0x232e75c3, 0x0021, WEB_VALUE_CHECKED_GPIO_RX },
+    {  1747,    99,   122, 0xa6301f93, 0xf483dd28, 0x0024, WEB_VALUE_CHECKED_GPIO_RX },
+    {  1846,   100,   126, 0x432bfa1e, 0x4aa9dc3f, 0x0027, WEB_VALUE_CHECKED_GPIO_RX },
+    {  1946,   111,   169, 0xc19408f8, 0x088c4f1e, 0x002a, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2057,   100,   126, 0x6af4f283, 0x4aa9dc3f, 0x002d, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2157,    99,   122, 0x335b54b5, 0xf483dd28, 0x0030, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2256,   112,   173, 0x758673b0, 0x52edb524, 0x0033, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2368,   100,   122, 0xc0c85588, 0xf483dd28, 0x0036, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2468,   100,   126, 0x74a2b0ee, 0x4aa9dc3f, 0x0039, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2568,   112,   169, 0xf61d4208, 0x088c4f1e, 0x003c, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2680,   100,   126, 0xd640b138, 0x4aa9dc3f, 0x003f, WEB_VALUE_CHECKED_GPIO_RX },
+    {  2780,   156,   290, 0x0236d2f9, 0xd3052a2d, 0x0021, WEB_VALUE_CHECKED_GPIO_TX },
+    {  2936,    99,   122, 0x3bec1480, 0xf483dd28, 0x0024, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3035,   101,   126, 0xdef7f10d, 0x4aa9dc3f, 0x0027, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3136,   112,   169, 0x5c4803eb, 0x088c4f1e, 0x002a, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3248,   101,   126, 0xf728f990, 0x4aa9dc3f, 0x002d, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3349,    99,   122, 0xae875fa6, 0xf483dd28, 0x0030, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3448,   112,   173, 0xe85a78a3, 0x52edb524, 0x0033, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3560,   100,   122, 0x5d145e9b, 0xf483dd28, 0x0036, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3660,   101,   126, 0xe97ebbfd, 0x4aa9dc3f, 0x0039, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3761,   112,   169, 0x6bc1491b, 0x088c4f1e, 0x003c, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3873,   101,   126, 0x4b9cba2b, 0x4aa9dc3f, 0x003f, WEB_VALUE_CHECKED_GPIO_TX },
+    {  3974,   164,   565, 0x260ad798, 0x23f455b6, 0x0042, WEB_VALUE_CHECKED_DATALEN },
+    {  4138,    93,   121, 0x3f72f37e, 0x57687916, 0x0044, WEB_VALUE_CHECKED_DATALEN },
+    {  4231,    93,   121, 0x8dc80104, 0x57687916, 0x0046, WEB_VALUE_CHECKED_DATALEN },
+    {  4324,   141,   247, 0x0739c75e, 0x84ba4818, 0x0048, WEB_VALUE_CHECKED_STOPBIT },
+    {  4465,    96,   125, 0xaad03065, 0x76797e64, 0x004a, WEB_VALUE_CHECKED_STOPBIT },
+    {  4561,   133,   234, 0x99eddee6, 0x3c881dd0, 0x004c, WEB_VALUE_CHECKED_PARITY },
+    {  4694,    93,   119, 0xef4bfe2e, 0xcc337400, 0x004e, WEB_VALUE_CHECKED_PARITY },
+    {  4787,    93,   118, 0x90cfe853, 0x3f0395b4, 0x0050, WEB_VALUE_CHECKED_PARITY },
+    {  4880,   142,   254, 0xb09d9e6c, 0x8f766b71, 0x0052, WEB_VALUE_CHECKED_FLOWCTRL },
+    {  5022,    98,   131, 0x8b3e73e3, 0x93cce816, 0x005b, WEB_VALUE_CHECKED_FLOWCTRL },
+    {  5120,    97,   131, 0xccc31ff5, 0x93cce816, 0x0064, WEB_VALUE_CHECKED_FLOWCTRL },
+    {  5217,   171,   591, 0xdf0cf3db, 0x024ebd7f, 0x006d, WEB_VALUE_SELECTED_BAUD },
+    {  5388,    45,    55, 0xb4ab2a33, 0x88a7fae9, 0x0072, WEB_VALUE_SELECTED_BAUD },
+    {  5433,    45,    56, 0xf00992b4, 0xd95efd26, 0x0078, WEB_VALUE_SELECTED_BAUD },
+    {  5478,    45,    56, 0x697636ea, 0xd95efd26, 0x007e, WEB_VALUE_SELECTED_BAUD },
+    {  5523,    45,    56, 0x9d79f5d4, 0xd95efd26, 0x0084, WEB_VALUE_SELECTED_BAUD },
+    {  5568,    45,    56, 0x74698647, 0xd95efd26, 0x008a, WEB_VALUE_SELECTED_BAUD },
+    {  5613,    46,    58, 0xf5a5b825, 0x00d2d4db, 0x0091, WEB_VALUE_SELECTED_BAUD },
+    {  5659,    45,    57, 0xc80f4116, 0xd2d4db00, 0x0098, WEB_VALUE_SELECTED_BAUD },
+    {  5704,    45,    57, 0x7444f705, 0xd2d4db00, 0x009f, WEB_VALUE_SELECTED_BAUD },
+    {  5749,   170,   308, 0x21e687e4, 0x1958399e, 0xffff, WEB_VALUE_RX_BUFSIZE },
+    {  5919,   162,   297, 0xeacd35c6, 0xf45ce70b, 0xffff, WEB_VALUE_PACKET_MAXBYTES },
+    {  6081,   114,   154, 0x956fbbfc, 0x8d0059a1, 0xffff, WEB_VALUE_PACKET_TIMEOUT },
+    {  6195,   121,   161, 0x8995e247, 0xd56eef03, 0xffff, WEB_VALUE_PACKET_DELIMITER },
+    {  6316,   275,   754, 0x119b6e73, 0x1645c8b5, 0xffff, PAGE_TEMPLATE_NO_VALUE },
+};
+
+static const pageTemplateAsset webAssetComSettings =
+{
+    "comsettings.html", webAssetComSettingsData, webAssetComSettingsParts, webAssetArgs,
+    58, 0xbfeacd5a
+};
+
+#endif // _WEB_ASSETS_
@@ -0,0 +1,395 @@
+//
+// ************************************************************************
+// SimpleLog
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   A simple library to provide printf-like output to any stream object.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/10/28: initial version 
+// 2016/12/20: format engine moved to SimpleLogFormat, complete printf()
+//             syntax (flags, width, precision, length modifiers)
+// 2016/12/22: output is distributed to several sinks, each with its
+//             own loglevel
+// 
+//
+// ************************************************************************
+//
+
+
+#include "SimpleLog.h"
+
+//
+// ************************************************************************
+// Initialize a SimpleLog instance 
+//   - this is necessary for later output the log information
+//
+// Expected arguments:
+// - int level
+//   the loglevel of the SimpleLog instance. It's checked against
+//   the logtype of each log message
+//
+// - Stream *output
+//   a pointer to a valid stream object that receives the log
+//   messages. The stream is registered as the first sink of the
+//   instance, further sinks may be added with AddSink().
+//
+// Returns an integer as status code:
+// - SIMPLE_LOG_SUCCESS on succes, or
+// depending of the failure that occurred 
+// - SIMPLE_LOG_STREAM_INVALif stream is NULL or
+// - SIMPLE_LOG_LOGLEVEL_INVAL if given loglevel is invalid.
+//
+// ************************************************************************
+//
+int SimpleLog::Init(int level, Stream *output)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+
+  if( (retVal = SetLevel(level)) == SIMPLE_LOG_SUCCESS )
+  {
+    _streamSink.SetStream(output);
+
+    if( output == NULL )
+    {
+      RemoveSink(&_streamSink);
+      retVal = SIMPLE_LOG_STREAM_INVAL;
+    }
+    else
+    {
+      AddSink(&_streamSink);
+    }
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// SimpleLog::Begin() does exactly the same as SimpleLog::Init() by
+// calling SimpleLog::Init() itself and returns the status of
+// the call.
+// ************************************************************************
+//
+int SimpleLog::Begin(int level, Stream *output)
+{
+  return( Init(level, output) );
+}
+
+//
+// ************************************************************************
+// Sets the loglevel of the SimpleLog instance. 
+// - This may be used for dynamically enable/disable logging and/or 
+//   increase/reduce the amount of processed log information.
+//
+// Expected argument:
+// - int newLevel
+//   the new loglevel of the SimpleLog instance. It's checked against
+//   the logtype of each log message
+//
+// Returns an integer as status code:
+// - SIMPLE_LOG_SUCCESS on succes, or
+// depending of the failure that occurred 
+// - SIMPLE_LOG_LOGLEVEL_INVAL if given loglevel is invalid.
+//
+// ************************************************************************
+//
+int SimpleLog::SetLevel(int newLevel)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+
+  if( newLevel >= LOGLEVEL_QUIET && 
+      newLevel <= LOGLEVEL_ALL_BITS )
+  {
+    _level = newLevel;
+  }
+  else
+  {
+    retVal = SIMPLE_LOG_LOGLEVEL_INVAL;
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// Register an additional sink, e.g. a ring buffer or a syslog sender.
+// Registering a sink twice has no effect.
+//
+// Expected argument:
+// - SimpleLogSink *sink
+//   the sink that receives all records matching its own loglevel and
+//   the loglevel of the SimpleLog instance.
+//
+// Returns an integer as status code:
+// - SIMPLE_LOG_SUCCESS on succes, or
+// depending of the failure that occurred 
+// - SIMPLE_LOG_SINK_INVAL if sink is NULL or
+// - SIMPLE_LOG_SINKS_FULL if SIMPLE_LOG_MAX_SINKS are registered.
+//
+// ************************************************************************
+//
+int SimpleLog::AddSink(SimpleLogSink *sink)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+  int i;
+
+  if( sink == NULL )
+  {
+    retVal = SIMPLE_LOG_SINK_INVAL;
+  }
+  else
+  {
+    for( i = 0; i < _numSinks && _sinks[i] != sink; i++ )
+      ;
+
+    if( i == _numSinks )
+    {
+      if( _numSinks < SIMPLE_LOG_MAX_SINKS )
+      {
+        _sinks[_numSinks++] = sink;
+      }
+      else
+      {
+        retVal = SIMPLE_LOG_SINKS_FULL;
+      }
+    }
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// Unregister a sink. Returns SIMPLE_LOG_SINK_INVAL if the sink is not
+// registered, SIMPLE_LOG_SUCCESS otherwise.
+// ************************************************************************
+//
+int SimpleLog::RemoveSink(SimpleLogSink *sink)
+{
+  int retVal = SIMPLE_LOG_SINK_INVAL;
+  int i;
+
+  for( i = 0; i < _numSinks; i++ )
+  {
+    if( _sinks[i] == sink )
+    {
+      for( ; i < _numSinks - 1; i++ )
+      {
+        _sinks[i] = _sinks[i + 1];
+      }
+
+      _numSinks--;
+      retVal = SIMPLE_LOG_SUCCESS;
+      break;
+    }
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// Sets the loglevel of a sink. Same values and return codes as
+// SimpleLog::SetLevel().
+// ************************************************************************
+//
+int SimpleLogSink::SetLevel(int newLevel)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+
+  if( newLevel >= LOGLEVEL_QUIET && 
+      newLevel <= LOGLEVEL_ALL_BITS )
+  {
+    _level = newLevel;
+  }
+  else
+  {
+    retVal = SIMPLE_LOG_LOGLEVEL_INVAL;
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// SimpleLogStreamSink writes each block to its stream in one call
+// ************************************************************************
+//
+void SimpleLogStreamSink::Write(const char *data, size_t len)
+{
+  if( _strOut != NULL )
+  {
+    _strOut->write((const uint8_t *) data, len);
+  }
+}
+
+//
+// ************************************************************************
+// public method to send a log message to the registered sinks
+// - Check whether or not an output has to be done for the given type of
+//   log message. In case of yes, send a matching prefix to each sink
+//   whose own loglevel matches, too. The message is formatted once and
+//   the same blocks are handed to all of these sinks.
+//
+// Expected argument:
+// - int loglevel
+//   the logtype of the log message
+// - char *msg
+//   the message to be send containing the format descriptors
+// - a variable number of arguments, matching the format descriptors
+//
+// Returns an integer as status code:
+// - SIMPLE_LOG_SUCCESS on succes, or
+// depending of the failure that occurred 
+// - SIMPLE_LOG_LOGLEVEL_INVAL if given loglevel is invalid.
+//
+// ************************************************************************
+//
+int SimpleLog::Log(int logLevel, const char* msg, ...)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+  const char *prefix = NULL;
+  int i;
+
+  if( _numSinks > 0 )
+  {
+    if( logLevel >= LOGLEVEL_QUIET && 
+        logLevel <= LOGLEVEL_ALL_BITS )
+    {
+      // select the sinks that take this record
+      _activeSinks = 0;
+
+      for( i = 0; i < _numSinks; i++ )
+      {
+        if( _level & logLevel & _sinks[i]->GetLevel() )
+        {
+          _activeSinks |= (1u << i);
+        }
+      }
+
+      switch( _level & logLevel )
+      {
+        case LOGLEVEL_CRITICAL:
+          prefix = "CRITICAL: ";
+          break;
+        case LOGLEVEL_ERROR:
+          prefix = "ERROR: ";
+          break;
+        case LOGLEVEL_WARNING:
+          prefix = "WARNING: ";
+          break;
+        case LOGLEVEL_DEBUG:
+          prefix = "DEBUG: ";
+          break;
+        case LOGLEVEL_INFO:
+          prefix = "INFO: ";
+          break;
+      }
+
+      if( _activeSinks != 0 )
+      {
+        for( i = 0; i < _numSinks; i++ )
+        {
+          if( _activeSinks & (1u << i) )
+          {
+            _sinks[i]->BeginRecord(_level & logLevel);
+          }
+        }
+
+        if( prefix != NULL )
+        {
+          logWrite(this, prefix, strlen(prefix));
+        }
+
+        va_list args;
+        va_start(args, msg);
+        retVal = logPrint(msg,args);
+        va_end(args);
+
+        for( i = 0; i < _numSinks; i++ )
+        {
+          if( _activeSinks & (1u << i) )
+          {
+            _sinks[i]->EndRecord();
+          }
+        }
+      }
+    }
+    else
+    {
+      retVal = SIMPLE_LOG_LOGLEVEL_INVAL;
+    }
+  }
+  else
+  {
+    retVal = SIMPLE_LOG_STREAM_INVAL;
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// Private callback for the format engine, receives the formatted
+// output in blocks and hands each block to all sinks taking the
+// current record
+// ************************************************************************
+//
+void SimpleLog::logWrite(void *ctx, const char *data, size_t len)
+{
+  SimpleLog *log = (SimpleLog *) ctx;
+  int i;
+
+  for( i = 0; i < log->_numSinks; i++ )
+  {
+    if( log->_activeSinks & (1u << i) )
+    {
+      log->_sinks[i]->Write(data, len);
+    }
+  }
+}
+
+//
+// ************************************************************************
+// Private function that writes the log information to the sinks
+// - formatting is done by slFormat(), see SimpleLogFormat.h for the
+//   supported format descriptors
+// ************************************************************************
+//
+int SimpleLog::logPrint(const char *format, va_list args) 
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+
+  if( _activeSinks != 0 )
+  {
+    slFormat(logWrite, this, format, args);
+  }
+  else
+  {
+    retVal = SIMPLE_LOG_STREAM_INVAL;
+  }
+
+  return( retVal );
+}
+ 
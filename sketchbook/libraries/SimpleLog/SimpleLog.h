@@ -0,0 +1,102 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+#include <inttypes.h>
+#include <stdarg.h>
+#include "SimpleLogFormat.h"
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+extern "C" {
+}
+
+#define LOGLEVEL_QUIET        0
+#define LOGLEVEL_CRITICAL     1
+#define LOGLEVEL_ERROR        2
+#define LOGLEVEL_WARNING      4
+#define LOGLEVEL_DEBUG        8
+#define LOGLEVEL_INFO        16
+
+#define LOGLEVEL_ALL_BITS    ( LOGLEVEL_QUIET | \
+                               LOGLEVEL_CRITICAL | \
+                               LOGLEVEL_ERROR | \
+                               LOGLEVEL_WARNING | \
+                               LOGLEVEL_DEBUG | \
+                               LOGLEVEL_INFO )
+
+
+#define LOGLEVEL_DEFAULT     LOGLEVEL_DEBUG
+
+// return values for the several functions. After changing all function types from void to int this allows a better error handling for the log-functions themselves.
+
+#define SIMPLE_LOG_SUCCESS         0
+#define SIMPLE_LOG_STREAM_INVAL   -1
+#define SIMPLE_LOG_LOGLEVEL_INVAL -2
+#define SIMPLE_LOG_ARG_MISMATCH   -3
+#define SIMPLE_LOG_SINK_INVAL     -4
+#define SIMPLE_LOG_SINKS_FULL     -5
+
+// max. number of sinks a SimpleLog instance distributes its output to
+
+#ifndef SIMPLE_LOG_MAX_SINKS
+#define SIMPLE_LOG_MAX_SINKS       4
+#endif
+
+//
+// A sink receives the log records of a SimpleLog instance. Each sink has
+// its own loglevel that is checked in addition to the loglevel of the
+// SimpleLog instance. A record is handed over as BeginRecord(), one or
+// more Write() calls with blocks of formatted text and EndRecord().
+//
+class SimpleLogSink {
+protected:
+    int _level;
+public:
+    SimpleLogSink(int level = LOGLEVEL_ALL_BITS) : _level(level) {};
+    virtual ~SimpleLogSink() {};
+    int SetLevel(int level = LOGLEVEL_ALL_BITS);
+    int GetLevel() { return( _level ); };
+    virtual void BeginRecord(int level) {};
+    virtual void Write(const char *data, size_t len) = 0;
+    virtual void EndRecord() {};
+};
+
+//
+// sink writing to any stream object, e.g. Serial
+//
+class SimpleLogStreamSink : public SimpleLogSink {
+private:
+    Stream *_strOut;
+public:
+    SimpleLogStreamSink(Stream *output = NULL, int level = LOGLEVEL_ALL_BITS) :
+        SimpleLogSink(level), _strOut(output) {};
+    void SetStream(Stream *output) { _strOut = output; };
+    Stream *GetStream() { return( _strOut ); };
+    virtual void Write(const char *data, size_t len);
+};
+
+class SimpleLog {
+private:
+    int _level;
+    SimpleLogStreamSink _streamSink;
+    SimpleLogSink *_sinks[SIMPLE_LOG_MAX_SINKS];
+    int _numSinks;
+    unsigned int _activeSinks;
+public:
+    SimpleLog() : _level(LOGLEVEL_DEFAULT), _numSinks(0), _activeSinks(0) {};
+    int Init(int level = LOGLEVEL_DEBUG, Stream *output = NULL);
+    int Begin(int level = LOGLEVEL_DEBUG, Stream *output = NULL);
+    int SetLevel(int level = LOGLEVEL_DEBUG);
+    int AddSink(SimpleLogSink *sink);
+    int RemoveSink(SimpleLogSink *sink);
+    SimpleLogStreamSink *StreamSink() { return( &_streamSink ); };
+    int Log(int level, const char *format, ...);
+private:
+    int logPrint(const char *format, va_list args);
+    static void logWrite(void *ctx, const char *data, size_t len);
+};
+
+#endif
@@ -0,0 +1,1273 @@
+//
+// ************************************************************************
+// SimpleLog
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   printf()-compatible, allocation free format engine of SimpleLog.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/10/28: initial version
+// 2017/01/01: plain %d, %u and %x without padding, literal text and
+//             conversion chars without a library call
+//
+//
+// ************************************************************************
+//
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "SimpleLogFormat.h"
+
+//
+// ************************************************************************
+// flags of a conversion specification
+// ************************************************************************
+//
+#define SL_FLAG_LEFT          0x01
+#define SL_FLAG_PLUS          0x02
+#define SL_FLAG_SPACE         0x04
+#define SL_FLAG_ALT           0x08
+#define SL_FLAG_ZERO          0x10
+//
+// length modifiers that need more than one char or are ambiguous
+//
+#define SL_LEN_NONE           0
+#define SL_LEN_CHAR           1   // hh
+#define SL_LEN_SHORT          2   // h
+#define SL_LEN_LONG           3   // l
+#define SL_LEN_LLONG          4   // ll
+#define SL_LEN_INTMAX         5   // j
+#define SL_LEN_SIZE           6   // z
+#define SL_LEN_PTRDIFF        7   // t
+#define SL_LEN_LDOUBLE        8   // L
+//
+// enough room for 64 binary digits
+//
+#define SL_INT_BUFSIZE       66
+//
+// max. significant digits generated for floating point values
+//
+#define SL_FLT_MAX_DIGITS    17
+//
+// the fast path for %f handles values below this limit with
+// a precision of up to SL_FLT_FAST_PREC digits
+//
+#define SL_FLT_FAST_LIMIT    1e18
+#define SL_FLT_FAST_PREC      9
+
+struct slOut
+{
+    slWriteFunc write;
+    void *ctx;
+    char *buf;
+    size_t cap;
+    size_t len;
+    int total;
+};
+
+struct slSpec
+{
+    int flags;
+    int width;
+    int prec;
+    int length;
+    char conv;
+};
+
+static const char slDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char slHexLower[] = "0123456789abcdef";
+static const char slHexUpper[] = "0123456789ABCDEF";
+
+static const double slPow10[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const uint64_t slPow10Int[] =
+{
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL
+};
+
+//
+// ************************************************************************
+// output helpers
+// - with a write function the buffer is handed over whenever it is full,
+//   without one (slVsnprintf) excess output is only counted
+// ************************************************************************
+//
+static void outFlush(slOut *o)
+{
+    if( o->write != NULL && o->len > 0 )
+    {
+        o->write(o->ctx, o->buf, o->len);
+        o->len = 0;
+    }
+}
+
+static inline void outChar(slOut *o, char c)
+{
+    if( o->len >= o->cap )
+    {
+        outFlush(o);
+    }
+
+    if( o->len < o->cap )
+    {
+        o->buf[o->len++] = c;
+    }
+
+    o->total++;
+}
+
+static void outData(slOut *o, const char *data, size_t n)
+{
+    size_t chunk;
+
+    o->total += (int) n;
+
+    // the common case, a short piece that fits
+    if( n <= o->cap - o->len )
+    {
+        memcpy(o->buf + o->len, data, n);
+        o->len += n;
+        return;
+    }
+
+    // large blocks go to the write function directly
+    if( o->write != NULL && n >= o->cap )
+    {
+        outFlush(o);
+        o->write(o->ctx, data, n);
+        return;
+    }
+
+    while( n > 0 )
+    {
+        if( o->len >= o->cap )
+        {
+            outFlush(o);
+
+            if( o->len >= o->cap )
+            {
+                return;
+            }
+        }
+
+        chunk = o->cap - o->len;
+        if( chunk > n )
+        {
+            chunk = n;
+        }
+
+        memcpy(o->buf + o->len, data, chunk);
+        o->len += chunk;
+        data += chunk;
+        n -= chunk;
+    }
+}
+
+static void outRepeat(slOut *o, char c, int n)
+{
+    while( n-- > 0 )
+    {
+        outChar(o, c);
+    }
+}
+
+//
+// ************************************************************************
+// emit a field with its padding
+//   [spaces] prefix [zeros from '0' flag] [zeros] body [spaces]
+// ************************************************************************
+//
+static void outField(slOut *o, const slSpec *sp, const char *prefix, int nPrefix,
+                     int nZeros, const char *body, int nBody)
+{
+    int pad = sp->width - (nPrefix + nZeros + nBody);
+
+    if( pad < 0 )
+    {
+        pad = 0;
+    }
+
+    if( !(sp->flags & (SL_FLAG_LEFT | SL_FLAG_ZERO)) )
+    {
+        outRepeat(o, ' ', pad);
+    }
+
+    outData(o, prefix, nPrefix);
+
+    if( !(sp->flags & SL_FLAG_LEFT) && (sp->flags & SL_FLAG_ZERO) )
+    {
+        outRepeat(o, '0', pad);
+    }
+
+    outRepeat(o, '0', nZeros);
+    outData(o, body, nBody);
+
+    if( sp->flags & SL_FLAG_LEFT )
+    {
+        outRepeat(o, ' ', pad);
+    }
+}
+
+//
+// ************************************************************************
+// integer to text, written backwards from end. Returns the digit count.
+// Decimal output uses a digit-pair table and 32 bit arithmetic as soon
+// as the value fits, because 64 bit division is expensive on the ESP.
+// ************************************************************************
+//
+static int utoaDec(uint64_t v, char *end)
+{
+    char *p = end;
+    uint32_t v32;
+
+    while( v > 0xFFFFFFFFULL )
+    {
+        uint32_t r = (uint32_t) (v % 100);
+        v /= 100;
+        p -= 2;
+        memcpy(p, &slDigitPairs[r * 2], 2);
+    }
+
+    v32 = (uint32_t) v;
+
+    while( v32 >= 100 )
+    {
+        uint32_t r = v32 % 100;
+        v32 /= 100;
+        p -= 2;
+        memcpy(p, &slDigitPairs[r * 2], 2);
+    }
+
+    if( v32 >= 10 )
+    {
+        p -= 2;
+        memcpy(p, &slDigitPairs[v32 * 2], 2);
+    }
+    else
+    {
+        *--p = (char) ('0' + v32);
+    }
+
+    return( (int) (end - p) );
+}
+
+static int utoaPow2(uint64_t v, char *end, int shift, const char *digits)
+{
+    char *p = end;
+    unsigned mask = (1u << shift) - 1;
+
+    do
+    {
+        *--p = digits[v & mask];
+        v >>= shift;
+    } while( v != 0 );
+
+    return( (int) (end - p) );
+}
+
+//
+// ************************************************************************
+// integer conversions d i u o x X b B p
+// ************************************************************************
+//
+static void fmtInteger(slOut *o, slSpec *sp, uint64_t v, bool negative)
+{
+    char buf[SL_INT_BUFSIZE];
+    char *end = buf + sizeof(buf);
+    char prefix[2];
+    int nPrefix = 0;
+    int nDigits = 0;
+    int nZeros = 0;
+    bool isSigned = (sp->conv == 'd' || sp->conv == 'i');
+
+    // plain %d, %u and %x, the usual case in a log line: no field to pad
+    if( sp->flags == 0 && sp->width == 0 && sp->prec < 0 &&
+        (isSigned || sp->conv == 'u' || sp->conv == 'x') )
+    {
+        nDigits = sp->conv == 'x' ? utoaPow2(v, end, 4, slHexLower) : utoaDec(v, end);
+
+        if( negative )
+        {
+            *(end - ++nDigits) = '-';
+        }
+
+        outData(o, end - nDigits, nDigits);
+        return;
+    }
+
+    switch( sp->conv )
+    {
+        case 'o':
+            nDigits = utoaPow2(v, end, 3, slHexLower);
+            break;
+        case 'x':
+        case 'p':
+            nDigits = utoaPow2(v, end, 4, slHexLower);
+            break;
+        case 'X':
+            nDigits = utoaPow2(v, end, 4, slHexUpper);
+            break;
+        case 'b':
+        case 'B':
+            nDigits = utoaPow2(v, end, 1, slHexLower);
+            break;
+        default:
+            nDigits = utoaDec(v, end);
+            break;
+    }
+
+    // an explicit precision of 0 prints nothing for a value of 0
+    if( sp->prec == 0 && v == 0 )
+    {
+        nDigits = 0;
+    }
+
+    if( isSigned )
+    {
+        if( negative )
+        {
+            prefix[nPrefix++] = '-';
+        }
+        else if( sp->flags & SL_FLAG_PLUS )
+        {
+            prefix[nPrefix++] = '+';
+        }
+        else if( sp->flags & SL_FLAG_SPACE )
+        {
+            prefix[nPrefix++] = ' ';
+        }
+    }
+
+    if( (sp->flags & SL_FLAG_ALT) && v != 0 )
+    {
+        switch( sp->conv )
+        {
+            case 'x':
+            case 'X':
+            case 'b':
+            case 'B':
+                prefix[nPrefix++] = '0';
+                prefix[nPrefix++] = sp->conv;
+                break;
+        }
+    }
+
+    if( sp->conv == 'p' )
+    {
+        prefix[nPrefix++] = '0';
+        prefix[nPrefix++] = 'x';
+    }
+
+    if( sp->prec > nDigits )
+    {
+        nZeros = sp->prec - nDigits;
+    }
+
+    // '#' with octal forces a leading zero
+    if( sp->conv == 'o' && (sp->flags & SL_FLAG_ALT) && nZeros == 0 &&
+        (nDigits == 0 || *(end - nDigits) != '0') )
+    {
+        nZeros = 1;
+    }
+
+    if( sp->prec >= 0 )
+    {
+        sp->flags &= ~SL_FLAG_ZERO;
+    }
+
+    outField(o, sp, prefix, nPrefix, nZeros, end - nDigits, nDigits);
+}
+
+//
+// ************************************************************************
+// 10^e for e >= 0
+// ************************************************************************
+//
+static double pow10Pos(int e)
+{
+    double r = 1.0;
+
+    while( e > 22 )
+    {
+        r *= 1e22;
+        e -= 22;
+    }
+
+    return( r * slPow10[e] );
+}
+
+//
+// ************************************************************************
+// round to nearest, ties to even. frac is the fractional part of a
+// scaled value, residual the (exact) error of that scaling, so a frac
+// of exactly 0.5 can be told apart from values just above or below.
+// ************************************************************************
+//
+static inline bool fltRoundUp(double frac, double residual, bool odd)
+{
+    if( frac != 0.5 )
+    {
+        return( frac > 0.5 );
+    }
+
+    if( residual != 0.0 )
+    {
+        return( residual > 0.0 );
+    }
+
+    return( odd );
+}
+
+//
+// ************************************************************************
+// decimal exponent of the first significant digit of v > 0
+// ************************************************************************
+//
+static int fltExp10(double v)
+{
+    int bias = 0;
+    int e;
+
+    // keep 10^-e finite for subnormal values
+    if( v < 1e-290 )
+    {
+        v *= 1e300;
+        bias = -300;
+    }
+
+    e = (int) floor(log10(v));
+
+    // log10() may be off by one near powers of ten
+    if( e >= 0 )
+    {
+        if( pow10Pos(e) > v )
+        {
+            e--;
+        }
+        else if( e < 308 && pow10Pos(e + 1) <= v )
+        {
+            e++;
+        }
+    }
+    else
+    {
+        if( e > -308 && v * pow10Pos(-e) < 1.0 )
+        {
+            e--;
+        }
+        else if( v * pow10Pos(-e - 1) >= 1.0 )
+        {
+            e++;
+        }
+    }
+
+    return( e + bias );
+}
+
+//
+// ************************************************************************
+// round v > 0 to n (1 .. SL_FLT_MAX_DIGITS) significant digits.
+// The digits are stored as chars, the return value is the decimal
+// exponent of the first digit after rounding.
+// ************************************************************************
+//
+static int fltDigits(double v, int n, char *digits)
+{
+    int e = fltExp10(v);
+    int s;
+    int tries;
+    double m, frac, residual;
+    uint64_t r = 0;
+
+    for( tries = 0; tries < 2; tries++ )
+    {
+        s = n - 1 - e;
+        m = v;
+
+        if( s > 0 )
+        {
+            // avoid an overflow of 10^s for subnormal values
+            if( s > 300 )
+            {
+                m *= 1e300;
+                m *= pow10Pos(s - 300);
+            }
+            else
+            {
+                m *= pow10Pos(s);
+            }
+        }
+        else if( s < 0 )
+        {
+            m /= pow10Pos(-s);
+        }
+
+        r = (uint64_t) m;
+        frac = m - (double) r;
+
+        // the residual of the scaling is exact only for exact powers of ten
+        if( s >= -22 && s <= 22 )
+        {
+            residual = s >= 0 ? fma(v, pow10Pos(s), -m) : fma(-m, pow10Pos(-s), v);
+        }
+        else
+        {
+            residual = 0.0;
+        }
+
+        if( fltRoundUp(frac, residual, r & 1) )
+        {
+            r++;
+        }
+
+        if( r < slPow10Int[n] )
+        {
+            break;
+        }
+
+        // rounding carried into a new digit, e.g. 9.99 -> 10.0
+        e++;
+    }
+
+    if( r >= slPow10Int[n] )
+    {
+        r = slPow10Int[n - 1];
+    }
+
+    for( s = n - 1; s >= 0; s-- )
+    {
+        digits[s] = (char) ('0' + (int) (r % 10));
+        r /= 10;
+    }
+
+    return( e );
+}
+
+//
+// ************************************************************************
+// digit for the place value 10^k of a digit string starting at 10^e
+// ************************************************************************
+//
+static inline char fltDigitAt(const char *digits, int n, int e, int k)
+{
+    int i = e - k;
+
+    return( (i >= 0 && i < n) ? digits[i] : '0' );
+}
+
+//
+// ************************************************************************
+// emit a sign prefix and a padded float body; the body itself is
+// produced by the render callers after the left padding
+// ************************************************************************
+//
+static int fltPadBefore(slOut *o, const slSpec *sp, const char *prefix, int nPrefix,
+                        int nBody)
+{
+    int pad = sp->width - nPrefix - nBody;
+
+    if( pad < 0 )
+    {
+        pad = 0;
+    }
+
+    if( !(sp->flags & (SL_FLAG_LEFT | SL_FLAG_ZERO)) )
+    {
+        outRepeat(o, ' ', pad);
+    }
+
+    outData(o, prefix, nPrefix);
+
+    if( !(sp->flags & SL_FLAG_LEFT) && (sp->flags & SL_FLAG_ZERO) )
+    {
+        outRepeat(o, '0', pad);
+    }
+
+    return( pad );
+}
+
+static void fltPadAfter(slOut *o, const slSpec *sp, int pad)
+{
+    if( sp->flags & SL_FLAG_LEFT )
+    {
+        outRepeat(o, ' ', pad);
+    }
+}
+
+static int fixedLength(int e, int prec, bool alt)
+{
+    return( (e >= 0 ? e + 1 : 1) + ((prec > 0 || alt) ? 1 : 0) + prec );
+}
+
+static void renderFixed(slOut *o, const char *digits, int n, int e, int prec, bool alt)
+{
+    int k;
+
+    if( e >= 0 )
+    {
+        for( k = e; k >= 0; k-- )
+        {
+            outChar(o, fltDigitAt(digits, n, e, k));
+        }
+    }
+    else
+    {
+        outChar(o, '0');
+    }
+
+    if( prec > 0 || alt )
+    {
+        outChar(o, '.');
+    }
+
+    for( k = -1; k >= -prec; k-- )
+    {
+        outChar(o, fltDigitAt(digits, n, e, k));
+    }
+}
+
+static int expLength(int e, int prec, bool alt)
+{
+    return( 1 + ((prec > 0 || alt) ? 1 : 0) + prec + 2 + ((e >= 100 || e <= -100) ? 3 : 2) );
+}
+
+static void renderExp(slOut *o, const char *digits, int n, int e, int prec, bool alt,
+                      bool upper)
+{
+    int i;
+    unsigned ue;
+
+    outChar(o, digits[0]);
+
+    if( prec > 0 || alt )
+    {
+        outChar(o, '.');
+    }
+
+    for( i = 1; i <= prec; i++ )
+    {
+        outChar(o, i < n ? digits[i] : '0');
+    }
+
+    outChar(o, upper ? 'E' : 'e');
+    outChar(o, e < 0 ? '-' : '+');
+
+    ue = (unsigned) (e < 0 ? -e : e);
+
+    if( ue >= 100 )
+    {
+        outChar(o, (char) ('0' + ue / 100));
+        ue %= 100;
+    }
+
+    outData(o, &slDigitPairs[ue * 2], 2);
+}
+
+//
+// ************************************************************************
+// %f fast path: integer part fits 64 bit and precision is small
+// ************************************************************************
+//
+static void fmtFixedFast(slOut *o, const slSpec *sp, const char *prefix, int nPrefix,
+                         double v, int prec)
+{
+    char buf[SL_INT_BUFSIZE];
+    char *end = buf + sizeof(buf);
+    char *p = end;
+    uint64_t ip = (uint64_t) v;
+    uint32_t fp = 0;
+    uint32_t scale = (uint32_t) slPow10Int[prec];
+    double scaled = (v - (double) ip) * (double) scale;
+    double frac;
+    int i;
+
+    fp = (uint32_t) scaled;
+    frac = scaled - (double) fp;
+
+    if( fltRoundUp(frac, fma(v - (double) ip, (double) scale, -scaled),
+                   prec > 0 ? (fp & 1) : (ip & 1)) )
+    {
+        fp++;
+    }
+
+    // for precision 0 the rounding carries into the integer part only
+    if( fp >= scale )
+    {
+        fp -= scale;
+        ip++;
+    }
+
+    if( prec > 0 )
+    {
+        for( i = 0; i < prec; i++ )
+        {
+            *--p = (char) ('0' + fp % 10);
+            fp /= 10;
+        }
+    }
+
+    if( prec > 0 || (sp->flags & SL_FLAG_ALT) )
+    {
+        *--p = '.';
+    }
+
+    p -= utoaDec(ip, p);
+
+    outField(o, sp, prefix, nPrefix, 0, p, (int) (end - p));
+}
+
+//
+// ************************************************************************
+// floating point conversions f F e E g G
+// ************************************************************************
+//
+static void fmtFloat(slOut *o, slSpec *sp, double v)
+{
+    char prefix[1];
+    int nPrefix = 0;
+    char digits[SL_FLT_MAX_DIGITS];
+    int n, e, prec, pad, nreq, last;
+    bool alt = (sp->flags & SL_FLAG_ALT) != 0;
+    bool upper = (sp->conv == 'F' || sp->conv == 'E' || sp->conv == 'G');
+    char conv = sp->conv | 0x20;
+
+    if( signbit(v) )
+    {
+        prefix[nPrefix++] = '-';
+        v = -v;
+    }
+    else if( sp->flags & SL_FLAG_PLUS )
+    {
+        prefix[nPrefix++] = '+';
+    }
+    else if( sp->flags & SL_FLAG_SPACE )
+    {
+        prefix[nPrefix++] = ' ';
+    }
+
+    if( isnan(v) || isinf(v) )
+    {
+        sp->flags &= ~SL_FLAG_ZERO;
+        outField(o, sp, prefix, nPrefix, 0,
+                 isnan(v) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf"), 3);
+        return;
+    }
+
+    prec = sp->prec < 0 ? 6 : sp->prec;
+
+    if( sp->flags & SL_FLAG_LEFT )
+    {
+        sp->flags &= ~SL_FLAG_ZERO;
+    }
+
+    if( conv == 'f' )
+    {
+        if( v < SL_FLT_FAST_LIMIT && prec <= SL_FLT_FAST_PREC )
+        {
+            fmtFixedFast(o, sp, prefix, nPrefix, v, prec);
+            return;
+        }
+
+        if( v == 0.0 )
+        {
+            n = 1;
+            e = 0;
+            digits[0] = '0';
+        }
+        else
+        {
+            e = fltExp10(v);
+            nreq = e + 1 + prec;
+
+            if( nreq > 0 )
+            {
+                n = nreq > SL_FLT_MAX_DIGITS ? SL_FLT_MAX_DIGITS : nreq;
+                e = fltDigits(v, n, digits);
+            }
+            else
+            {
+                // below the last printed place: either 0 or 1 in that place
+                n = 1;
+                digits[0] = (nreq == 0 && v * pow10Pos(prec) >= 0.5) ? '1' : '0';
+                e = digits[0] == '1' ? -prec : 0;
+            }
+        }
+
+        pad = fltPadBefore(o, sp, prefix, nPrefix, fixedLength(e, prec, alt));
+        renderFixed(o, digits, n, e, prec, alt);
+        fltPadAfter(o, sp, pad);
+        return;
+    }
+
+    if( conv == 'e' )
+    {
+        n = prec + 1 > SL_FLT_MAX_DIGITS ? SL_FLT_MAX_DIGITS : prec + 1;
+
+        if( v == 0.0 )
+        {
+            memset(digits, '0', n);
+            e = 0;
+        }
+        else
+        {
+            e = fltDigits(v, n, digits);
+        }
+
+        pad = fltPadBefore(o, sp, prefix, nPrefix, expLength(e, prec, alt));
+        renderExp(o, digits, n, e, prec, alt, upper);
+        fltPadAfter(o, sp, pad);
+        return;
+    }
+
+    // %g - shortest of %e and %f with prec significant digits
+    if( prec == 0 )
+    {
+        prec = 1;
+    }
+
+    n = prec > SL_FLT_MAX_DIGITS ? SL_FLT_MAX_DIGITS : prec;
+
+    if( v == 0.0 )
+    {
+        memset(digits, '0', n);
+        e = 0;
+    }
+    else
+    {
+        e = fltDigits(v, n, digits);
+    }
+
+    // without '#' trailing zeros are removed
+    last = prec - 1;
+
+    if( !alt )
+    {
+        for( last = n - 1; last > 0 && digits[last] == '0'; last-- )
+            ;
+    }
+
+    if( e < -4 || e >= prec )
+    {
+        prec = last;
+        pad = fltPadBefore(o, sp, prefix, nPrefix, expLength(e, prec, alt));
+        renderExp(o, digits, n, e, prec, alt, upper);
+    }
+    else
+    {
+        prec = last - e;
+
+        if( prec < 0 )
+        {
+            prec = 0;
+        }
+
+        pad = fltPadBefore(o, sp, prefix, nPrefix, fixedLength(e, prec, alt));
+        renderFixed(o, digits, n, e, prec, alt);
+    }
+
+    fltPadAfter(o, sp, pad);
+}
+
+//
+// ************************************************************************
+// conversion chars the engine knows
+// ************************************************************************
+//
+static inline bool isConversion(char c)
+{
+    switch( c )
+    {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+        case 'b': case 'B': case 'c': case 's': case 'p':
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+        case '%':
+            return( true );
+        default:
+            return( false );
+    }
+}
+
+//
+// ************************************************************************
+// the format engine
+// ************************************************************************
+//
+static void formatOut(slOut *o, const char *format, va_list args)
+{
+    const char *run;
+    const char *spec;
+    slSpec sp;
+    uint64_t uv;
+    int64_t sv;
+    bool valid;
+
+    while( *format != '\0' )
+    {
+        // copy literal text in one block
+        run = format;
+        while( *format != '\0' && *format != '%' )
+        {
+            format++;
+        }
+
+        if( format > run )
+        {
+            outData(o, run, format - run);
+        }
+
+        if( *format == '\0' )
+        {
+            break;
+        }
+
+        spec = format++;
+
+        sp.flags = 0;
+        sp.width = 0;
+        sp.prec = -1;
+        sp.length = SL_LEN_NONE;
+
+        // flags
+        for( ;; format++ )
+        {
+            if( *format == '-' )      sp.flags |= SL_FLAG_LEFT;
+            else if( *format == '+' ) sp.flags |= SL_FLAG_PLUS;
+            else if( *format == ' ' ) sp.flags |= SL_FLAG_SPACE;
+            else if( *format == '#' ) sp.flags |= SL_FLAG_ALT;
+            else if( *format == '0' ) sp.flags |= SL_FLAG_ZERO;
+            else break;
+        }
+
+        // width
+        if( *format == '*' )
+        {
+            sp.width = va_arg(args, int);
+            if( sp.width < 0 )
+            {
+                sp.flags |= SL_FLAG_LEFT;
+                sp.width = -sp.width;
+            }
+            format++;
+        }
+        else
+        {
+            while( *format >= '0' && *format <= '9' )
+            {
+                sp.width = sp.width * 10 + (*format++ - '0');
+            }
+        }
+
+        // precision
+        if( *format == '.' )
+        {
+            format++;
+            sp.prec = 0;
+
+            if( *format == '*' )
+            {
+                sp.prec = va_arg(args, int);
+                if( sp.prec < 0 )
+                {
+                    sp.prec = -1;
+                }
+                format++;
+            }
+            else
+            {
+                while( *format >= '0' && *format <= '9' )
+                {
+                    sp.prec = sp.prec * 10 + (*format++ - '0');
+                }
+            }
+        }
+
+        // length modifier
+        switch( *format )
+        {
+            case 'h':
+                format++;
+                sp.length = SL_LEN_SHORT;
+                if( *format == 'h' )
+                {
+                    format++;
+                    sp.length = SL_LEN_CHAR;
+                }
+                break;
+            case 'l':
+                format++;
+                sp.length = SL_LEN_LONG;
+                if( *format == 'l' )
+                {
+                    format++;
+                    sp.length = SL_LEN_LLONG;
+                }
+                break;
+            case 'j':
+                format++;
+                sp.length = SL_LEN_INTMAX;
+                break;
+            case 'z':
+                format++;
+                sp.length = SL_LEN_SIZE;
+                break;
+            case 't':
+                format++;
+                sp.length = SL_LEN_PTRDIFF;
+                break;
+            case 'L':
+                format++;
+                sp.length = SL_LEN_LDOUBLE;
+                break;
+        }
+
+        sp.conv = *format;
+        valid = isConversion(sp.conv);
+
+        // SimpleLog has always accepted "%l" as long decimal
+        if( !valid && sp.length == SL_LEN_LONG && format[-1] == 'l' )
+        {
+            sp.conv = 'd';
+            format--;
+            valid = true;
+        }
+
+        if( !valid )
+        {
+            // unknown conversion, print it as is
+            if( *format != '\0' )
+            {
+                format++;
+            }
+            outData(o, spec, format - spec);
+            continue;
+        }
+
+        format++;
+
+        switch( sp.conv )
+        {
+            case '%':
+                outChar(o, '%');
+                break;
+
+            case 'd':
+            case 'i':
+                switch( sp.length )
+                {
+                    case SL_LEN_CHAR:    sv = (signed char) va_arg(args, int); break;
+                    case SL_LEN_SHORT:   sv = (short) va_arg(args, int); break;
+                    case SL_LEN_LONG:    sv = va_arg(args, long); break;
+                    case SL_LEN_LLONG:   sv = va_arg(args, long long); break;
+                    case SL_LEN_INTMAX:  sv = va_arg(args, intmax_t); break;
+                    case SL_LEN_SIZE:    sv = (ptrdiff_t) va_arg(args, size_t); break;
+                    case SL_LEN_PTRDIFF: sv = va_arg(args, ptrdiff_t); break;
+                    default:             sv = va_arg(args, int); break;
+                }
+                uv = sv < 0 ? (uint64_t) 0 - (uint64_t) sv : (uint64_t) sv;
+                fmtInteger(o, &sp, uv, sv < 0);
+                break;
+
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            case 'b':
+            case 'B':
+                switch( sp.length )
+                {
+                    case SL_LEN_CHAR:    uv = (unsigned char) va_arg(args, unsigned int); break;
+                    case SL_LEN_SHORT:   uv = (unsigned short) va_arg(args, unsigned int); break;
+                    case SL_LEN_LONG:    uv = va_arg(args, unsigned long); break;
+                    case SL_LEN_LLONG:   uv = va_arg(args, unsigned long long); break;
+                    case SL_LEN_INTMAX:  uv = va_arg(args, uintmax_t); break;
+                    case SL_LEN_SIZE:    uv = va_arg(args, size_t); break;
+                    case SL_LEN_PTRDIFF: uv = (size_t) va_arg(args, ptrdiff_t); break;
+                    default:             uv = va_arg(args, unsigned int); break;
+                }
+                fmtInteger(o, &sp, uv, false);
+                break;
+
+            case 'p':
+                uv = (uintptr_t) va_arg(args, void *);
+                if( uv == 0 )
+                {
+                    sp.flags &= ~SL_FLAG_ZERO;
+                    outField(o, &sp, "", 0, 0, "(nil)", 5);
+                }
+                else
+                {
+                    fmtInteger(o, &sp, uv, false);
+                }
+                break;
+
+            case 'c':
+                {
+                    char c = (char) va_arg(args, int);
+                    sp.flags &= ~SL_FLAG_ZERO;
+                    outField(o, &sp, "", 0, 0, &c, 1);
+                }
+                break;
+
+            case 's':
+                {
+                    const char *s = va_arg(args, const char *);
+                    int len = 0;
+
+                    if( s == NULL )
+                    {
+                        s = "(null)";
+                    }
+
+                    if( sp.prec >= 0 )
+                    {
+                        while( len < sp.prec && s[len] != '\0' )
+                        {
+                            len++;
+                        }
+                    }
+                    else
+                    {
+                        len = (int) strlen(s);
+                    }
+
+                    sp.flags &= ~SL_FLAG_ZERO;
+                    outField(o, &sp, "", 0, 0, s, len);
+                }
+                break;
+
+            default:
+                if( sp.length == SL_LEN_LDOUBLE )
+                {
+                    fmtFloat(o, &sp, (double) va_arg(args, long double));
+                }
+                else
+                {
+                    fmtFloat(o, &sp, va_arg(args, double));
+                }
+                break;
+        }
+    }
+}
+
+//
+// ************************************************************************
+// format to a write function
+// ************************************************************************
+//
+int slFormat(slWriteFunc write, void *ctx, const char *format, va_list args)
+{
+    char buf[SIMPLE_LOG_FORMAT_BUFSIZE];
+    slOut o;
+
+    o.write = write;
+    o.ctx = ctx;
+    o.buf = buf;
+    o.cap = sizeof(buf);
+    o.len = 0;
+    o.total = 0;
+
+    if( format != NULL )
+    {
+        formatOut(&o, format, args);
+    }
+
+    outFlush(&o);
+
+    return( o.total );
+}
+
+//
+// ************************************************************************
+// format to a buffer, semantics of vsnprintf()
+// ************************************************************************
+//
+int slVsnprintf(char *buf, size_t size, const char *format, va_list args)
+{
+    slOut o;
+
+    o.write = NULL;
+    o.ctx = NULL;
+    o.buf = buf;
+    o.cap = size > 0 ? size - 1 : 0;
+    o.len = 0;
+    o.total = 0;
+
+    if( format != NULL )
+    {
+        formatOut(&o, format, args);
+    }
+
+    if( size > 0 )
+    {
+        buf[o.len] = '\0';
+    }
+
+    return( o.total );
+}
+
+int slSnprintf(char *buf, size_t size, const char *format, ...)
+{
+    int retVal;
+    va_list args;
+
+    va_start(args, format);
+    retVal = slVsnprintf(buf, size, format, args);
+    va_end(args);
+
+    return( retVal );
+}
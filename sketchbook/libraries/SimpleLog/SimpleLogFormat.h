@@ -0,0 +1,84 @@
+//
+// ************************************************************************
+// SimpleLog
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   The format engine of SimpleLog. It is a printf()-compatible
+//   formatter that does not allocate any memory and does not depend
+//   on the Arduino core, so it builds and runs on a Linux host, too.
+//
+//   Supported conversions:
+//     %d %i %u %o %x %X %c %s %p %f %F %e %E %g %G %%
+//   plus the SimpleLog extensions
+//     %b %B  binary output of an unsigned value
+//     %l     a lone 'l' without a conversion is handled as %ld
+//   Flags '-', '+', ' ', '#' and '0', width and precision (also as '*')
+//   and the length modifiers hh, h, l, ll, j, z, t and L are honoured.
+//   %n is not supported and is printed verbatim.
+//
+//   Floating point output is generated from at most 17 significant
+//   digits, further digits are printed as zeros. Up to about 15
+//   significant digits the output matches the one of the C library.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/10/28: initial version
+//
+//
+// ************************************************************************
+//
+
+#ifndef _SIMPLE_LOG_FORMAT_H_
+#define _SIMPLE_LOG_FORMAT_H_
+
+#include <stddef.h>
+#include <stdarg.h>
+
+//
+// size of the output buffer slFormat() collects data in before it is
+// handed to the write function
+//
+#ifndef SIMPLE_LOG_FORMAT_BUFSIZE
+#define SIMPLE_LOG_FORMAT_BUFSIZE        64
+#endif
+
+//
+// a write function receives the formatted output in chunks of up to
+// SIMPLE_LOG_FORMAT_BUFSIZE bytes
+//
+typedef void (*slWriteFunc)(void *ctx, const char *data, size_t len);
+
+//
+// format to a write function. Returns the number of characters written.
+//
+int slFormat(slWriteFunc write, void *ctx, const char *format, va_list args);
+
+//
+// format to a buffer with the semantics of vsnprintf() resp. snprintf().
+// The output is truncated to size - 1 characters and always terminated
+// if size > 0. Returns the number of characters that would have been
+// written if the buffer had been large enough.
+//
+int slVsnprintf(char *buf, size_t size, const char *format, va_list args);
+int slSnprintf(char *buf, size_t size, const char *format, ...);
+
+#endif // _SIMPLE_LOG_FORMAT_H_
@@ -0,0 +1,312 @@
+//
+// ************************************************************************
+// SimpleLog
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Ring buffer and UDP syslog sinks for SimpleLog.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/22: initial version
+//
+//
+// ************************************************************************
+//
+
+#include "SimpleLogSinks.h"
+
+//
+// ************************************************************************
+// Create a ring buffer sink
+//
+// Expected arguments:
+// - char *buffer, size_t size
+//   the memory that holds the log output. It is owned by the caller,
+//   usually a static array.
+// - int level
+//   the loglevel of the sink.
+// ************************************************************************
+//
+SimpleLogRingSink::SimpleLogRingSink(char *buffer, size_t size, int level) :
+    SimpleLogSink(level)
+{
+  _buf = buffer;
+  _size = buffer != NULL ? size : 0;
+  Clear();
+}
+
+//
+// ************************************************************************
+// Discard the content of the ring buffer
+// ************************************************************************
+//
+void SimpleLogRingSink::Clear()
+{
+  _head = 0;
+  _len = 0;
+  _dropped = 0;
+}
+
+//
+// ************************************************************************
+// Append a block to the ring buffer. If there is not enough room the
+// oldest bytes are overwritten and counted as dropped.
+// ************************************************************************
+//
+void SimpleLogRingSink::Write(const char *data, size_t len)
+{
+  size_t tail, chunk;
+
+  if( _size == 0 )
+  {
+    return;
+  }
+
+  // only the last _size bytes of a huge block survive anyway
+  if( len > _size )
+  {
+    _dropped += len - _size;
+    data += len - _size;
+    len = _size;
+  }
+
+  if( _len + len > _size )
+  {
+    size_t drop = _len + len - _size;
+
+    _dropped += drop;
+    _head = (_head + drop) % _size;
+    _len -= drop;
+  }
+
+  tail = (_head + _len) % _size;
+  chunk = _size - tail;
+
+  if( chunk > len )
+  {
+    chunk = len;
+  }
+
+  memcpy(_buf + tail, data, chunk);
+  memcpy(_buf, data + chunk, len - chunk);
+  _len += len;
+}
+
+//
+// ************************************************************************
+// Copy up to len bytes beginning offset bytes after the oldest byte
+// in the buffer to dst. Returns the number of bytes copied.
+// ************************************************************************
+//
+size_t SimpleLogRingSink::Read(size_t offset, char *dst, size_t len)
+{
+  size_t start, chunk;
+
+  if( offset >= _len )
+  {
+    return( 0 );
+  }
+
+  if( len > _len - offset )
+  {
+    len = _len - offset;
+  }
+
+  start = (_head + offset) % _size;
+  chunk = _size - start;
+
+  if( chunk > len )
+  {
+    chunk = len;
+  }
+
+  memcpy(dst, _buf + start, chunk);
+  memcpy(dst + chunk, _buf, len - chunk);
+
+  return( len );
+}
+
+//
+// ************************************************************************
+// Create a syslog sink. It stays inactive until Begin() is called.
+// ************************************************************************
+//
+SimpleLogSyslogSink::SimpleLogSyslogSink(int level) :
+    SimpleLogSink(level)
+{
+  _udp = NULL;
+  _port = SIMPLE_LOG_SYSLOG_PORT;
+  _hostname = "";
+  _tag = "";
+  _facility = SIMPLE_LOG_SYSLOG_FACILITY;
+  _len = 0;
+  _sent = 0;
+  _dropped = 0;
+}
+
+//
+// ************************************************************************
+// Activate the syslog sink
+//
+// Expected arguments:
+// - UDP *udp
+//   an UDP object, e.g. a WiFiUDP instance. It must stay valid as long
+//   as the sink is in use.
+// - IPAddress server, uint16_t port
+//   address of the syslog server
+// - const char *hostname, const char *tag
+//   sender information put in front of each message. The strings
+//   are not copied.
+// - int facility
+//   syslog facility, default is local0
+//
+// Returns SIMPLE_LOG_SINK_INVAL if udp is NULL, otherwise
+// SIMPLE_LOG_SUCCESS.
+// ************************************************************************
+//
+int SimpleLogSyslogSink::Begin(UDP *udp, IPAddress server, uint16_t port,
+                               const char *hostname, const char *tag, int facility)
+{
+  int retVal = SIMPLE_LOG_SUCCESS;
+
+  if( udp == NULL )
+  {
+    retVal = SIMPLE_LOG_SINK_INVAL;
+  }
+  else
+  {
+    _udp = udp;
+    _server = server;
+    _port = port;
+    _hostname = hostname != NULL ? hostname : "";
+    _tag = tag != NULL ? tag : "";
+    _facility = facility;
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// Deactivate the syslog sink
+// ************************************************************************
+//
+void SimpleLogSyslogSink::End()
+{
+  _udp = NULL;
+}
+
+//
+// ************************************************************************
+// map SimpleLog levels to syslog severities
+// ************************************************************************
+//
+int SimpleLogSyslogSink::severity(int level)
+{
+  int retVal = 7;   // debug
+
+  if( level & LOGLEVEL_CRITICAL )
+  {
+    retVal = 2;
+  }
+  else if( level & LOGLEVEL_ERROR )
+  {
+    retVal = 3;
+  }
+  else if( level & LOGLEVEL_WARNING )
+  {
+    retVal = 4;
+  }
+  else if( level & LOGLEVEL_INFO )
+  {
+    retVal = 6;
+  }
+
+  return( retVal );
+}
+
+//
+// ************************************************************************
+// start a new datagram: <PRI>HOSTNAME TAG:
+// ************************************************************************
+//
+void SimpleLogSyslogSink::BeginRecord(int level)
+{
+  int len;
+
+  if( _udp == NULL )
+  {
+    _len = 0;
+    return;
+  }
+
+  len = slSnprintf(_packet, sizeof(_packet), "<%d>%s %s: ",
+                   _facility * 8 + severity(level), _hostname, _tag);
+
+  _len = len < (int) sizeof(_packet) ? len : sizeof(_packet) - 1;
+}
+
+//
+// ************************************************************************
+// collect the message, excess output is cut off
+// ************************************************************************
+//
+void SimpleLogSyslogSink::Write(const char *data, size_t len)
+{
+  if( _len + len > sizeof(_packet) )
+  {
+    len = sizeof(_packet) - _len;
+  }
+
+  memcpy(_packet + _len, data, len);
+  _len += len;
+}
+
+//
+// ************************************************************************
+// send the collected record as one datagram
+// ************************************************************************
+//
+void SimpleLogSyslogSink::EndRecord()
+{
+  // syslog messages don't carry the line feed
+  while( _len > 0 && (_packet[_len - 1] == '\n' || _packet[_len - 1] == '\r') )
+  {
+    _len--;
+  }
+
+  if( _udp != NULL && _len > 0 )
+  {
+    if( _udp->beginPacket(_server, _port) &&
+        _udp->write((const uint8_t *) _packet, _len) == _len &&
+        _udp->endPacket() )
+    {
+      _sent++;
+    }
+    else
+    {
+      _dropped++;
+    }
+  }
+
+  _len = 0;
+}
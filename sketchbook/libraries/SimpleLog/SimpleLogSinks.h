@@ -0,0 +1,112 @@
+//
+// ************************************************************************
+// SimpleLog
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Additional sinks for SimpleLog:
+//   - SimpleLogRingSink keeps the latest log output in a RAM buffer
+//     supplied by the caller, e.g. to show it on a web page
+//   - SimpleLogSyslogSink sends each record as a syslog message
+//     (RFC 3164) over UDP without waiting for the network
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/22: initial version
+//
+//
+// ************************************************************************
+//
+
+#ifndef _SIMPLE_LOG_SINKS_H_
+#define _SIMPLE_LOG_SINKS_H_
+
+#include "SimpleLog.h"
+#include <IPAddress.h>
+#include <Udp.h>
+
+//
+// syslog defaults
+//
+#define SIMPLE_LOG_SYSLOG_PORT          514
+#define SIMPLE_LOG_SYSLOG_FACILITY       16   // local0
+//
+// max. size of a syslog datagram, longer records are truncated
+//
+#ifndef SIMPLE_LOG_SYSLOG_MAXLEN
+#define SIMPLE_LOG_SYSLOG_MAXLEN        192
+#endif
+
+//
+// Ring buffer sink. The oldest output is overwritten if the buffer is
+// full. Read() copies data starting at an offset relative to the oldest
+// byte still in the buffer, so the whole content can be fetched in
+// chunks of any size.
+//
+class SimpleLogRingSink : public SimpleLogSink {
+private:
+    char *_buf;
+    size_t _size;
+    size_t _head;
+    size_t _len;
+    unsigned long _dropped;
+public:
+    SimpleLogRingSink(char *buffer, size_t size, int level = LOGLEVEL_ALL_BITS);
+    virtual void Write(const char *data, size_t len);
+    size_t Length() { return( _len ); };
+    size_t Read(size_t offset, char *dst, size_t len);
+    unsigned long Dropped() { return( _dropped ); };
+    void Clear();
+};
+
+//
+// UDP syslog sink. A record is collected in a fixed buffer and sent
+// as a single datagram in EndRecord(). Datagrams that can't be sent are
+// counted as dropped, the sink never waits for the network.
+//
+class SimpleLogSyslogSink : public SimpleLogSink {
+private:
+    UDP *_udp;
+    IPAddress _server;
+    uint16_t _port;
+    const char *_hostname;
+    const char *_tag;
+    int _facility;
+    char _packet[SIMPLE_LOG_SYSLOG_MAXLEN];
+    size_t _len;
+    unsigned long _sent;
+    unsigned long _dropped;
+public:
+    SimpleLogSyslogSink(int level = LOGLEVEL_ALL_BITS);
+    int Begin(UDP *udp, IPAddress server, uint16_t port = SIMPLE_LOG_SYSLOG_PORT,
+              const char *hostname = "esp8266", const char *tag = "SimpleLog",
+              int facility = SIMPLE_LOG_SYSLOG_FACILITY);
+    void End();
+    virtual void BeginRecord(int level);
+    virtual void Write(const char *data, size_t len);
+    virtual void EndRecord();
+    unsigned long Sent() { return( _sent ); };
+    unsigned long Dropped() { return( _dropped ); };
+private:
+    static int severity(int level);
+};
+
+#endif // _SIMPLE_LOG_SINKS_H_
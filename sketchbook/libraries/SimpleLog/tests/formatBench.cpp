@@ -0,0 +1,125 @@
+//
+// ************************************************************************
+// SimpleLog - throughput of the format engine
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Formats typical log lines with snprintf() of the C library and with
+//   slSnprintf() and prints the time per call. Each is timed in several
+//   rounds, the fastest one counts, other load of the host only slows a
+//   round down. Build and run on a Linux host with "make bench".
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/20: initial version
+// 2017/01/01: fastest of BENCH_ROUNDS rounds
+//
+//
+// ************************************************************************
+//
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../SimpleLogFormat.h"
+
+#define BENCH_CALLS     2000000
+#define BENCH_ROUNDS          5
+
+enum {
+    BENCH_INT,
+    BENCH_FLOAT,
+    BENCH_MIXED
+};
+
+static double now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return( ts.tv_sec + ts.tv_nsec * 1e-9 );
+}
+
+//
+// ns per call of the C library (useLibc) resp. of SimpleLog
+//
+static double run(int kind, bool useLibc)
+{
+    char buf[256];
+    volatile int len = 0;
+    double start = now();
+
+    for( int i = 0; i < BENCH_CALLS; i++ )
+    {
+        switch( kind )
+        {
+            case BENCH_INT:
+                len += useLibc ? snprintf(buf, sizeof(buf), "%d %u %x", i, i * 7u, i) :
+                                 slSnprintf(buf, sizeof(buf), "%d %u %x", i, i * 7u, i);
+                break;
+            case BENCH_FLOAT:
+                len += useLibc ? snprintf(buf, sizeof(buf), "%.2f %f", i * 0.37, i * 1.5) :
+                                 slSnprintf(buf, sizeof(buf), "%.2f %f", i * 0.37, i * 1.5);
+                break;
+            default:
+                len += useLibc ? snprintf(buf, sizeof(buf), "node %s: %5d bytes, %.3f C",
+                                          "esp", i, i * 0.01) :
+                                 slSnprintf(buf, sizeof(buf), "node %s: %5d bytes, %.3f C",
+                                            "esp", i, i * 0.01);
+                break;
+        }
+    }
+
+    return( (now() - start) / BENCH_CALLS * 1e9 );
+}
+
+//
+// fastest of BENCH_ROUNDS rounds
+//
+static double best(int kind, bool useLibc)
+{
+    double retVal = run(kind, useLibc);
+    double t;
+
+    for( int round = 1; round < BENCH_ROUNDS; round++ )
+    {
+        if( (t = run(kind, useLibc)) < retVal )
+        {
+            retVal = t;
+        }
+    }
+
+    return( retVal );
+}
+
+int main()
+{
+    static const char *names[] = { "int", "float", "mixed" };
+
+    for( int kind = BENCH_INT; kind <= BENCH_MIXED; kind++ )
+    {
+        printf("%-6s snprintf %6.1f ns/call  slSnprintf %6.1f ns/call\n",
+               names[kind], best(kind, true), best(kind, false));
+    }
+
+    return( 0 );
+}
@@ -0,0 +1,265 @@
+//
+// ************************************************************************
+// SimpleLog - host test of the format engine
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   Formats the same arguments with slSnprintf() and the snprintf() of
+//   the C library and compares result and return value. A fixed set of
+//   conversions is followed by random values for the integer and the
+//   floating point conversions. Floating point values are limited to
+//   15 significant digits, the engine generates at most 17.
+//
+//   The '#' flag is not compared for %g with the C library: glibc up
+//   to 2.36 drops the trailing zeros if the value is rounded up to the
+//   next power of ten (e.g. "%#g" of 999999.5 gives "1.e+06"). These
+//   cases are checked against the expected string.
+//
+//   Build and run on a Linux host with "make test".
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/20: initial version
+//
+//
+// ************************************************************************
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <float.h>
+
+#include "../SimpleLogFormat.h"
+
+#define RANDOM_ROUNDS     200000
+
+static int fails = 0;
+static int total = 0;
+
+//
+// compare one format with the C library
+//
+#define CHECK(...) \
+    do { \
+        char libc[512], sl[512]; \
+        int libcLen = snprintf(libc, sizeof(libc), __VA_ARGS__); \
+        int slLen = slSnprintf(sl, sizeof(sl), __VA_ARGS__); \
+        total++; \
+        if( libcLen != slLen || strcmp(libc, sl) ) \
+        { \
+            if( fails++ < 20 ) \
+            { \
+                printf("FAIL %s: libc [%s] %d, SimpleLog [%s] %d\n", \
+                       #__VA_ARGS__, libc, libcLen, sl, slLen); \
+            } \
+        } \
+    } while( 0 )
+
+//
+// compare with an expected string, for the SimpleLog extensions
+//
+static void expect(const char *what, const char *result, const char *expected)
+{
+    total++;
+    if( strcmp(result, expected) )
+    {
+        fails++;
+        printf("FAIL %s: [%s], expected [%s]\n", what, result, expected);
+    }
+}
+
+static void testIntegers()
+{
+    CHECK("plain text");
+    CHECK("%d|%i|%5d|%-5d|%05d|%+d|% d|%.3d|%8.3d|%-8.3d|%.0d|",
+          42, -42, 7, 7, -7, 7, 7, 7, -7, 7, 0);
+    CHECK("%u %lu %llu %hu %hhu", 4000000000u, 123456789012UL,
+          18446744073709551615ULL, (unsigned short) 65535, (unsigned char) 255);
+    CHECK("%ld %lld %hd %hhd %jd %zd %td", -1234567890123L, (long long) INT64_MIN,
+          (short) -5, (signed char) -100, (intmax_t) -9, (ssize_t) -3, (ptrdiff_t) -8);
+    CHECK("%x %X %#x %#X %08x %#010x %.6x %#o %o %#.0o %.0x",
+          0xdeadbeef, 0xabc, 255, 255, 0x1f, 0x1f, 0x1f, 8, 8, 0, 0);
+    CHECK("%d %d %ld", INT32_MIN, INT32_MAX, (long) INT64_MIN);
+}
+
+static void testStrings()
+{
+    CHECK("%s|%10s|%-10s|%.3s|%10.2s|%c|%3c|%-3c|%%",
+          "hello", "hi", "hi", "abcdef", "abcdef", 'x', 'y', 'z');
+    CHECK("%*d|%-*d|%.*f|%*.*s|", 6, 1, 6, 2, 3, 3.14159, 8, 2, "abc");
+    CHECK("%*d|", -6, 1);
+    CHECK("%p %p", (void *) 0x1234, (void *) 0);
+}
+
+static void testFloats()
+{
+    static const double values[] =
+    {
+        0.0, -0.0, 1.0, -1.5, 0.5, 2.5, 3.14159265358979, 1e-5, 123.456,
+        99.995, 0.125, 2.675, 1e10, 1.5e17, 9.9999999, 123456789.987654321,
+        1e20, 1.23e100, -4.56e-100, 1e-310, DBL_MAX, 0.000123456, 999999.5,
+        1234567.0, 0.1, 1e15 + 0.3
+    };
+    static const double fixedValues[] =
+    {
+        0.0, -0.0, 1.0, -1.5, 0.5, 2.5, 3.14159265358979, 1e-5, 123.456,
+        99.995, 0.125, 2.675, 1e10, 1.5e17, 9.9999999, 123456789.987654321,
+        1e20, 1e-310, 0.000123456, 999999.5, 1234567.0, 0.1, 1e15 + 0.3
+    };
+    double v;
+
+    for( unsigned i = 0; i < sizeof(fixedValues) / sizeof(fixedValues[0]); i++ )
+    {
+        v = fixedValues[i];
+        CHECK("%f|%.0f|%.1f|%.2f|%.9f|%10.3f|%-10.3f|%+f|% f|%010.2f|%#.0f",
+              v, v, v, v, v, v, v, v, v, v, v);
+    }
+
+    for( unsigned i = 0; i < sizeof(values) / sizeof(values[0]); i++ )
+    {
+        v = values[i];
+        CHECK("%e|%.0e|%.3e|%E|%12.4e|%#.0e|%+.2e", v, v, v, v, v, v, v);
+        CHECK("%g|%.0g|%.3g|%G|%.10g|%10g|%-10g|%.15g",
+              v, v, v, v, v, v, v, v);
+    }
+
+    for( unsigned i = 0; i < sizeof(values) / sizeof(values[0]); i++ )
+    {
+        v = values[i];
+        if( v != 999999.5 )
+        {
+            CHECK("%#g|%#.3g", v, v);
+        }
+    }
+
+    CHECK("%f %F %e %g %5f %-6F|", INFINITY, -INFINITY, NAN, INFINITY, NAN, INFINITY);
+    CHECK("%Lf %Lg", (long double) 1.25, (long double) 3.5e-7);
+    CHECK("%lf %lg", 1.25, 2.5);
+}
+
+static void testExtensions()
+{
+    char buf[64];
+    int len;
+
+    slSnprintf(buf, sizeof(buf), "%b %#b %B %08b", 5, 5, 10, 3);
+    expect("binary", buf, "101 0b101 1010 00000011");
+
+    // digits beyond the 17th are printed as zeros
+    slSnprintf(buf, sizeof(buf), "%.15f", 123.456);
+    expect("%.15f", buf, "123.456000000000000");
+
+    slSnprintf(buf, sizeof(buf), "%.0f", 1.23e30);
+    expect("%.0f of 1.23e30", buf, "1230000000000000000000000000000");
+
+    slSnprintf(buf, sizeof(buf), "%#g|%#.3g|%#.2G", 999999.5, -999.6, 99.7);
+    expect("%#g rounded up", buf, "1.00000e+06|-1.00e+03|1.0E+02");
+
+    slSnprintf(buf, sizeof(buf), "%l\n", 123456L);
+    expect("lone %l", buf, "123456\n");
+
+    slSnprintf(buf, sizeof(buf), "%l", 5L);
+    expect("lone %l at the end", buf, "5");
+
+    slSnprintf(buf, sizeof(buf), "a%q%");
+    expect("unknown conversion", buf, "a%q%");
+
+    len = slSnprintf(buf, 5, "%d", 1234567);
+    expect("truncation", buf, "1234");
+    total++;
+    if( len != 7 )
+    {
+        fails++;
+        printf("FAIL truncation returned %d, expected 7\n", len);
+    }
+
+    total++;
+    if( (len = slSnprintf(NULL, 0, "%s%d", "abc", 12)) != 5 )
+    {
+        fails++;
+        printf("FAIL NULL buffer returned %d, expected 5\n", len);
+    }
+}
+
+//
+// random flags, width and precision with random values
+//
+static void testRandom()
+{
+    static const char *flags[] = { "", "-", "+", " ", "0", "-+", "+0", "#", " #" };
+    static const char intConv[] = "diuxXo";
+    static const char fltConv[] = "feEgG";
+    char format[32];
+    long long ival;
+    double fval;
+    int prec, width;
+    char conv;
+
+    srand(2016);
+
+    for( int i = 0; i < RANDOM_ROUNDS; i++ )
+    {
+        width = rand() % 16;
+        prec = rand() % 12 - 1;
+        conv = intConv[rand() % (sizeof(intConv) - 1)];
+        ival = ((long long) rand() << 32 | rand()) >> (rand() % 63);
+        ival = rand() % 2 ? -ival : ival;
+
+        if( prec < 0 )
+        {
+            snprintf(format, sizeof(format), "%%%s%dll%c",
+                     flags[rand() % 9], width, conv);
+        }
+        else
+        {
+            snprintf(format, sizeof(format), "%%%s%d.%dll%c",
+                     flags[rand() % 9], width, prec, conv);
+        }
+        CHECK(format, ival);
+
+        // at most 15 significant digits
+        conv = fltConv[rand() % (sizeof(fltConv) - 1)];
+        fval = (double) (rand() % 1000000000) / pow(10, rand() % 16);
+        fval = rand() % 2 ? -fval : fval;
+        prec = conv == 'f' ? rand() % 6 : rand() % 15;
+
+        // no '#', see above
+        snprintf(format, sizeof(format), "%%%s%d.%d%c",
+                 flags[rand() % 7], width, prec, conv);
+        CHECK(format, fval);
+    }
+}
+
+int main()
+{
+    testIntegers();
+    testStrings();
+    testFloats();
+    testExtensions();
+    testRandom();
+
+    printf("%d of %d checks failed\n", fails, total);
+
+    return( fails != 0 );
+}
@@ -0,0 +1,369 @@
+//
+// ************************************************************************
+// SimpleTask
+// (C) 2016 Dirk Schanz aka dreamshader
+// ************************************************************************
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ************************************************************************
+//
+//   A cooperative scheduler for the loop() of a sketch, instead of
+//   polling with millis() - last >= interval and delay().
+//
+//   Tasks are fixed-rate (Every()) or one-shot (After()). They are kept
+//   in a min-heap ordered by deadline, so Run() only has to look at the
+//   first one. Run() executes at most one due task per call, the rest
+//   of loop() (e.g. handleClient()) never waits for more than one task.
+//   A task has to return quickly, a long job is split into steps that
+//   schedule each other.
+//
+//   Runtime, lateness and overruns (periods missed because the task or
+//   loop() was too slow) are recorded per task. IdleMillis() tells how
+//   long loop() may sleep until the next deadline.
+//
+//   The library is header only, all tasks live in a fixed table of
+//   SIMPLE_TASK_MAX_TASKS entries.
+//
+// ************************************************************************
+//
+//
+//-------- History --------------------------------------------------------
+//
+// 2016/12/30: initial version
+// 2016/12/31: a task that cancels itself and takes its id again for a
+//             new task while it runs no longer spoils the new task
+// 2017/01/01: one-shot tasks record their statistics, they stay
+//             readable by GetInfo() until the id is reused
+//
+//
+// ************************************************************************
+
+#ifndef _SIMPLE_TASK_H_
+#define _SIMPLE_TASK_H_
+
+#include <inttypes.h>
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// max. number of tasks a SimpleTask instance can hold
+
+#ifndef SIMPLE_TASK_MAX_TASKS
+#define SIMPLE_TASK_MAX_TASKS      8
+#endif
+
+// return values
+
+#define SIMPLE_TASK_SUCCESS        0
+#define SIMPLE_TASK_FULL          -1
+#define SIMPLE_TASK_INVAL         -2
+
+// IdleMillis() without any task
+
+#define SIMPLE_TASK_NO_DEADLINE   0xFFFFFFFFUL
+
+typedef void (*SimpleTaskFunc)(void *arg);
+
+struct SimpleTaskInfo {
+    const char *name;
+    SimpleTaskFunc func;
+    void *arg;
+    unsigned long interval;        // msecs, 0 for a one-shot task
+    unsigned long due;             // millis() of the next run
+    unsigned long runs;
+    unsigned long lastMicros;      // runtime of the last run
+    unsigned long maxMicros;       // longest run
+    unsigned long maxLate;         // msecs a run started after its deadline
+    unsigned long overruns;        // periods skipped
+    bool used;
+};
+
+class SimpleTask {
+private:
+    SimpleTaskInfo _tasks[SIMPLE_TASK_MAX_TASKS];
+    uint8_t _heap[SIMPLE_TASK_MAX_TASKS];     // task ids, earliest due first
+    uint8_t _gen[SIMPLE_TASK_MAX_TASKS];      // counts up when an id is reused
+    int _heapLen;
+
+    // deadlines are compared like millis() intervals, so they survive
+    // the wrap of millis()
+    bool before(int a, int b)
+    {
+        return( (long) (_tasks[_heap[a]].due - _tasks[_heap[b]].due) < 0 );
+    }
+
+    void swap(int a, int b)
+    {
+        uint8_t id = _heap[a];
+
+        _heap[a] = _heap[b];
+        _heap[b] = id;
+    }
+
+    void siftUp(int pos)
+    {
+        while( pos > 0 && before(pos, (pos - 1) / 2) )
+        {
+            swap(pos, (pos - 1) / 2);
+            pos = (pos - 1) / 2;
+        }
+    }
+
+    void siftDown(int pos)
+    {
+        int child;
+
+        while( (child = 2 * pos + 1) < _heapLen )
+        {
+            if( child + 1 < _heapLen && before(child + 1, child) )
+            {
+                child++;
+            }
+
+            if( !before(child, pos) )
+            {
+                break;
+            }
+
+            swap(pos, child);
+            pos = child;
+        }
+    }
+
+    void push(int id)
+    {
+        _heap[_heapLen] = id;
+        siftUp(_heapLen++);
+    }
+
+    void removeAt(int pos)
+    {
+        _heap[pos] = _heap[--_heapLen];
+
+        if( pos < _heapLen )
+        {
+            siftUp(pos);
+            siftDown(pos);
+        }
+    }
+
+    int add(unsigned long delayMillis, unsigned long interval,
+            SimpleTaskFunc func, void *arg, const char *name)
+    {
+        int retVal = SIMPLE_TASK_FULL;
+
+        if( func == NULL )
+        {
+            retVal = SIMPLE_TASK_INVAL;
+        }
+        else
+        {
+            for( int id = 0; id < SIMPLE_TASK_MAX_TASKS; id++ )
+            {
+                if( !_tasks[id].used )
+                {
+                    memset(&_tasks[id], 0, sizeof(_tasks[id]));
+                    _tasks[id].name = name;
+                    _tasks[id].func = func;
+                    _tasks[id].arg = arg;
+                    _tasks[id].interval = interval;
+                    _tasks[id].due = millis() + delayMillis;
+                    _tasks[id].used = true;
+                    _gen[id]++;
+                    push(id);
+                    retVal = id;
+                    break;
+                }
+            }
+        }
+
+        return( retVal );
+    }
+
+public:
+    SimpleTask() : _heapLen(0)
+    {
+        memset(_tasks, 0, sizeof(_tasks));
+        memset(_gen, 0, sizeof(_gen));
+    };
+
+    //
+    // run func every interval msecs, the first time after interval.
+    // Returns the id of the task or SIMPLE_TASK_FULL.
+    //
+    int Every(unsigned long interval, SimpleTaskFunc func, void *arg = NULL, const char *name = NULL)
+    {
+        return( interval > 0 ? add(interval, interval, func, arg, name) : SIMPLE_TASK_INVAL );
+    };
+
+    //
+    // run func once after delayMillis msecs, the id is free again
+    // afterwards
+    //
+    int After(unsigned long delayMillis, SimpleTaskFunc func, void *arg = NULL, const char *name = NULL)
+    {
+        return( add(delayMillis, 0, func, arg, name) );
+    };
+
+    //
+    // remove a task. A task may cancel itself while it runs, and even
+    // add a new task then, which may get the same id.
+    //
+    int Cancel(int id)
+    {
+        int retVal = SIMPLE_TASK_INVAL;
+
+        if( id >= 0 && id < SIMPLE_TASK_MAX_TASKS && _tasks[id].used )
+        {
+            _tasks[id].used = false;
+
+            for( int pos = 0; pos < _heapLen; pos++ )
+            {
+                if( _heap[pos] == id )
+                {
+                    removeAt(pos);
+                    break;
+                }
+            }
+
+            retVal = SIMPLE_TASK_SUCCESS;
+        }
+
+        return( retVal );
+    };
+
+    //
+    // run the next task if it is due. Returns true if a task has run.
+    // Periods a fixed-rate task has missed are skipped and counted as
+    // overruns, it is not run several times to catch up.
+    //
+    bool Run()
+    {
+        SimpleTaskInfo *task;
+        unsigned long now = millis();
+        unsigned long start, duration, missed;
+        uint8_t gen;
+        int id;
+        bool retVal = false;
+
+        if( _heapLen > 0 && (long) (now - _tasks[_heap[0]].due) >= 0 )
+        {
+            id = _heap[0];
+            task = &_tasks[id];
+            removeAt(0);
+
+            if( now - task->due > task->maxLate )
+            {
+                task->maxLate = now - task->due;
+            }
+
+            gen = _gen[id];
+            start = micros();
+            task->func(task->arg);
+            duration = micros() - start;
+
+            if( !task->used || _gen[id] != gen )
+            {
+                // cancelled itself, the id may belong to a new task now
+            }
+            else
+            {
+                task->lastMicros = duration;
+                task->runs++;
+
+                if( duration > task->maxMicros )
+                {
+                    task->maxMicros = duration;
+                }
+
+                if( task->interval == 0 )
+                {
+                    // the statistics stay readable until the id is reused
+                    task->used = false;
+                }
+                else
+                {
+                    task->due += task->interval;
+                    now = millis();
+
+                    if( (long) (now - task->due) >= 0 )
+                    {
+                        missed = (now - task->due) / task->interval + 1;
+                        task->overruns += missed;
+                        task->due += missed * task->interval;
+                    }
+
+                    push(id);
+                }
+            }
+
+            retVal = true;
+        }
+
+        return( retVal );
+    };
+
+    //
+    // msecs until the next deadline, 0 if a task is due,
+    // SIMPLE_TASK_NO_DEADLINE if there is no task
+    //
+    unsigned long IdleMillis()
+    {
+        unsigned long retVal = SIMPLE_TASK_NO_DEADLINE;
+        long left;
+
+        if( _heapLen > 0 )
+        {
+            left = (long) (_tasks[_heap[0]].due - millis());
+            retVal = left > 0 ? (unsigned long) left : 0;
+        }
+
+        return( retVal );
+    };
+
+    //
+    // wait until the next deadline, but at most maxMillis. On an ESP8266
+    // with WiFi.setSleepMode(WIFI_LIGHT_SLEEP) the chip sleeps meanwhile.
+    //
+    void Idle(unsigned long maxMillis)
+    {
+        unsigned long idle = IdleMillis();
+
+        if( idle > maxMillis )
+        {
+            idle = maxMillis;
+        }
+
+        if( idle > 0 )
+        {
+            delay(idle);
+        }
+    };
+
+    //
+    // statistics of a task. A finished one-shot task or a cancelled one
+    // keeps its statistics until its id is reused, used is false then.
+    // NULL for an id that never had a task.
+    //
+    const SimpleTaskInfo *GetInfo(int id)
+    {
+        return( id >= 0 && id < SIMPLE_TASK_MAX_TASKS && _tasks[id].func != NULL ? &_tasks[id] : NULL );
+    };
+};
+
+#endif // _SIMPLE_TASK_H_
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+#
+# ************************************************************************
+# copy the parts of the sketch a host test needs into an include file
+# (C) 2016 Dirk Schanz aka dreamshader
+# ************************************************************************
+#
+#   extract.py <sketch> <output> <name> ...
+#
+#   Writes all single line #defines of the sketch, followed by the
+#   enums, structs and global variables and then the functions with the
+#   given names, each in the order they have in the sketch. A function
+#   starts at column 0 and ends with the first "}" at column 0. Like the
+#   Arduino IDE does, prototypes of the functions are put in front of
+#   them. A define the sketch has once per #if branch is taken the first
+#   time only.
+#
+#   Used by the host tests in the tests/ folder of the sketches.
+#
+# ************************************************************************
+#
+
+import re
+import sys
+
+
+def extract(lines, names):
+    parts = []
+    i = 0
+
+    while i < len(lines):
+        line = lines[i]
+        m = (re.match(r'(?:static\s+)?(?:constexpr\s+)?(?:struct|enum)\s+(\w+)', line) or
+             re.match(r'[A-Za-z_][\w\s\*&:<>]*?[\s\*&](\w+)\s*(?:\(|\[|=|;)', line))
+
+        if m and m.group(1) in names and not line.startswith((' ', '\t', '#', '/')):
+            code = line.split('//')[0].rstrip()
+            end = i
+
+            if not code.endswith(';'):
+                # function, struct or initialized table
+                while not re.match(r'\}', lines[end]):
+                    end += 1
+
+            parts.append(''.join(lines[i:end + 1]))
+            names.discard(m.group(1))
+            i = end
+
+        i += 1
+
+    return( parts )
+
+
+def main():
+    sketch, output = sys.argv[1], sys.argv[2]
+    names = set(sys.argv[3:])
+    lines = open(sketch, encoding='latin-1').readlines()
+    defines = []
+    seen = set()
+
+    for l in lines:
+        if l.startswith('#define') and not l.rstrip().endswith('\\') and l.split()[1] not in seen:
+            defines.append(l)
+            seen.add(l.split()[1])
+
+    parts = extract(lines, names)
+
+    if names:
+        sys.exit('not found in %s: %s' % (sketch, ' '.join(sorted(names))))
+
+    with open(output, 'w') as out:
+        out.write('// generated by extract.py from %s\n\n' % sketch)
+        functions = [p for p in parts if p.split('\n')[0].rstrip().endswith(')')]
+        out.writelines(defines)
+        out.write('\n')
+        out.write('\n'.join(p for p in parts if p not in functions))
+        out.write('\n')
+        out.writelines(p.split('\n')[0] + ';\n' for p in functions)
+        out.write('\n')
+        out.write('\n'.join(functions))
+
+
+main()